@@ -1,4 +1,4 @@
-/* Copyright (c) 2020-2025, Arm Limited and Contributors
+/* Copyright (c) 2020-2026, Arm Limited and Contributors
  * Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
@@ -18,16 +18,70 @@
 
 #include "benchmark_mode.h"
 
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+#include "filesystem/filesystem.hpp"
 #include "platform/platform.h"
 
 namespace plugins
 {
+namespace
+{
+/**
+ * @brief Returns the value below which the given fraction of the sorted values fall, using the nearest rank
+ */
+float percentile(const std::vector<float> &sorted_values, float fraction)
+{
+	size_t rank = static_cast<size_t>(std::ceil(fraction * sorted_values.size()));
+	return sorted_values[std::clamp(rank, size_t{1}, sorted_values.size()) - 1];
+}
+
+/**
+ * @brief Finds a metric in a report, written either as a JSON member or as a CSV row
+ */
+std::optional<float> find_metric(const std::string &report, const std::string &name)
+{
+	size_t position = report.find("\"" + name + "\":");
+	if (position != std::string::npos)
+	{
+		position += name.size() + 3;
+	}
+	else if (report.starts_with(name + ","))
+	{
+		position = name.size() + 1;
+	}
+	else if ((position = report.find("\n" + name + ",")) != std::string::npos)
+	{
+		position += name.size() + 2;
+	}
+	else
+	{
+		return std::nullopt;
+	}
+
+	try
+	{
+		return std::stof(report.substr(position, report.find_first_of(",\n}", position) - position));
+	}
+	catch (const std::exception &)
+	{
+		return std::nullopt;
+	}
+}
+}        // namespace
+
 BenchmarkMode::BenchmarkMode() :
     BenchmarkModeTags("Benchmark Mode",
                       "Log frame averages after running an app.",
                       {vkb::Hook::OnUpdate, vkb::Hook::OnAppStart, vkb::Hook::OnAppClose},
                       {},
-                      {{"benchmark", "Enable benchmark mode"}})
+                      {{"benchmark", "Enable benchmark mode"},
+                       {"benchmark-baseline", "Compare the frame times against the report of a previous run"},
+                       {"benchmark-report", "Write the frame time report to a file, as CSV if it ends in .csv and JSON otherwise"},
+                       {"benchmark-threshold", "Slowdown from the baseline reported as a regression, in percent (default 10)"},
+                       {"benchmark-warmup", "Number of frames to run before recording frame times"}})
 {
 }
 
@@ -45,24 +99,179 @@ bool BenchmarkMode::handle_option(std::deque<std::string> &arguments)
 		arguments.pop_front();
 		return true;
 	}
+	else if (option == "benchmark-baseline" || option == "benchmark-report" || option == "benchmark-threshold" || option == "benchmark-warmup")
+	{
+		if (arguments.size() < 2)
+		{
+			LOGE("Option \"{}\" is missing its value!", option);
+			return false;
+		}
+
+		if (option == "benchmark-baseline")
+		{
+			baseline_path = arguments[1];
+		}
+		else if (option == "benchmark-report")
+		{
+			report_path = arguments[1];
+		}
+		else if (option == "benchmark-threshold")
+		{
+			regression_threshold = std::stof(arguments[1]);
+		}
+		else
+		{
+			warmup_frames = static_cast<uint32_t>(std::stoul(arguments[1]));
+		}
+
+		arguments.pop_front();
+		arguments.pop_front();
+		return true;
+	}
 	return false;
 }
 
 void BenchmarkMode::on_update(float delta_time)
 {
-	elapsed_time += delta_time;
 	total_frames++;
+	if (total_frames <= warmup_frames)
+	{
+		return;
+	}
+
+	// The delta time is measured before the simulation frame time is fixed, so it is the actual time of the frame
+	elapsed_time += delta_time;
+	frame_times[recorded_frames % MAX_RECORDED_FRAMES] = delta_time * 1000.0f;
+	recorded_frames++;
 }
 
 void BenchmarkMode::on_app_start(const std::string &app_id)
 {
-	elapsed_time = 0;
-	total_frames = 0;
+	elapsed_time    = 0;
+	total_frames    = 0;
+	recorded_frames = 0;
+
+	// Allocated upfront, so that recording a frame never allocates
+	frame_times.resize(MAX_RECORDED_FRAMES);
+
 	LOGI("Starting Benchmark for {}", app_id);
 }
 
 void BenchmarkMode::on_app_close(const std::string &app_id)
 {
-	LOGI("Benchmark for {} completed in {} seconds (ran {} frames, averaged {} fps)", app_id, elapsed_time, total_frames, total_frames / elapsed_time);
+	uint32_t measured_frames = total_frames - std::min(total_frames, warmup_frames);
+	LOGI("Benchmark for {} completed in {} seconds (ran {} frames, averaged {} fps)", app_id, elapsed_time, measured_frames, measured_frames / elapsed_time);
+
+	if (recorded_frames == 0)
+	{
+		return;
+	}
+
+	auto summary = summarize();
+	LOGI("Frame times: p50 {:.2f} ms, p90 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms, {} stutters",
+	     summary.p50, summary.p90, summary.p99, summary.max, summary.stutter_count);
+
+	bool regressed = !baseline_path.empty() && check_regression(summary);
+
+	if (!report_path.empty())
+	{
+		write_report(app_id, summary, regressed);
+	}
+}
+
+bool BenchmarkMode::check_regression(const FrameTimeSummary &summary) const
+{
+	auto fs = vkb::filesystem::get();
+	if (!fs->is_file(baseline_path))
+	{
+		LOGE("Benchmark baseline {} not found", baseline_path);
+		return false;
+	}
+	std::string baseline = fs->read_file_string(baseline_path);
+
+	bool regressed = false;
+	for (auto [name, value] : {std::make_pair("p50_ms", summary.p50), std::make_pair("p90_ms", summary.p90), std::make_pair("p99_ms", summary.p99)})
+	{
+		auto baseline_value = find_metric(baseline, name);
+		if (!baseline_value)
+		{
+			LOGW("Benchmark baseline {} has no {}", baseline_path, name);
+			continue;
+		}
+
+		float change = (value - *baseline_value) / *baseline_value * 100.0f;
+		if (regression_threshold < change)
+		{
+			LOGE("Benchmark regression: {} is {:.2f} ms, {:.1f}% slower than the baseline {:.2f} ms", name, value, change, *baseline_value);
+			regressed = true;
+		}
+		else
+		{
+			LOGI("Benchmark {} is {:.2f} ms, {:+.1f}% from the baseline {:.2f} ms", name, value, change, *baseline_value);
+		}
+	}
+	return regressed;
+}
+
+BenchmarkMode::FrameTimeSummary BenchmarkMode::summarize() const
+{
+	// Once the ring is full it holds the most recent frames
+	std::vector<float> sorted_times(frame_times.begin(), frame_times.begin() + std::min<size_t>(recorded_frames, MAX_RECORDED_FRAMES));
+	std::sort(sorted_times.begin(), sorted_times.end());
+
+	FrameTimeSummary summary;
+	summary.frame_count = static_cast<uint32_t>(sorted_times.size());
+	for (float frame_time : sorted_times)
+	{
+		summary.average += frame_time;
+	}
+	summary.average /= sorted_times.size();
+	summary.p50 = percentile(sorted_times, 0.5f);
+	summary.p90 = percentile(sorted_times, 0.9f);
+	summary.p99 = percentile(sorted_times, 0.99f);
+	summary.max = sorted_times.back();
+
+	float stutter_time    = STUTTER_FACTOR * summary.p50;
+	summary.stutter_count = static_cast<uint32_t>(sorted_times.end() - std::upper_bound(sorted_times.begin(), sorted_times.end(), stutter_time));
+
+	return summary;
+}
+
+void BenchmarkMode::write_report(const std::string &app_id, const FrameTimeSummary &summary, bool regressed) const
+{
+	std::string report;
+	if (report_path.ends_with(".csv"))
+	{
+		report = fmt::format("metric,value\n"
+		                     "frames,{}\n"
+		                     "warmup_frames,{}\n"
+		                     "average_ms,{:.3f}\n"
+		                     "p50_ms,{:.3f}\n"
+		                     "p90_ms,{:.3f}\n"
+		                     "p99_ms,{:.3f}\n"
+		                     "max_ms,{:.3f}\n"
+		                     "stutters,{}\n"
+		                     "regressed,{}\n",
+		                     summary.frame_count, warmup_frames, summary.average, summary.p50, summary.p90, summary.p99, summary.max, summary.stutter_count, regressed);
+	}
+	else
+	{
+		report = fmt::format("{{\n"
+		                     "  \"app\": \"{}\",\n"
+		                     "  \"frames\": {},\n"
+		                     "  \"warmup_frames\": {},\n"
+		                     "  \"average_ms\": {:.3f},\n"
+		                     "  \"p50_ms\": {:.3f},\n"
+		                     "  \"p90_ms\": {:.3f},\n"
+		                     "  \"p99_ms\": {:.3f},\n"
+		                     "  \"max_ms\": {:.3f},\n"
+		                     "  \"stutters\": {},\n"
+		                     "  \"regressed\": {}\n"
+		                     "}}\n",
+		                     app_id, summary.frame_count, warmup_frames, summary.average, summary.p50, summary.p90, summary.p99, summary.max, summary.stutter_count, regressed);
+	}
+
+	vkb::filesystem::get()->write_file(report_path, report);
+	LOGI("Benchmark report written to {}", report_path);
 }
 }        // namespace plugins
@@ -1,4 +1,4 @@
-/* Copyright (c) 2020-2025, Arm Limited and Contributors
+/* Copyright (c) 2020-2026, Arm Limited and Contributors
  * Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "platform/plugins/plugin_base.h"
 
 namespace plugins
@@ -31,7 +33,12 @@ using BenchmarkModeTags = vkb::PluginBase<BenchmarkMode, vkb::tags::Passive>;
  *
  * When enabled frame time statistics of a samples run will be printed to the console when an application closes. The simulation frame time (delta time) is also locked to 60FPS so that statistics can be compared more accurately across different devices.
  *
+ * The time of every frame after the warmup frames is recorded, and the median, 90th and 99th percentiles, maximum and
+ * number of stutters are reported. The report can be written to a JSON or CSV file, and compared against the report of
+ * a previous run, in which case any percentile slower than the baseline by more than the threshold is logged as an error.
+ *
  * Usage: vulkan_samples sample afbc --benchmark
+ *        vulkan_samples sample afbc --benchmark --benchmark-warmup 60 --benchmark-report afbc.json --benchmark-baseline baseline.json --benchmark-threshold 5
  *
  */
 class BenchmarkMode : public BenchmarkModeTags
@@ -48,7 +55,44 @@ class BenchmarkMode : public BenchmarkModeTags
 	bool handle_option(std::deque<std::string> &arguments) override;
 
   private:
-	float    elapsed_time = 0.0f;
-	uint32_t total_frames = 0;
+	/**
+	 * @brief The frame time distribution of a run, in milliseconds
+	 */
+	struct FrameTimeSummary
+	{
+		uint32_t frame_count   = 0;
+		float    average       = 0.0f;
+		float    p50           = 0.0f;
+		float    p90           = 0.0f;
+		float    p99           = 0.0f;
+		float    max           = 0.0f;
+		uint32_t stutter_count = 0;
+	};
+
+	/**
+	 * @brief Checks the percentiles of a run against the baseline report
+	 * @return True if any of them is slower than the baseline by more than the regression threshold
+	 */
+	bool check_regression(const FrameTimeSummary &summary) const;
+
+	FrameTimeSummary summarize() const;
+
+	void write_report(const std::string &app_id, const FrameTimeSummary &summary, bool regressed) const;
+
+  private:
+	// The number of frame times kept, older ones are overwritten once it is reached
+	static constexpr size_t MAX_RECORDED_FRAMES = 1 << 16;
+
+	// A frame is counted as a stutter when it takes this many times as long as the median frame
+	static constexpr float STUTTER_FACTOR = 2.0f;
+
+	std::string        baseline_path;
+	float              elapsed_time = 0.0f;
+	std::vector<float> frame_times;                   // Ring of the recorded frame times, in milliseconds
+	uint32_t           recorded_frames      = 0;
+	float              regression_threshold = 10.0f;        // In percent of the baseline
+	std::string        report_path;
+	uint32_t           total_frames  = 0;
+	uint32_t           warmup_frames = 0;
 };
 }        // namespace plugins
\ No newline at end of file
@@ -22,6 +22,7 @@
 
 #include "platform/platform.h"
 #include "platform/window.h"
+#include "vulkan_sample.h"
 
 namespace plugins
 {
@@ -31,6 +32,7 @@ WindowOptions::WindowOptions() :
                       {},
                       {},
                       {{"borderless", "Run in borderless mode"},
+                       {"frames-in-flight", "Number of frames recorded ahead of the GPU, independently of the number of swapchain images"},
                        {"fullscreen", "Run in fullscreen mode"},
                        {"headless-surface", "Run in headless surface mode. A Surface and swap-chain is still created using VK_EXT_headless_surface."},
                        {"height", "Initial window height"},
@@ -54,6 +56,22 @@ bool WindowOptions::handle_option(std::deque<std::string> &arguments)
 		arguments.pop_front();
 		return true;
 	}
+	else if (option == "frames-in-flight")
+	{
+		if (arguments.size() < 2)
+		{
+			LOGE("Option \"frames-in-flight\" is missing the actual count!");
+			return false;
+		}
+		uint32_t frame_count = static_cast<uint32_t>(std::stoul(arguments[1]));
+
+		vkb::VulkanSampleC::selected_frames_in_flight   = frame_count;
+		vkb::VulkanSampleCpp::selected_frames_in_flight = frame_count;
+
+		arguments.pop_front();
+		arguments.pop_front();
+		return true;
+	}
 	else if (option == "fullscreen")
 	{
 		properties.mode = vkb::Window::Mode::Fullscreen;
@@ -1,4 +1,4 @@
-/* Copyright (c) 2023, Thomas Atkinson
+/* Copyright (c) 2023-2026, Thomas Atkinson
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -17,14 +17,123 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <functional>
 
+#if defined(_MSC_VER) && defined(_M_X64)
+#	include <intrin.h>
+#endif
+
 namespace vkb
 {
+namespace detail
+{
+constexpr uint64_t hash_secret[4] = {0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull};
+
+/**
+ * @brief Multiplies two 64-bit values to 128 bits and folds the result back to 64 bits, as the wyhash mixer does
+ */
+inline uint64_t hash_mix(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+	__uint128_t r = static_cast<__uint128_t>(a) * b;
+	return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	uint64_t hi;
+	uint64_t lo = _umul128(a, b, &hi);
+	return lo ^ hi;
+#else
+	uint64_t a_hi  = a >> 32;
+	uint64_t a_lo  = a & 0xffffffffull;
+	uint64_t b_hi  = b >> 32;
+	uint64_t b_lo  = b & 0xffffffffull;
+	uint64_t mid_0 = a_hi * b_lo;
+	uint64_t mid_1 = a_lo * b_hi;
+	uint64_t lo    = a_lo * b_lo;
+	uint64_t t     = lo + (mid_0 << 32);
+	uint64_t carry = t < lo;
+	lo             = t + (mid_1 << 32);
+	carry += lo < t;
+	uint64_t hi = a_hi * b_hi + (mid_0 >> 32) + (mid_1 >> 32) + carry;
+	return lo ^ hi;
+#endif
+}
+
+inline uint64_t hash_read_u64(const uint8_t *data)
+{
+	uint64_t value;
+	std::memcpy(&value, data, sizeof(value));
+	return value;
+}
+}        // namespace detail
+
+/**
+ * @brief Streaming, allocation-free 64-bit hasher in the style of wyhash.
+ *        Every call to add() or add_bytes() is folded into the state, so like hash_combine
+ *        the result depends on the sequence of calls and not only on the concatenated bytes.
+ */
+class Hasher
+{
+  public:
+	explicit Hasher(uint64_t seed = 0) :
+	    state{seed ^ detail::hash_secret[0]}
+	{}
+
+	/**
+	 * @brief Adds a 64-bit value to the hash
+	 */
+	Hasher &add(uint64_t value)
+	{
+		state = detail::hash_mix(state ^ detail::hash_secret[1], value ^ detail::hash_secret[2]);
+		return *this;
+	}
+
+	/**
+	 * @brief Adds a block of bytes to the hash, 16 bytes per mixing step
+	 */
+	Hasher &add_bytes(const void *data, size_t size)
+	{
+		auto  *bytes = static_cast<const uint8_t *>(data);
+		size_t i     = 0;
+		for (; i + 16 <= size; i += 16)
+		{
+			state = detail::hash_mix(detail::hash_read_u64(bytes + i) ^ detail::hash_secret[1], detail::hash_read_u64(bytes + i + 8) ^ state);
+		}
+
+		if (i < size)
+		{
+			uint8_t tail[16]{};
+			std::memcpy(tail, bytes + i, size - i);
+			state = detail::hash_mix(detail::hash_read_u64(tail) ^ detail::hash_secret[1], detail::hash_read_u64(tail + 8) ^ state);
+		}
+
+		return add(size);
+	}
+
+	uint64_t get() const
+	{
+		return detail::hash_mix(state ^ detail::hash_secret[3], detail::hash_secret[0]);
+	}
+
+  private:
+	uint64_t state;
+};
+
+/**
+ * @brief Hashes a block of bytes without copying it
+ */
+inline uint64_t hash_bytes(const void *data, size_t size, uint64_t seed = 0)
+{
+	return Hasher{seed}.add_bytes(data, size).get();
+}
+
+/**
+ * @brief Combines a hash into a seed with a full 64-bit multiply-mix
+ */
 inline void hash_combine(size_t &seed, size_t hash)
 {
-	hash += 0x9e3779b9 + (seed << 6) + (seed >> 2);
-	seed ^= hash;
+	seed = static_cast<size_t>(detail::hash_mix(static_cast<uint64_t>(seed) ^ detail::hash_secret[0], static_cast<uint64_t>(hash) ^ detail::hash_secret[1]));
 }
 
 /**
@@ -38,4 +147,4 @@ inline void hash_combine(size_t &seed, const T &v)
 
 	hash_combine(seed, hasher(v));
 }
-}        // namespace vkb
\ No newline at end of file
+}        // namespace vkb
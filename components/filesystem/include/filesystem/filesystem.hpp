@@ -19,6 +19,7 @@
 
 #include <filesystem>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -38,6 +39,42 @@ struct FileStat
 
 using Path = std::filesystem::path;
 
+// A read-only view of the contents of a file, which stays valid as long as any copy of the MappedFile is alive
+class MappedFile
+{
+  public:
+	MappedFile() = default;
+
+	// The storage keeps the bytes alive, and releases them (e.g. unmaps the file) when the last reference goes away
+	MappedFile(std::span<const uint8_t> bytes, std::shared_ptr<const void> storage) :
+	    bytes{bytes}, storage{std::move(storage)}
+	{}
+
+	const uint8_t *data() const
+	{
+		return bytes.data();
+	}
+
+	size_t size() const
+	{
+		return bytes.size();
+	}
+
+	bool empty() const
+	{
+		return bytes.empty();
+	}
+
+	std::span<const uint8_t> span() const
+	{
+		return bytes;
+	}
+
+  private:
+	std::span<const uint8_t>    bytes;
+	std::shared_ptr<const void> storage;
+};
+
 // A thin filesystem wrapper
 class FileSystem
 {
@@ -65,6 +102,9 @@ class FileSystem
 
 	// Read the entire file into a vector of bytes
 	std::vector<uint8_t> read_file_binary(const Path &path);
+
+	// Map the entire file into memory for reading, the default implementation reads it into memory instead
+	virtual MappedFile map_file(const Path &path);
 };
 
 using FileSystemPtr = std::shared_ptr<FileSystem>;
@@ -26,6 +26,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include "filesystem/filesystem.hpp"
+
 namespace vkb
 {
 namespace fs
@@ -95,6 +97,14 @@ void create_path(const std::string &root, const std::string &path);
  */
 std::vector<uint8_t> read_asset(const std::string &filename);
 
+/**
+ * @brief Helper to map an asset file into memory for reading, without copying it
+ *
+ * @param filename The path to the file (relative to the assets directory)
+ * @return A read-only view of the file, valid as long as the returned object is alive
+ */
+vkb::filesystem::MappedFile map_asset(const std::string &filename);
+
 /**
  * @brief Helper to read a text file into a single string
  *
@@ -63,5 +63,11 @@ std::vector<uint8_t> FileSystem::read_file_binary(const Path &path)
 	return read_chunk(path, 0, stat.size);
 }
 
+MappedFile FileSystem::map_file(const Path &path)
+{
+	auto data = std::make_shared<const std::vector<uint8_t>>(read_file_binary(path));
+	return MappedFile{*data, data};
+}
+
 }        // namespace filesystem
 }        // namespace vkb
\ No newline at end of file
@@ -17,6 +17,8 @@
 
 #include "filesystem/legacy.h"
 
+#include <cstring>
+
 #include "core/util/error.hpp"
 
 VKBP_DISABLE_WARNINGS()
@@ -109,6 +111,11 @@ std::vector<uint8_t> read_asset(const std::string &filename)
 	return vkb::filesystem::get()->read_file_binary(path::get(path::Type::Assets) + filename);
 }
 
+vkb::filesystem::MappedFile map_asset(const std::string &filename)
+{
+	return vkb::filesystem::get()->map_file(path::get(path::Type::Assets) + filename);
+}
+
 std::string read_text_file(const std::string &filename)
 {
 	return vkb::filesystem::get()->read_file_string(path::get(path::Type::Shaders) + filename);
@@ -116,9 +123,11 @@ std::string read_text_file(const std::string &filename)
 
 std::vector<uint32_t> read_shader_binary_u32(const std::string &filename)
 {
-	auto buffer = vkb::filesystem::get()->read_file_binary(path::get(path::Type::Shaders) + filename);
-	assert(buffer.size() % sizeof(uint32_t) == 0);
-	auto spirv = std::vector<uint32_t>(reinterpret_cast<uint32_t *>(buffer.data()), reinterpret_cast<uint32_t *>(buffer.data()) + buffer.size() / sizeof(uint32_t));
+	// Copy straight from the mapped file into the words, instead of reading it into a byte buffer first
+	auto file = vkb::filesystem::get()->map_file(path::get(path::Type::Shaders) + filename);
+	assert(file.size() % sizeof(uint32_t) == 0);
+	auto spirv = std::vector<uint32_t>(file.size() / sizeof(uint32_t));
+	std::memcpy(spirv.data(), file.data(), spirv.size() * sizeof(uint32_t));
 	return spirv;
 }
 
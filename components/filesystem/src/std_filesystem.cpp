@@ -22,6 +22,21 @@
 #include <filesystem>
 #include <fstream>
 
+#if defined(_WIN32)
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
 namespace vkb
 {
 namespace filesystem
@@ -109,6 +124,71 @@ std::vector<uint8_t> StdFileSystem::read_chunk(const Path &path, size_t offset,
 	return data;
 }
 
+MappedFile StdFileSystem::map_file(const Path &path)
+{
+#if defined(_WIN32)
+	HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		throw std::runtime_error("Failed to open file for reading at path: " + path.string());
+	}
+
+	LARGE_INTEGER size{};
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+	{
+		// Empty files can not be mapped
+		CloseHandle(file);
+		return FileSystem::map_file(path);
+	}
+
+	// The view keeps the mapping alive, so both handles can be closed right away
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (mapping == nullptr)
+	{
+		return FileSystem::map_file(path);
+	}
+
+	void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (view == nullptr)
+	{
+		return FileSystem::map_file(path);
+	}
+
+	std::shared_ptr<const void> storage{view, [](const void *view) { UnmapViewOfFile(view); }};
+	return MappedFile{{static_cast<const uint8_t *>(view), static_cast<size_t>(size.QuadPart)}, std::move(storage)};
+#elif defined(__unix__) || defined(__APPLE__)
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		throw std::runtime_error("Failed to open file for reading at path: " + path.string());
+	}
+
+	struct stat file_stat{};
+	if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0)
+	{
+		// Empty files can not be mapped
+		close(fd);
+		return FileSystem::map_file(path);
+	}
+
+	// The mapping stays valid after the file descriptor is closed
+	size_t size = static_cast<size_t>(file_stat.st_size);
+	void  *view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (view == MAP_FAILED)
+	{
+		return FileSystem::map_file(path);
+	}
+
+	std::shared_ptr<const void> storage{view, [size](const void *view) { munmap(const_cast<void *>(view), size); }};
+	return MappedFile{{static_cast<const uint8_t *>(view), size}, std::move(storage)};
+#else
+	return FileSystem::map_file(path);
+#endif
+}
+
 void StdFileSystem::write_file(const Path &path, const std::vector<uint8_t> &data)
 {
 	// create directory if it doesn't exist
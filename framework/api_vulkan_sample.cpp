@@ -186,6 +186,11 @@ void ApiVulkanSample::create_render_context()
 	VulkanSample::create_render_context(surface_priority_list);
 }
 
+bool ApiVulkanSample::supports_frames_in_flight() const
+{
+	return false;
+}
+
 void ApiVulkanSample::input_event(const vkb::InputEvent &input_event)
 {
 	VulkanSample::input_event(input_event);
@@ -129,6 +129,9 @@ class ApiVulkanSample : public vkb::VulkanSampleC
 
 	virtual void create_render_context() override;
 
+	// The swapchain images are acquired by the sample itself, and index its command buffers and framebuffers
+	virtual bool supports_frames_in_flight() const override;
+
 	// Handle to the device graphics queue that command buffers are submitted to
 	VkQueue queue;
 
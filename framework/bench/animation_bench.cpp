@@ -0,0 +1,148 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench.h"
+
+#include "scene_graph/components/skin.h"
+#include "scene_graph/node.h"
+#include "scene_graph/scripts/animation.h"
+
+namespace vkb
+{
+namespace bench
+{
+namespace
+{
+// The skeleton of a character, four children per joint, with a translation, a rotation and a scale channel per
+// joint sampled at 60 Hz for 10 s
+constexpr uint32_t NODE_COUNT    = 256;
+constexpr uint32_t CHANNEL_COUNT = 3 * NODE_COUNT;
+constexpr uint32_t KEY_COUNT     = 600;
+constexpr float    KEY_INTERVAL  = 1.0f / 60.0f;
+
+struct AnimatedScene
+{
+	std::vector<std::unique_ptr<vkb::scene_graph::NodeC>> nodes;
+	vkb::sg::Animation                                    animation{"bench"};
+	vkb::sg::Skin                                         skin{"bench"};
+};
+
+vkb::sg::AnimationSampler create_sampler(Random &random, vkb::sg::AnimationTarget target)
+{
+	vkb::sg::AnimationSampler sampler;
+	sampler.inputs.resize(KEY_COUNT);
+	sampler.outputs.resize(KEY_COUNT);
+	for (uint32_t key = 0; key < KEY_COUNT; ++key)
+	{
+		sampler.inputs[key] = key * KEY_INTERVAL;
+		if (target == vkb::sg::Rotation)
+		{
+			sampler.outputs[key] = glm::normalize(glm::vec4{random.next_float(-1.0f, 1.0f), random.next_float(-1.0f, 1.0f), random.next_float(-1.0f, 1.0f), 1.0f});
+		}
+		else
+		{
+			sampler.outputs[key] = {random.next_float(0.5f, 1.5f), random.next_float(0.5f, 1.5f), random.next_float(0.5f, 1.5f), 0.0f};
+		}
+	}
+	return sampler;
+}
+
+std::unique_ptr<AnimatedScene> create_scene()
+{
+	auto   scene = std::make_unique<AnimatedScene>();
+	Random random{22};
+
+	for (uint32_t i = 0; i < NODE_COUNT; ++i)
+	{
+		auto node = std::make_unique<vkb::scene_graph::NodeC>(i, "joint_" + std::to_string(i));
+		if (0 < i)
+		{
+			auto &parent = *scene->nodes[(i - 1) / 4];
+			node->set_parent(parent);
+			parent.add_child(*node);
+		}
+
+		for (auto target : {vkb::sg::Translation, vkb::sg::Rotation, vkb::sg::Scale})
+		{
+			scene->animation.add_channel(*node, target, create_sampler(random, target));
+		}
+		scene->skin.add_joint(*node, glm::translate(glm::vec3{0.0f, -0.1f * i, 0.0f}));
+
+		scene->nodes.push_back(std::move(node));
+	}
+	scene->animation.update_times(0.0f, (KEY_COUNT - 1) * KEY_INTERVAL);
+
+	return scene;
+}
+
+void update_playback(State &state)
+{
+	auto scene = create_scene();
+
+	// Each frame advances the cursors of the channels by one keyframe at most
+	state.set_items_per_iteration(CHANNEL_COUNT);
+	while (state.keep_running())
+	{
+		scene->animation.update(KEY_INTERVAL);
+	}
+}
+
+void update_seek(State &state)
+{
+	auto scene = create_scene();
+
+	// Jumps of up to the length of the animation, so that the cursors fall back to a binary search
+	std::vector<float> deltas(1024);
+	Random             random{222};
+	for (auto &delta : deltas)
+	{
+		delta = random.next_float(0.0f, KEY_COUNT * KEY_INTERVAL);
+	}
+
+	size_t delta_index = 0;
+	state.set_items_per_iteration(CHANNEL_COUNT);
+	while (state.keep_running())
+	{
+		scene->animation.update(deltas[delta_index]);
+		delta_index = (delta_index + 1) % deltas.size();
+	}
+}
+
+void update_skin(State &state)
+{
+	auto scene = create_scene();
+
+	// The CPU side of skinning a frame: the animated joints, then the joint matrices the compute pass reads
+	std::vector<glm::mat4> joint_matrices;
+	state.set_items_per_iteration(NODE_COUNT);
+	while (state.keep_running())
+	{
+		scene->animation.update(KEY_INTERVAL);
+		scene->skin.compute_joint_matrices(glm::mat4{1.0f}, joint_matrices);
+		do_not_optimize(joint_matrices.data());
+	}
+}
+}        // namespace
+
+void register_animation_benchmarks(Runner &runner)
+{
+	runner.add("animation/update_768_channels_playback", update_playback);
+	runner.add("animation/update_768_channels_seek", update_seek);
+	runner.add("animation/update_and_skin_256_joints", update_skin);
+}
+}        // namespace bench
+}        // namespace vkb
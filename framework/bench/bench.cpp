@@ -0,0 +1,221 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench.h"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace vkb
+{
+namespace bench
+{
+namespace
+{
+// Upper bound for cases so fast that the clock barely sees them
+constexpr uint64_t MAX_ITERATIONS = 1000000000;
+
+std::string escape_json(std::string const &text)
+{
+	std::string escaped;
+	for (char c : text)
+	{
+		if (c == '"' || c == '\\')
+		{
+			escaped += '\\';
+		}
+		escaped += c;
+	}
+	return escaped;
+}
+
+std::ofstream open_output(std::string const &path)
+{
+	std::ofstream file{path, std::ios::trunc};
+	if (!file)
+	{
+		throw std::runtime_error("Cannot open benchmark output file: " + path);
+	}
+	return file;
+}
+}        // namespace
+
+State::State(uint64_t iterations) :
+    iterations{iterations}, remaining{iterations}
+{
+}
+
+bool State::keep_running()
+{
+	if (!started)
+	{
+		started = true;
+		running = true;
+		start   = Clock::now();
+	}
+
+	if (remaining == 0)
+	{
+		pause_timing();
+		return false;
+	}
+
+	--remaining;
+	return true;
+}
+
+void State::pause_timing()
+{
+	if (running)
+	{
+		elapsed += Clock::now() - start;
+		running = false;
+	}
+}
+
+void State::resume_timing()
+{
+	if (!running)
+	{
+		running = true;
+		start   = Clock::now();
+	}
+}
+
+void State::set_items_per_iteration(uint64_t items)
+{
+	items_per_iteration = items;
+}
+
+uint64_t State::get_iterations() const
+{
+	return iterations;
+}
+
+uint64_t State::get_items_per_iteration() const
+{
+	return items_per_iteration;
+}
+
+std::chrono::nanoseconds State::get_elapsed() const
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+}
+
+Runner::Runner(std::chrono::milliseconds min_time) :
+    min_time{min_time}
+{
+}
+
+void Runner::add(std::string const &name, Function &&function)
+{
+	cases.push_back({name, std::move(function)});
+}
+
+std::vector<Result> Runner::run(std::string const &filter) const
+{
+	std::vector<Result> results;
+
+	fmt::print("{:<56}{:>14}{:>18}{:>18}\n", "Benchmark", "Iterations", "ns/iteration", "items/s");
+
+	for (auto &bench_case : cases)
+	{
+		if (bench_case.name.find(filter) == std::string::npos)
+		{
+			continue;
+		}
+
+		uint64_t iterations = 1;
+		while (true)
+		{
+			State state{iterations};
+			bench_case.function(state);
+
+			double elapsed_ns = static_cast<double>(std::max<int64_t>(state.get_elapsed().count(), 1));
+			if (min_time <= state.get_elapsed() || MAX_ITERATIONS <= iterations)
+			{
+				Result result{bench_case.name, iterations, elapsed_ns / iterations, 0.0};
+				if (state.get_items_per_iteration())
+				{
+					result.items_per_second = 1e9 * static_cast<double>(iterations * state.get_items_per_iteration()) / elapsed_ns;
+				}
+
+				fmt::print("{:<56}{:>14}{:>18.1f}{:>18.0f}\n", result.name, result.iterations, result.ns_per_iteration, result.items_per_second);
+				results.push_back(result);
+				break;
+			}
+
+			// Aim a bit past the minimum time, growing at most tenfold per run as the first short runs are noisy
+			double   min_time_ns = std::chrono::duration<double, std::nano>(min_time).count();
+			uint64_t next        = static_cast<uint64_t>(1.4 * min_time_ns * iterations / elapsed_ns);
+			iterations           = std::clamp<uint64_t>(next, iterations + 1, std::min(10 * iterations, MAX_ITERATIONS));
+		}
+	}
+
+	return results;
+}
+
+void write_json(std::vector<Result> const &results, std::string const &path)
+{
+	auto file = open_output(path);
+
+	file << "{\n  \"benchmarks\": [";
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		auto &result = results[i];
+		file << (i == 0 ? "\n" : ",\n")
+		     << fmt::format("    {{\"name\": \"{}\", \"iterations\": {}, \"ns_per_iteration\": {:.3f}, \"items_per_second\": {:.3f}}}",
+		                    escape_json(result.name), result.iterations, result.ns_per_iteration, result.items_per_second);
+	}
+	file << "\n  ]\n}\n";
+}
+
+void write_csv(std::vector<Result> const &results, std::string const &path)
+{
+	auto file = open_output(path);
+
+	file << "name,iterations,ns_per_iteration,items_per_second\n";
+	for (auto &result : results)
+	{
+		file << fmt::format("{},{},{:.3f},{:.3f}\n", result.name, result.iterations, result.ns_per_iteration, result.items_per_second);
+	}
+}
+
+Random::Random(uint32_t seed) :
+    engine{seed}
+{
+}
+
+uint32_t Random::next_uint(uint32_t bound)
+{
+	return static_cast<uint32_t>((static_cast<uint64_t>(engine()) * bound) >> 32);
+}
+
+float Random::next_float(float min, float max)
+{
+	// The top 24 bits fill the mantissa exactly
+	return min + (max - min) * static_cast<float>(engine() >> 8) * (1.0f / 16777216.0f);
+}
+
+void escape(void const * /*pointer*/)
+{
+}
+}        // namespace bench
+}        // namespace vkb
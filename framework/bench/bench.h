@@ -0,0 +1,171 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace vkb
+{
+namespace bench
+{
+/**
+ * @brief Timing state of one run of a benchmark case
+ *
+ * A case sets up its data, then loops on keep_running. Only the iterations of that loop are timed.
+ */
+class State
+{
+  public:
+	explicit State(uint64_t iterations);
+
+	/**
+	 * @return True while the case has to run one more iteration, the clock starts on the first call
+	 */
+	bool keep_running();
+
+	/**
+	 * @brief Stops the clock, for work of an iteration that is not part of the measurement (e.g. restoring the input)
+	 */
+	void pause_timing();
+
+	void resume_timing();
+
+	/**
+	 * @brief Sets the number of items one iteration processes, so that the case also reports a throughput
+	 */
+	void set_items_per_iteration(uint64_t items);
+
+	uint64_t get_iterations() const;
+
+	uint64_t get_items_per_iteration() const;
+
+	std::chrono::nanoseconds get_elapsed() const;
+
+  private:
+	using Clock = std::chrono::steady_clock;
+
+	uint64_t          iterations;
+	uint64_t          remaining;
+	uint64_t          items_per_iteration = 0;
+	bool              started             = false;
+	bool              running             = false;
+	Clock::time_point start;
+	Clock::duration   elapsed{0};
+};
+
+struct Result
+{
+	std::string name;
+	uint64_t    iterations;
+	double      ns_per_iteration;
+	double      items_per_second;        // Zero for cases that do not count items
+};
+
+using Function = std::function<void(State &)>;
+
+/**
+ * @brief Runs the registered cases, growing their iteration count until each run lasts at least a minimum time
+ */
+class Runner
+{
+  public:
+	explicit Runner(std::chrono::milliseconds min_time);
+
+	void add(std::string const &name, Function &&function);
+
+	/**
+	 * @brief Runs the cases whose name contains the filter, all of them if it is empty, and prints their results
+	 */
+	std::vector<Result> run(std::string const &filter) const;
+
+  private:
+	struct Case
+	{
+		std::string name;
+		Function    function;
+	};
+
+	std::chrono::milliseconds min_time;
+	std::vector<Case>         cases;
+};
+
+void write_json(std::vector<Result> const &results, std::string const &path);
+
+void write_csv(std::vector<Result> const &results, std::string const &path);
+
+/**
+ * @brief Deterministic source of test data, so that every run and every platform measures the same dataset
+ *
+ * Values are derived from the raw output of std::mt19937, which the standard fully specifies, instead of the
+ * implementation-defined standard distributions.
+ */
+class Random
+{
+  public:
+	explicit Random(uint32_t seed);
+
+	/**
+	 * @return A value in [0, bound)
+	 */
+	uint32_t next_uint(uint32_t bound);
+
+	/**
+	 * @return A value in [min, max)
+	 */
+	float next_float(float min, float max);
+
+  private:
+	std::mt19937 engine;
+};
+
+/**
+ * @brief Defined in another translation unit, so that the optimizer has to assume the pointed memory is read
+ */
+void escape(void const *pointer);
+
+/**
+ * @brief Keeps the compiler from discarding a value that is only computed for the measurement
+ */
+template <typename T>
+inline void do_not_optimize(T const &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "g"(&value) : "memory");
+#else
+	escape(&value);
+#endif
+}
+
+void register_animation_benchmarks(Runner &runner);
+void register_buffer_pool_benchmarks(Runner &runner);
+void register_draw_list_benchmarks(Runner &runner);
+void register_frustum_culler_benchmarks(Runner &runner);
+void register_gltf_loader_benchmarks(Runner &runner);
+void register_image_benchmarks(Runner &runner);
+void register_job_system_benchmarks(Runner &runner);
+void register_light_clusters_benchmarks(Runner &runner);
+void register_resource_caching_benchmarks(Runner &runner);
+void register_spirv_reflection_benchmarks(Runner &runner);
+void register_transform_benchmarks(Runner &runner);
+}        // namespace bench
+}        // namespace vkb
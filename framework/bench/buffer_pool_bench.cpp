@@ -0,0 +1,214 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench.h"
+
+#include <stdexcept>
+
+#include <vk_mem_alloc.h>
+
+#include "common/tlsf_allocator.h"
+
+namespace vkb
+{
+namespace bench
+{
+namespace
+{
+// BufferBlock allocates from a Vulkan buffer, so these cases run its allocators on their own over the same
+// offset arithmetic: the aligned bump of a linear block, and the TLSFAllocator of a free-list block. Creating a
+// buffer per allocation with VMA needs a device, so the churn is compared against a VMA virtual block instead, which
+// runs the same allocation algorithm as VMA without the vkAllocateMemory and vkCreateBuffer calls
+
+constexpr uint32_t BLOCK_SIZE = 64 * 1024 * 1024;
+constexpr uint32_t ALIGNMENT  = 256;        // minUniformBufferOffsetAlignment of most desktop GPUs
+
+uint32_t align(uint32_t size)
+{
+	return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+/**
+ * @brief The per-draw uniform allocations of a frame, as made from the linear blocks of a RenderFrame
+ */
+std::vector<uint32_t> create_frame_sizes()
+{
+	std::vector<uint32_t> sizes(4096);
+	Random                random{5};
+	for (auto &size : sizes)
+	{
+		size = 64 + 16 * random.next_uint(60);
+	}
+	return sizes;
+}
+
+void linear_frame(State &state)
+{
+	auto sizes = create_frame_sizes();
+
+	state.set_items_per_iteration(sizes.size());
+	while (state.keep_running())
+	{
+		// Same arithmetic as BufferBlock::allocate and BufferBlock::reset for a linear block
+		uint32_t offset = 0;
+		for (auto size : sizes)
+		{
+			uint32_t aligned = align(offset);
+			if (BLOCK_SIZE < aligned + size)
+			{
+				throw std::runtime_error("Linear block too small for the frame");
+			}
+			offset = aligned + size;
+			do_not_optimize(aligned);
+		}
+		do_not_optimize(offset);
+	}
+}
+
+void free_list_frame(State &state)
+{
+	auto sizes = create_frame_sizes();
+
+	TLSFAllocator allocator{BLOCK_SIZE, static_cast<uint32_t>(sizes.size())};
+
+	state.set_items_per_iteration(sizes.size());
+	while (state.keep_running())
+	{
+		// The frame of linear_frame made from a free-list block, which rounds the sizes up to the alignment
+		for (auto size : sizes)
+		{
+			auto allocation = allocator.allocate(align(size));
+			if (allocation.node == TLSFAllocator::INVALID_NODE)
+			{
+				throw std::runtime_error("Free-list block too small for the frame");
+			}
+			do_not_optimize(allocation.offset);
+		}
+		allocator.reset();
+	}
+}
+
+/**
+ * @brief Mesh buffers streamed in and out of a block, with about a quarter of it live at any time
+ */
+struct Churn
+{
+	static constexpr uint32_t LIVE_COUNT      = 2048;
+	static constexpr uint32_t OPERATION_COUNT = 1024;
+
+	std::vector<uint32_t> sizes;          // The sizes of the initial allocations, then of the replacing ones
+	std::vector<uint32_t> victims;        // The live allocation each operation replaces
+
+	Churn() :
+	    sizes(LIVE_COUNT + OPERATION_COUNT), victims(OPERATION_COUNT)
+	{
+		Random random{55};
+		for (auto &size : sizes)
+		{
+			size = align(256 + random.next_uint(16 * 1024));
+		}
+		for (auto &victim : victims)
+		{
+			victim = random.next_uint(LIVE_COUNT);
+		}
+	}
+};
+
+void free_list_churn(State &state)
+{
+	Churn churn;
+
+	TLSFAllocator                          allocator{BLOCK_SIZE, Churn::LIVE_COUNT};
+	std::vector<TLSFAllocator::Allocation> live(Churn::LIVE_COUNT);
+	for (uint32_t i = 0; i < Churn::LIVE_COUNT; ++i)
+	{
+		live[i] = allocator.allocate(churn.sizes[i]);
+	}
+
+	state.set_items_per_iteration(Churn::OPERATION_COUNT);
+	while (state.keep_running())
+	{
+		for (uint32_t i = 0; i < Churn::OPERATION_COUNT; ++i)
+		{
+			auto &allocation = live[churn.victims[i]];
+			allocator.free(allocation);
+			allocation = allocator.allocate(churn.sizes[Churn::LIVE_COUNT + i]);
+			if (allocation.node == TLSFAllocator::INVALID_NODE)
+			{
+				throw std::runtime_error("Free-list block too small for the live allocations");
+			}
+		}
+	}
+}
+
+void vma_virtual_churn(State &state)
+{
+	Churn churn;
+
+	VmaVirtualBlockCreateInfo block_info{};
+	block_info.size = BLOCK_SIZE;
+
+	VmaVirtualBlock block;
+	if (vmaCreateVirtualBlock(&block_info, &block) != VK_SUCCESS)
+	{
+		throw std::runtime_error("Cannot create the VMA virtual block");
+	}
+
+	auto allocate = [&block](uint32_t size) {
+		VmaVirtualAllocationCreateInfo allocation_info{};
+		allocation_info.size      = size;
+		allocation_info.alignment = ALIGNMENT;
+
+		VmaVirtualAllocation allocation;
+		if (vmaVirtualAllocate(block, &allocation_info, &allocation, nullptr) != VK_SUCCESS)
+		{
+			throw std::runtime_error("VMA virtual block too small for the live allocations");
+		}
+		return allocation;
+	};
+
+	std::vector<VmaVirtualAllocation> live(Churn::LIVE_COUNT);
+	for (uint32_t i = 0; i < Churn::LIVE_COUNT; ++i)
+	{
+		live[i] = allocate(churn.sizes[i]);
+	}
+
+	state.set_items_per_iteration(Churn::OPERATION_COUNT);
+	while (state.keep_running())
+	{
+		for (uint32_t i = 0; i < Churn::OPERATION_COUNT; ++i)
+		{
+			auto &allocation = live[churn.victims[i]];
+			vmaVirtualFree(block, allocation);
+			allocation = allocate(churn.sizes[Churn::LIVE_COUNT + i]);
+		}
+	}
+
+	vmaClearVirtualBlock(block);
+	vmaDestroyVirtualBlock(block);
+}
+}        // namespace
+
+void register_buffer_pool_benchmarks(Runner &runner)
+{
+	runner.add("buffer_block/linear_frame_4k_allocations", linear_frame);
+	runner.add("buffer_block/free_list_frame_4k_allocations", free_list_frame);
+	runner.add("buffer_block/free_list_churn", free_list_churn);
+	runner.add("buffer_block/vma_virtual_churn", vma_virtual_churn);
+}
+}        // namespace bench
+}        // namespace vkb
@@ -0,0 +1,126 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench.h"
+
+#include <algorithm>
+
+#include "rendering/draw_list.h"
+
+namespace vkb
+{
+namespace bench
+{
+namespace
+{
+constexpr uint32_t DRAW_COUNT = 10000;
+
+/**
+ * @brief The draws of a large scene: a few pipeline states, a hundred materials and a thousand meshes
+ */
+struct Draw
+{
+	float    distance;
+	uint64_t state_id;
+	uint64_t material_id;
+	uint64_t mesh_id;
+};
+
+std::vector<Draw> create_draws()
+{
+	std::vector<Draw> draws(DRAW_COUNT);
+	Random            random{12};
+	for (auto &draw : draws)
+	{
+		draw = {random.next_float(0.1f, 500.0f), random.next_uint(8), random.next_uint(100), random.next_uint(1000)};
+	}
+	return draws;
+}
+
+void make_keys(State &state)
+{
+	auto                  draws = create_draws();
+	std::vector<uint64_t> keys(draws.size());
+
+	state.set_items_per_iteration(draws.size());
+	while (state.keep_running())
+	{
+		for (size_t i = 0; i < draws.size(); ++i)
+		{
+			keys[i] = vkb::rendering::make_draw_sort_key(vkb::rendering::DrawOrder::StateMinimizing,
+			                                             draws[i].distance, draws[i].state_id, draws[i].material_id, draws[i].mesh_id);
+		}
+		do_not_optimize(keys.data());
+	}
+}
+
+void sort_draws(State &state, vkb::rendering::DrawOrder order)
+{
+	auto                                draws = create_draws();
+	vkb::rendering::DrawList<uint32_t> draw_list;
+
+	state.set_items_per_iteration(draws.size());
+	while (state.keep_running())
+	{
+		state.pause_timing();
+		draw_list.clear();
+		for (uint32_t i = 0; i < draws.size(); ++i)
+		{
+			draw_list.add(vkb::rendering::make_draw_sort_key(order, draws[i].distance, draws[i].state_id, draws[i].material_id, draws[i].mesh_id), i);
+		}
+		state.resume_timing();
+
+		draw_list.sort();
+		do_not_optimize(draw_list[0]);
+	}
+}
+
+void stable_sort_draws(State &state, vkb::rendering::DrawOrder order)
+{
+	// The entries DrawList::sort radix sorts, ordered with the comparison sort it replaced
+	auto                                       draws = create_draws();
+	std::vector<vkb::rendering::DrawSortEntry> unsorted(draws.size());
+	for (uint32_t i = 0; i < draws.size(); ++i)
+	{
+		unsorted[i] = {vkb::rendering::make_draw_sort_key(order, draws[i].distance, draws[i].state_id, draws[i].material_id, draws[i].mesh_id), i};
+	}
+
+	std::vector<vkb::rendering::DrawSortEntry> entries;
+
+	state.set_items_per_iteration(draws.size());
+	while (state.keep_running())
+	{
+		state.pause_timing();
+		entries = unsorted;
+		state.resume_timing();
+
+		std::stable_sort(entries.begin(), entries.end(), [](auto const &lhs, auto const &rhs) { return lhs.key < rhs.key; });
+		do_not_optimize(entries.data());
+	}
+}
+}        // namespace
+
+void register_draw_list_benchmarks(Runner &runner)
+{
+	runner.add("draw_list/make_keys_10k", make_keys);
+	runner.add("draw_list/sort_10k_state_minimizing", [](State &state) { sort_draws(state, vkb::rendering::DrawOrder::StateMinimizing); });
+	runner.add("draw_list/sort_10k_back_to_front", [](State &state) { sort_draws(state, vkb::rendering::DrawOrder::BackToFront); });
+	runner.add("draw_list/stable_sort_10k_state_minimizing", [](State &state) { stable_sort_draws(state, vkb::rendering::DrawOrder::StateMinimizing); });
+	runner.add("draw_list/stable_sort_10k_back_to_front", [](State &state) { stable_sort_draws(state, vkb::rendering::DrawOrder::BackToFront); });
+}
+}        // namespace bench
+}        // namespace vkb
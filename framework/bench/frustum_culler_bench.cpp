@@ -0,0 +1,120 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench.h"
+
+#include "geometry/frustum_culler.h"
+
+namespace vkb
+{
+namespace bench
+{
+namespace
+{
+constexpr uint32_t BOX_COUNT = 16384;
+
+/**
+ * @brief Mesh instances spread around a camera at the origin looking down -z, about a sixth of them in view
+ */
+struct CullScene
+{
+	std::vector<glm::vec3> centers;
+	std::vector<glm::vec3> extents;
+	Frustum                frustum;
+
+	CullScene() :
+	    centers(BOX_COUNT), extents(BOX_COUNT)
+	{
+		Random random{13};
+		for (uint32_t i = 0; i < BOX_COUNT; ++i)
+		{
+			centers[i] = {random.next_float(-200.0f, 200.0f), random.next_float(-20.0f, 20.0f), random.next_float(-200.0f, 200.0f)};
+			extents[i] = glm::vec3{random.next_float(0.2f, 4.0f)};
+		}
+
+		frustum.update(glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 250.0f));
+	}
+};
+
+void cull(State &state, bool allow_parallel)
+{
+	CullScene     scene;
+	FrustumCuller culler;
+	for (uint32_t i = 0; i < BOX_COUNT; ++i)
+	{
+		culler.add(scene.centers[i] - scene.extents[i], scene.centers[i] + scene.extents[i], glm::mat4{1.0f});
+	}
+
+	state.set_items_per_iteration(BOX_COUNT);
+	while (state.keep_running())
+	{
+		do_not_optimize(culler.cull(scene.frustum, allow_parallel));
+	}
+}
+
+void cull_scalar_aos(State &state)
+{
+	// The same test box by box on interleaved bounds, leaving the planes as soon as one rejects the box
+	struct Box
+	{
+		glm::vec3 center;
+		glm::vec3 extent;
+	};
+
+	CullScene        scene;
+	std::vector<Box> boxes(BOX_COUNT);
+	for (uint32_t i = 0; i < BOX_COUNT; ++i)
+	{
+		boxes[i] = {scene.centers[i], scene.extents[i]};
+	}
+	std::vector<uint8_t> visible(BOX_COUNT);
+
+	auto const &planes = scene.frustum.get_planes();
+
+	state.set_items_per_iteration(BOX_COUNT);
+	while (state.keep_running())
+	{
+		size_t visible_count = 0;
+		for (size_t i = 0; i < boxes.size(); ++i)
+		{
+			bool outside = false;
+			for (auto const &plane : planes)
+			{
+				float distance = glm::dot(glm::vec3(plane), boxes[i].center) + plane.w;
+				float radius   = glm::dot(glm::abs(glm::vec3(plane)), boxes[i].extent);
+				if (distance + radius <= 0.0f)
+				{
+					outside = true;
+					break;
+				}
+			}
+			visible[i] = !outside;
+			visible_count += visible[i];
+		}
+		do_not_optimize(visible_count);
+	}
+}
+}        // namespace
+
+void register_frustum_culler_benchmarks(Runner &runner)
+{
+	runner.add("frustum_culler/cull_16k_simd", [](State &state) { cull(state, false); });
+	runner.add("frustum_culler/cull_16k_simd_parallel", [](State &state) { cull(state, true); });
+	runner.add("frustum_culler/cull_16k_scalar_aos", cull_scalar_aos);
+}
+}        // namespace bench
+}        // namespace vkb
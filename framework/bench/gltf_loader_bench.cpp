@@ -0,0 +1,112 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench.h"
+
+#include "gltf_loader.h"
+
+namespace vkb
+{
+namespace bench
+{
+namespace
+{
+constexpr uint32_t VERTEX_COUNT = 65536;
+constexpr uint32_t INDEX_COUNT  = 3 * VERTEX_COUNT;
+
+enum AccessorId : uint32_t
+{
+	InterleavedPosition,        // vec3 position of an interleaved position, normal and uv vertex
+	PackedPosition,             // vec3 position of a tightly packed stream
+	Indices16,
+	Indices8
+};
+
+int add_buffer_view(tinygltf::Model &model, Random &random, size_t size, size_t stride)
+{
+	tinygltf::Buffer buffer;
+	buffer.data.resize(size);
+	for (auto &byte : buffer.data)
+	{
+		byte = static_cast<unsigned char>(random.next_uint(256));
+	}
+	model.buffers.push_back(std::move(buffer));
+
+	tinygltf::BufferView view;
+	view.buffer     = static_cast<int>(model.buffers.size() - 1);
+	view.byteLength = size;
+	view.byteStride = stride;
+	model.bufferViews.push_back(view);
+
+	return static_cast<int>(model.bufferViews.size() - 1);
+}
+
+void add_accessor(tinygltf::Model &model, int buffer_view, int component_type, int type, size_t count)
+{
+	tinygltf::Accessor accessor;
+	accessor.bufferView    = buffer_view;
+	accessor.componentType = component_type;
+	accessor.type          = type;
+	accessor.count         = count;
+	model.accessors.push_back(accessor);
+}
+
+/**
+ * @brief A mesh as tinygltf loads it, with an interleaved vertex stream, a packed one and two index streams
+ */
+tinygltf::Model create_model()
+{
+	tinygltf::Model model;
+	Random          random{20};
+
+	add_accessor(model, add_buffer_view(model, random, VERTEX_COUNT * 32, 32), TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3, VERTEX_COUNT);
+	add_accessor(model, add_buffer_view(model, random, VERTEX_COUNT * 12, 0), TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3, VERTEX_COUNT);
+	add_accessor(model, add_buffer_view(model, random, INDEX_COUNT * 2, 0), TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT, TINYGLTF_TYPE_SCALAR, INDEX_COUNT);
+	add_accessor(model, add_buffer_view(model, random, INDEX_COUNT, 0), TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE, TINYGLTF_TYPE_SCALAR, INDEX_COUNT);
+
+	return model;
+}
+
+/**
+ * @brief Copies an accessor to the layout of its vertex or index buffer, as the loader does into mapped memory
+ */
+void copy_accessor(State &state, AccessorId accessor, size_t dst_stride)
+{
+	auto model = create_model();
+	auto view  = get_accessor_view(&model, accessor);
+
+	std::vector<uint8_t> dst(view.count * dst_stride);
+
+	state.set_items_per_iteration(view.count);
+	while (state.keep_running())
+	{
+		view.copy_to(dst.data(), dst_stride);
+		do_not_optimize(dst.data());
+	}
+}
+}        // namespace
+
+void register_gltf_loader_benchmarks(Runner &runner)
+{
+	runner.add("gltf/copy_packed_vec3", [](State &state) { copy_accessor(state, PackedPosition, 12); });
+	runner.add("gltf/copy_interleaved_vec3", [](State &state) { copy_accessor(state, InterleavedPosition, 12); });
+	runner.add("gltf/copy_interleaved_vec3_to_vec4", [](State &state) { copy_accessor(state, InterleavedPosition, 16); });
+	runner.add("gltf/widen_indices_u16_to_u32", [](State &state) { copy_accessor(state, Indices16, 4); });
+	runner.add("gltf/widen_indices_u8_to_u16", [](State &state) { copy_accessor(state, Indices8, 2); });
+}
+}        // namespace bench
+}        // namespace vkb
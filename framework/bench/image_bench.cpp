@@ -0,0 +1,112 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench.h"
+
+#include <cstring>
+#include <optional>
+
+#include "scene_graph/components/hpp_image.h"
+#include "scene_graph/components/image.h"
+
+namespace vkb
+{
+namespace bench
+{
+namespace
+{
+constexpr uint32_t IMAGE_SIZE = 1024;
+
+/**
+ * @brief An image decoded in memory, as the image loaders produce it before generating the mipmaps
+ */
+class BenchImage : public vkb::sg::Image
+{
+  public:
+	BenchImage(std::vector<uint8_t> &&data, VkFormat format) :
+	    Image{"bench", std::move(data), {{0, 0, {IMAGE_SIZE, IMAGE_SIZE, 1}}}}
+	{
+		set_format(format);
+	}
+};
+
+/**
+ * @brief The same image through the C++ bindings, which share the box filter and convert the mipmaps back
+ */
+class BenchHPPImage : public vkb::scene_graph::components::HPPImage
+{
+  public:
+	BenchHPPImage(std::vector<uint8_t> &&data, vk::Format format) :
+	    HPPImage{"bench", std::move(data), {{0, 0, vk::Extent3D{IMAGE_SIZE, IMAGE_SIZE, 1}}}}
+	{
+		set_format(format);
+	}
+};
+
+std::vector<uint8_t> create_texels(uint32_t texel_size)
+{
+	std::vector<uint8_t> data(IMAGE_SIZE * IMAGE_SIZE * texel_size);
+	Random               random{18};
+	for (auto &byte : data)
+	{
+		byte = static_cast<uint8_t>(random.next_uint(256));
+	}
+
+	if (texel_size == 8)
+	{
+		// Random half floats are often NaN or infinite, replace them with values in [0.5, 1)
+		for (size_t i = 0; i < data.size(); i += 2)
+		{
+			uint16_t half = static_cast<uint16_t>(0x3800 | ((data[i] | (data[i + 1] << 8)) & 0x03ff));
+			std::memcpy(&data[i], &half, sizeof(half));
+		}
+	}
+
+	return data;
+}
+
+template <typename ImageType, typename FormatType>
+void generate_mipmaps(State &state, FormatType format, uint32_t texel_size)
+{
+	auto texels = create_texels(texel_size);
+
+	// Outside of the loop, so that the previous image is freed while the clock is stopped
+	std::optional<ImageType> image;
+
+	state.set_items_per_iteration(IMAGE_SIZE * IMAGE_SIZE);
+	while (state.keep_running())
+	{
+		state.pause_timing();
+		image.emplace(std::vector<uint8_t>{texels}, format);
+		state.resume_timing();
+
+		image->generate_mipmaps();
+		do_not_optimize(image->get_data().data());
+	}
+}
+}        // namespace
+
+void register_image_benchmarks(Runner &runner)
+{
+	runner.add("image/generate_mipmaps_rgba8_unorm_1024", [](State &state) { generate_mipmaps<BenchImage>(state, VK_FORMAT_R8G8B8A8_UNORM, 4); });
+	runner.add("image/generate_mipmaps_rgba8_srgb_1024", [](State &state) { generate_mipmaps<BenchImage>(state, VK_FORMAT_R8G8B8A8_SRGB, 4); });
+	runner.add("image/generate_mipmaps_rgba16f_1024", [](State &state) { generate_mipmaps<BenchImage>(state, VK_FORMAT_R16G16B16A16_SFLOAT, 8); });
+	runner.add("image/generate_mipmaps_hpp_rgba8_unorm_1024", [](State &state) { generate_mipmaps<BenchHPPImage>(state, vk::Format::eR8G8B8A8Unorm, 4); });
+	runner.add("image/generate_mipmaps_hpp_rgba8_srgb_1024", [](State &state) { generate_mipmaps<BenchHPPImage>(state, vk::Format::eR8G8B8A8Srgb, 4); });
+}
+}        // namespace bench
+}        // namespace vkb
@@ -0,0 +1,127 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench.h"
+
+#include <array>
+
+#include "common/job_system.h"
+
+namespace vkb
+{
+namespace bench
+{
+namespace
+{
+constexpr size_t POINT_COUNT = 256 * 1024;
+constexpr size_t GRAIN_SIZE  = 4096;
+
+/**
+ * @brief Points transformed by one of a few matrices, a CPU pass of the size of a mesh skinned or culled per frame
+ */
+struct PointBatch
+{
+	std::vector<std::array<float, 16>> matrices;
+	std::vector<uint32_t>              matrix_indices;
+	std::vector<float>                 src;        // xyz per point
+	std::vector<float>                 dst;
+
+	PointBatch() :
+	    matrices(64), matrix_indices(POINT_COUNT), src(3 * POINT_COUNT), dst(3 * POINT_COUNT)
+	{
+		Random random{11};
+		for (auto &matrix : matrices)
+		{
+			for (auto &element : matrix)
+			{
+				element = random.next_float(-1.0f, 1.0f);
+			}
+		}
+		for (auto &matrix_index : matrix_indices)
+		{
+			matrix_index = random.next_uint(static_cast<uint32_t>(matrices.size()));
+		}
+		for (auto &coordinate : src)
+		{
+			coordinate = random.next_float(-10.0f, 10.0f);
+		}
+	}
+
+	void transform(size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			auto const &m = matrices[matrix_indices[i]];
+			float       x = src[3 * i + 0];
+			float       y = src[3 * i + 1];
+			float       z = src[3 * i + 2];
+
+			dst[3 * i + 0] = m[0] * x + m[4] * y + m[8] * z + m[12];
+			dst[3 * i + 1] = m[1] * x + m[5] * y + m[9] * z + m[13];
+			dst[3 * i + 2] = m[2] * x + m[6] * y + m[10] * z + m[14];
+		}
+	}
+};
+
+void transform_serial(State &state)
+{
+	PointBatch batch;
+
+	state.set_items_per_iteration(POINT_COUNT);
+	while (state.keep_running())
+	{
+		batch.transform(0, POINT_COUNT);
+		do_not_optimize(batch.dst.data());
+	}
+}
+
+void transform_parallel(State &state)
+{
+	PointBatch batch;
+	auto      &job_system = JobSystem::get();
+
+	state.set_items_per_iteration(POINT_COUNT);
+	while (state.keep_running())
+	{
+		job_system.parallel_for(POINT_COUNT, GRAIN_SIZE, [&batch](size_t begin, size_t end) { batch.transform(begin, end); });
+		do_not_optimize(batch.dst.data());
+	}
+}
+
+void dispatch_empty_chunks(State &state)
+{
+	// The cost of queuing, stealing and waiting for the chunks alone
+	constexpr size_t CHUNK_COUNT = 64;
+
+	auto &job_system = JobSystem::get();
+
+	state.set_items_per_iteration(CHUNK_COUNT);
+	while (state.keep_running())
+	{
+		job_system.parallel_for(CHUNK_COUNT, 1, [](size_t begin, size_t end) { do_not_optimize(begin + end); });
+	}
+}
+}        // namespace
+
+void register_job_system_benchmarks(Runner &runner)
+{
+	runner.add("job_system/transform_256k_points_serial", transform_serial);
+	runner.add("job_system/transform_256k_points_parallel_for", transform_parallel);
+	runner.add("job_system/parallel_for_64_empty_chunks", dispatch_empty_chunks);
+}
+}        // namespace bench
+}        // namespace vkb
@@ -0,0 +1,71 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench.h"
+
+#include "rendering/light_clusters.h"
+#include "rendering/subpass.h"
+
+namespace vkb
+{
+namespace bench
+{
+namespace
+{
+constexpr uint32_t LIGHT_COUNT = 1024;
+
+/**
+ * @brief Point lights scattered in front of a camera at the origin looking down -z, as a 1080p frame of a large
+ *        scene would bin them
+ */
+std::vector<glm::vec4> create_lights()
+{
+	std::vector<glm::vec4> lights(LIGHT_COUNT);
+	Random                 random{24};
+	for (auto &light : lights)
+	{
+		light = {random.next_float(-50.0f, 50.0f), random.next_float(-10.0f, 20.0f), random.next_float(-100.0f, 0.0f), random.next_float(1.0f, 8.0f)};
+	}
+	return lights;
+}
+
+void bin_lights(State &state, bool allow_parallel)
+{
+	auto lights = create_lights();
+
+	// The grid bounds are computed once here, as for a static camera
+	vkb::rendering::LightClusters clusters;
+	clusters.update(glm::mat4{1.0f},
+	                vkb::rendering::vulkan_style_projection(glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f)),
+	                {1920, 1080});
+
+	state.set_items_per_iteration(lights.size());
+	while (state.keep_running())
+	{
+		clusters.bin(lights, allow_parallel);
+		do_not_optimize(clusters.get_light_indices().data());
+	}
+}
+}        // namespace
+
+void register_light_clusters_benchmarks(Runner &runner)
+{
+	runner.add("light_clusters/bin_1024_serial", [](State &state) { bin_lights(state, false); });
+	runner.add("light_clusters/bin_1024_parallel", [](State &state) { bin_lights(state, true); });
+}
+}        // namespace bench
+}        // namespace vkb
@@ -0,0 +1,126 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <string>
+
+#include <filesystem/filesystem.hpp>
+#include <fmt/format.h>
+
+#include "bench.h"
+
+namespace
+{
+constexpr const char *USAGE =
+    "Usage: vkb_framework_bench [options]\n"
+    "\n"
+    "Runs the CPU benchmarks of the framework on fixed datasets, no Vulkan device is needed.\n"
+    "Run it from the root of the repository, so that the shaders can be found.\n"
+    "\n"
+    "Options:\n"
+    "  --filter <text>     Only run the benchmarks whose name contains <text>\n"
+    "  --min-time <ms>     Minimum measured time of each benchmark, 500 by default\n"
+    "  --json <path>       Also write the results to a JSON file\n"
+    "  --csv <path>        Also write the results to a CSV file\n"
+    "  --help              Show this message\n";
+}        // namespace
+
+int main(int argc, char *argv[])
+{
+	std::string filter;
+	std::string json_path;
+	std::string csv_path;
+	long        min_time_ms = 500;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--help")
+		{
+			fmt::print("{}", USAGE);
+			return EXIT_SUCCESS;
+		}
+
+		if (i + 1 == argc)
+		{
+			fmt::print(stderr, "Missing value or unknown option: {}\n\n{}", arg, USAGE);
+			return EXIT_FAILURE;
+		}
+
+		std::string value = argv[++i];
+		if (arg == "--filter")
+		{
+			filter = value;
+		}
+		else if (arg == "--min-time")
+		{
+			min_time_ms = std::strtol(value.c_str(), nullptr, 10);
+		}
+		else if (arg == "--json")
+		{
+			json_path = value;
+		}
+		else if (arg == "--csv")
+		{
+			csv_path = value;
+		}
+		else
+		{
+			fmt::print(stderr, "Unknown option: {}\n\n{}", arg, USAGE);
+			return EXIT_FAILURE;
+		}
+	}
+
+	try
+	{
+		vkb::filesystem::init();
+
+		vkb::bench::Runner runner{std::chrono::milliseconds{std::max(min_time_ms, 1L)}};
+		vkb::bench::register_animation_benchmarks(runner);
+		vkb::bench::register_buffer_pool_benchmarks(runner);
+		vkb::bench::register_draw_list_benchmarks(runner);
+		vkb::bench::register_frustum_culler_benchmarks(runner);
+		vkb::bench::register_gltf_loader_benchmarks(runner);
+		vkb::bench::register_image_benchmarks(runner);
+		vkb::bench::register_job_system_benchmarks(runner);
+		vkb::bench::register_light_clusters_benchmarks(runner);
+		vkb::bench::register_resource_caching_benchmarks(runner);
+		vkb::bench::register_spirv_reflection_benchmarks(runner);
+		vkb::bench::register_transform_benchmarks(runner);
+
+		auto results = runner.run(filter);
+
+		if (!json_path.empty())
+		{
+			vkb::bench::write_json(results, json_path);
+		}
+		if (!csv_path.empty())
+		{
+			vkb::bench::write_csv(results, csv_path);
+		}
+	}
+	catch (std::exception const &e)
+	{
+		fmt::print(stderr, "Benchmark failed: {}\n", e.what());
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,275 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench.h"
+
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+#include "common/resource_caching.h"
+
+namespace vkb
+{
+namespace bench
+{
+namespace
+{
+constexpr uint32_t CACHED_COUNT       = 1024;
+constexpr uint32_t THREAD_COUNT       = 8;
+constexpr uint32_t LOOKUPS_PER_THREAD = 16384;
+
+// The attachments of a deferred G-buffer pass, with its lighting subpass
+struct RenderPassKey
+{
+	std::vector<vkb::rendering::AttachmentC> attachments{
+	    {VK_FORMAT_B8G8R8A8_SRGB, VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT},
+	    {VK_FORMAT_D32_SFLOAT, VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT},
+	    {VK_FORMAT_R8G8B8A8_UNORM, VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT},
+	    {VK_FORMAT_A2B10G10R10_UNORM_PACK32, VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT}};
+	std::vector<LoadStoreInfo> load_store_infos{
+	    {VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_STORE},
+	    {VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_DONT_CARE},
+	    {VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_DONT_CARE},
+	    {VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_DONT_CARE}};
+	std::vector<SubpassInfo> subpasses{
+	    {{}, {1, 2, 3}, {}, false, 0, VK_RESOLVE_MODE_NONE, "G-buffer"},
+	    {{1, 2, 3}, {0}, {}, true, 0, VK_RESOLVE_MODE_NONE, "Lighting"}};
+};
+
+// The resources of a PBR fragment shader, as reflected for its descriptor set layout
+std::vector<ShaderResource> create_shader_resources()
+{
+	std::vector<ShaderResource> resources;
+	for (uint32_t binding = 0; binding < 12; ++binding)
+	{
+		ShaderResource resource{};
+		resource.stages     = VK_SHADER_STAGE_FRAGMENT_BIT;
+		resource.type       = binding < 2 ? ShaderResourceType::BufferUniform : ShaderResourceType::ImageSampler;
+		resource.mode       = ShaderResourceMode::Static;
+		resource.set        = 0;
+		resource.binding    = binding;
+		resource.array_size = 1;
+		resource.name       = "resource_" + std::to_string(binding);
+		resources.push_back(resource);
+	}
+	return resources;
+}
+
+// The state of an opaque PBR draw with an interleaved vertex layout and three color attachments
+PipelineState create_pipeline_state()
+{
+	VertexInputState vertex_input_state;
+	vertex_input_state.bindings   = {{0, 32, VK_VERTEX_INPUT_RATE_VERTEX}, {1, 16, VK_VERTEX_INPUT_RATE_VERTEX}};
+	vertex_input_state.attributes = {{0, 0, VK_FORMAT_R32G32B32_SFLOAT, 0},
+	                                 {1, 0, VK_FORMAT_R32G32B32_SFLOAT, 12},
+	                                 {2, 0, VK_FORMAT_R32G32_SFLOAT, 24},
+	                                 {3, 1, VK_FORMAT_R32G32B32A32_SFLOAT, 0}};
+
+	ColorBlendState color_blend_state;
+	color_blend_state.attachments.resize(3);
+
+	PipelineState pipeline_state;
+	pipeline_state.set_vertex_input_state(vertex_input_state);
+	pipeline_state.set_color_blend_state(color_blend_state);
+	pipeline_state.set_subpass_index(0);
+	return pipeline_state;
+}
+
+// A material descriptor set: the per-draw uniform buffer and five textures
+struct DescriptorSetKey
+{
+	VkDescriptorSetLayout              layout = reinterpret_cast<VkDescriptorSetLayout>(uintptr_t{0x1000});
+	BindingMap<VkDescriptorBufferInfo> buffer_infos;
+	BindingMap<VkDescriptorImageInfo>  image_infos;
+
+	DescriptorSetKey()
+	{
+		buffer_infos[0][0] = {reinterpret_cast<VkBuffer>(uintptr_t{0x2000}), 256, 192};
+		for (uint32_t binding = 1; binding < 6; ++binding)
+		{
+			image_infos[binding][0] = {reinterpret_cast<VkSampler>(uintptr_t{0x3000}),
+			                           reinterpret_cast<VkImageView>(uintptr_t{0x4000 + binding}),
+			                           VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+		}
+	}
+};
+
+/**
+ * @brief A cache holding every requested resource, as after the first frames of a sample, with the keys each thread
+ *        requests. The resources stand in for pipelines, only the lookup is measured.
+ */
+struct CacheHits
+{
+	std::unordered_map<size_t, uint64_t> resources;
+	std::vector<std::vector<uint64_t>>   requests;
+
+	CacheHits()
+	{
+		Random random{2};
+		for (uint64_t key = 0; key < CACHED_COUNT; ++key)
+		{
+			size_t hash = 0;
+			hash_param(hash, key);
+			resources.emplace(hash, key);
+		}
+
+		requests.resize(THREAD_COUNT);
+		for (auto &thread_requests : requests)
+		{
+			thread_requests.resize(LOOKUPS_PER_THREAD);
+			for (auto &key : thread_requests)
+			{
+				key = random.next_uint(CACHED_COUNT);
+			}
+		}
+	}
+};
+
+/**
+ * @brief Requests cached resources from several threads at once, each request hashing its key and looking it up
+ *        under the lock, as request_resource does on a hit
+ */
+template <class Mutex, class Lock>
+void request_cache_hits(State &state)
+{
+	CacheHits cache_hits;
+	Mutex     resource_mutex;
+
+	auto request = [&](std::vector<uint64_t> const &thread_requests) {
+		uint64_t sum = 0;
+		for (uint64_t key : thread_requests)
+		{
+			size_t hash = 0;
+			hash_param(hash, key);
+
+			Lock guard(resource_mutex);
+			if (auto resource = find_resource(cache_hits.resources, hash, key))
+			{
+				sum += *resource;
+			}
+		}
+		do_not_optimize(sum);
+	};
+
+	// The threads are started within the measurement, which costs the same with either lock
+	std::vector<std::thread> threads;
+	state.set_items_per_iteration(THREAD_COUNT * LOOKUPS_PER_THREAD);
+	while (state.keep_running())
+	{
+		for (auto &thread_requests : cache_hits.requests)
+		{
+			threads.emplace_back(request, std::cref(thread_requests));
+		}
+		for (auto &thread : threads)
+		{
+			thread.join();
+		}
+		threads.clear();
+	}
+}
+
+void hash_pipeline_state(State &state)
+{
+	auto pipeline_state = create_pipeline_state();
+
+	// std::hash<PipelineState> also needs a PipelineLayout, which needs a device, so the fixed-function states it
+	// combines are hashed here in the same order
+	while (state.keep_running())
+	{
+		size_t hash = 0;
+		hash_combine(hash, pipeline_state.get_vertex_input_state());
+		hash_combine(hash, pipeline_state.get_input_assembly_state());
+		hash_combine(hash, pipeline_state.get_viewport_state());
+		hash_combine(hash, pipeline_state.get_rasterization_state());
+		hash_combine(hash, pipeline_state.get_multisample_state());
+		hash_combine(hash, pipeline_state.get_depth_stencil_state());
+		hash_combine(hash, pipeline_state.get_color_blend_state());
+		do_not_optimize(hash);
+	}
+}
+
+void hash_descriptor_set_key(State &state)
+{
+	DescriptorSetKey key;
+
+	// The layout and the pool of request_descriptor_set both hash as the handle of the layout
+	while (state.keep_running())
+	{
+		size_t hash = 0;
+		hash_param(hash, key.layout, key.layout, key.buffer_infos, key.image_infos);
+		do_not_optimize(hash);
+	}
+}
+
+void hash_render_pass_key(State &state)
+{
+	RenderPassKey key;
+
+	while (state.keep_running())
+	{
+		size_t hash = 0;
+		hash_param(hash, key.attachments, key.load_store_infos, key.subpasses);
+		do_not_optimize(hash);
+	}
+}
+
+void hash_shader_resources(State &state)
+{
+	auto resources = create_shader_resources();
+
+	state.set_items_per_iteration(resources.size());
+	while (state.keep_running())
+	{
+		size_t hash = 0;
+		hash_param(hash, resources);
+		do_not_optimize(hash);
+	}
+}
+
+void hash_shader_source(State &state)
+{
+	// The size of a typical fragment shader source
+	std::vector<uint8_t> source(16 * 1024);
+	Random               random{16};
+	for (auto &byte : source)
+	{
+		byte = static_cast<uint8_t>(random.next_uint(256));
+	}
+
+	state.set_items_per_iteration(source.size());
+	while (state.keep_running())
+	{
+		size_t hash = 0;
+		hash_param(hash, source);
+		do_not_optimize(hash);
+	}
+}
+}        // namespace
+
+void register_resource_caching_benchmarks(Runner &runner)
+{
+	runner.add("resource_caching/hash_descriptor_set_key", hash_descriptor_set_key);
+	runner.add("resource_caching/hash_pipeline_state", hash_pipeline_state);
+	runner.add("resource_caching/hash_render_pass_key", hash_render_pass_key);
+	runner.add("resource_caching/hash_shader_resources", hash_shader_resources);
+	runner.add("resource_caching/hash_shader_source_16k", hash_shader_source);
+	runner.add("resource_caching/request_hits_8_threads_exclusive_lock", request_cache_hits<std::mutex, std::lock_guard<std::mutex>>);
+	runner.add("resource_caching/request_hits_8_threads_shared_lock", request_cache_hits<std::shared_mutex, std::shared_lock<std::shared_mutex>>);
+}
+}        // namespace bench
+}        // namespace vkb
@@ -0,0 +1,87 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench.h"
+
+#include <stdexcept>
+
+#include "filesystem/legacy.h"
+#include "spirv_reflection.h"
+
+namespace vkb
+{
+namespace bench
+{
+namespace
+{
+/**
+ * @brief Reflects one of the precompiled shaders of the repository with spirv-cross
+ */
+void reflect(State &state, std::string const &filename, VkShaderStageFlagBits stage)
+{
+	auto          spirv = vkb::fs::read_shader_binary_u32(filename);
+	ShaderVariant variant;
+
+	std::vector<ShaderResource> resources;
+	while (state.keep_running())
+	{
+		resources.clear();
+		SPIRVReflection{}.reflect_shader_resources(stage, spirv, resources, variant);
+		do_not_optimize(resources.data());
+	}
+}
+
+/**
+ * @brief Looks up the resources of the same shader in SPIRVReflectionCache, as ShaderModule does before reflecting
+ */
+void find_cached(State &state, std::string const &filename, VkShaderStageFlagBits stage)
+{
+	auto          spirv = vkb::fs::read_shader_binary_u32(filename);
+	ShaderVariant variant;
+
+	auto &cache = SPIRVReflectionCache::get();
+	auto  key   = SPIRVReflectionCache::get_key(stage, spirv, variant);
+
+	std::vector<ShaderResource> resources;
+	if (!cache.find(key, resources))
+	{
+		SPIRVReflection{}.reflect_shader_resources(stage, spirv, resources, variant);
+		cache.insert(key, resources);
+	}
+
+	// Hashing the SPIR-V is part of every lookup, so the key is computed within the loop
+	while (state.keep_running())
+	{
+		resources.clear();
+		if (!cache.find(SPIRVReflectionCache::get_key(stage, spirv, variant), resources))
+		{
+			throw std::runtime_error("Shader reflection missing from the cache");
+		}
+		do_not_optimize(resources.data());
+	}
+}
+}        // namespace
+
+void register_spirv_reflection_benchmarks(Runner &runner)
+{
+	runner.add("spirv_reflection/reflect_base_vert", [](State &state) { reflect(state, "base.vert.spv", VK_SHADER_STAGE_VERTEX_BIT); });
+	runner.add("spirv_reflection/reflect_base_frag", [](State &state) { reflect(state, "base.frag.spv", VK_SHADER_STAGE_FRAGMENT_BIT); });
+	runner.add("spirv_reflection/cache_hit_base_vert", [](State &state) { find_cached(state, "base.vert.spv", VK_SHADER_STAGE_VERTEX_BIT); });
+	runner.add("spirv_reflection/cache_hit_base_frag", [](State &state) { find_cached(state, "base.frag.spv", VK_SHADER_STAGE_FRAGMENT_BIT); });
+}
+}        // namespace bench
+}        // namespace vkb
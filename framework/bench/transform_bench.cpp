@@ -0,0 +1,131 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bench.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "scene_graph/components/transform.h"
+#include "scene_graph/node.h"
+#include "scene_graph/scene.h"
+#include "scene_graph/transform_hierarchy.h"
+
+namespace vkb
+{
+namespace bench
+{
+namespace
+{
+// Eight subtrees below the root, where every node down to the sixth level has four children: 10920 nodes
+constexpr uint32_t ROOT_CHILD_COUNT = 8;
+constexpr uint32_t CHILD_COUNT      = 4;
+constexpr uint32_t DEPTH            = 6;
+
+struct TransformScene
+{
+	std::unique_ptr<vkb::scene_graph::SceneC> scene;
+	std::vector<vkb::sg::Transform *>         transforms;        // All the transforms but the root's, in creation order
+	std::vector<glm::vec3>                    translations;
+};
+
+TransformScene create_scene()
+{
+	TransformScene transform_scene;
+	transform_scene.scene = std::make_unique<vkb::scene_graph::SceneC>("bench");
+
+	Random random{10};
+
+	std::vector<std::unique_ptr<vkb::scene_graph::NodeC>> nodes;
+	nodes.push_back(std::make_unique<vkb::scene_graph::NodeC>(0, "root"));
+
+	// Breadth-first, so that the first nodes are the shallowest
+	std::vector<std::pair<vkb::scene_graph::NodeC *, uint32_t>> parents{{nodes[0].get(), 0}};
+	for (size_t i = 0; i < parents.size(); ++i)
+	{
+		auto [parent, depth] = parents[i];
+		if (depth == DEPTH)
+		{
+			continue;
+		}
+
+		uint32_t child_count = depth == 0 ? ROOT_CHILD_COUNT : CHILD_COUNT;
+		for (uint32_t child = 0; child < child_count; ++child)
+		{
+			auto node = std::make_unique<vkb::scene_graph::NodeC>(nodes.size(), "node");
+			node->get_transform().set_translation_rotation_scale(
+			    {random.next_float(-1.0f, 1.0f), random.next_float(-1.0f, 1.0f), random.next_float(-1.0f, 1.0f)},
+			    glm::angleAxis(random.next_float(0.0f, 6.28f), glm::vec3{0.0f, 1.0f, 0.0f}),
+			    glm::vec3{random.next_float(0.5f, 2.0f)});
+			node->set_parent(*parent);
+			parent->add_child(*node);
+
+			parents.emplace_back(node.get(), depth + 1);
+			transform_scene.transforms.push_back(&node->get_transform());
+			transform_scene.translations.push_back(node->get_transform().get_translation() + glm::vec3{0.0f, 0.1f, 0.0f});
+			nodes.push_back(std::move(node));
+		}
+	}
+
+	auto &root = *nodes[0];
+	transform_scene.scene->set_nodes(std::move(nodes));
+	transform_scene.scene->set_root_node(root);
+
+	return transform_scene;
+}
+
+/**
+ * @brief Moves the given transforms, as an animation does, then reads every world matrix, as the draws do
+ */
+void update_world_matrices(State &state, bool use_hierarchy, size_t moved_count)
+{
+	auto transform_scene = create_scene();
+	if (use_hierarchy)
+	{
+		transform_scene.scene->build_transform_hierarchy();
+	}
+
+	auto &transforms   = transform_scene.transforms;
+	auto &translations = transform_scene.translations;
+
+	state.set_items_per_iteration(transforms.size());
+	while (state.keep_running())
+	{
+		for (size_t i = 0; i < std::min(moved_count, transforms.size()); ++i)
+		{
+			transforms[i]->set_translation(translations[i]);
+		}
+
+		for (auto transform : transforms)
+		{
+			do_not_optimize(transform->get_world_matrix());
+		}
+	}
+}
+}        // namespace
+
+void register_transform_benchmarks(Runner &runner)
+{
+	// The lazy walk only recomputes the transforms that were set themselves, so it is only compared on a full update
+	runner.add("transform/lazy_all_moved", [](State &state) { update_world_matrices(state, false, SIZE_MAX); });
+	runner.add("transform/hierarchy_all_moved", [](State &state) { update_world_matrices(state, true, SIZE_MAX); });
+
+	// The first root child and its whole subtree, an eighth of the scene
+	runner.add("transform/hierarchy_one_subtree_moved", [](State &state) { update_world_matrices(state, true, 1); });
+}
+}        // namespace bench
+}        // namespace vkb
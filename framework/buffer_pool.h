@@ -1,4 +1,4 @@
-/* Copyright (c) 2019-2025, Arm Limited and Contributors
+/* Copyright (c) 2019-2026, Arm Limited and Contributors
  * Copyright (c) 2024-2025, NVIDIA CORPORATION. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "common/helpers.h"
+#include "common/tlsf_allocator.h"
 #include "core/buffer.h"
 #include "core/device.h"
 
@@ -41,12 +42,17 @@ class BufferAllocation
 	BufferAllocation &operator=(const BufferAllocation &) = default;
 	BufferAllocation &operator=(BufferAllocation &&)      = default;
 
-	BufferAllocation(vkb::core::Buffer<bindingType> &buffer, DeviceSizeType size, DeviceSizeType offset);
+	BufferAllocation(vkb::core::Buffer<bindingType> &buffer, DeviceSizeType size, DeviceSizeType offset, uint32_t node = TLSFAllocator::INVALID_NODE);
 
 	bool                            empty() const;
 	vkb::core::Buffer<bindingType> &get_buffer();
-	DeviceSizeType                  get_offset() const;
-	DeviceSizeType                  get_size() const;
+
+	/**
+	 * @return The node identifying this allocation in a free-list BufferBlock, TLSFAllocator::INVALID_NODE for linear ones
+	 */
+	uint32_t       get_node() const;
+	DeviceSizeType get_offset() const;
+	DeviceSizeType get_size() const;
 	void                            update(const std::vector<uint8_t> &data, uint32_t offset = 0);
 	template <typename T>
 	void update(const T &value, uint32_t offset = 0);
@@ -55,23 +61,26 @@ class BufferAllocation
 	vkb::core::BufferCpp *buffer = nullptr;
 	vk::DeviceSize        offset = 0;
 	vk::DeviceSize        size   = 0;
+	uint32_t              node   = TLSFAllocator::INVALID_NODE;
 };
 
 using BufferAllocationC   = BufferAllocation<vkb::BindingType::C>;
 using BufferAllocationCpp = BufferAllocation<vkb::BindingType::Cpp>;
 
 template <>
-inline BufferAllocation<vkb::BindingType::Cpp>::BufferAllocation(vkb::core::BufferCpp &buffer, vk::DeviceSize size, vk::DeviceSize offset) :
+inline BufferAllocation<vkb::BindingType::Cpp>::BufferAllocation(vkb::core::BufferCpp &buffer, vk::DeviceSize size, vk::DeviceSize offset, uint32_t node) :
     buffer(&buffer),
     offset(offset),
-    size(size)
+    size(size),
+    node(node)
 {}
 
 template <>
-inline BufferAllocation<vkb::BindingType::C>::BufferAllocation(vkb::core::BufferC &buffer, VkDeviceSize size, VkDeviceSize offset) :
+inline BufferAllocation<vkb::BindingType::C>::BufferAllocation(vkb::core::BufferC &buffer, VkDeviceSize size, VkDeviceSize offset, uint32_t node) :
     buffer(reinterpret_cast<vkb::core::BufferCpp *>(&buffer)),
     offset(static_cast<vk::DeviceSize>(offset)),
-    size(static_cast<vk::DeviceSize>(size))
+    size(static_cast<vk::DeviceSize>(size)),
+    node(node)
 {}
 
 template <vkb::BindingType bindingType>
@@ -94,6 +103,12 @@ typename vkb::core::Buffer<bindingType> &BufferAllocation<bindingType>::get_buff
 	}
 }
 
+template <vkb::BindingType bindingType>
+uint32_t BufferAllocation<bindingType>::get_node() const
+{
+	return node;
+}
+
 template <vkb::BindingType bindingType>
 typename BufferAllocation<bindingType>::DeviceSizeType BufferAllocation<bindingType>::get_offset() const
 {
@@ -142,6 +157,15 @@ void BufferAllocation<bindingType>::update(const T &value, uint32_t offset)
 	update(to_bytes(value), offset);
 }
 
+/**
+ * @brief How a BufferBlock hands out ranges of its buffer
+ */
+enum class BufferBlockAllocator
+{
+	Linear,         // Bump allocation, ranges are only released all at once by reset(); suited to per-frame data
+	FreeList        // TLSF allocation, ranges can be freed individually; suited to long-lived data such as meshes
+};
+
 /**
  * @brief Helper class which handles multiple allocation from the same underlying Vulkan buffer.
  */
@@ -159,7 +183,11 @@ class BufferBlock
 	BufferBlock &operator=(BufferBlock const &rhs) = delete;
 	BufferBlock &operator=(BufferBlock &&rhs)      = default;
 
-	BufferBlock(vkb::core::Device<bindingType> &device, DeviceSizeType size, BufferUsageFlagsType usage, VmaMemoryUsage memory_usage);
+	BufferBlock(vkb::core::Device<bindingType> &device,
+	            DeviceSizeType                  size,
+	            BufferUsageFlagsType            usage,
+	            VmaMemoryUsage                  memory_usage,
+	            BufferBlockAllocator            allocator = BufferBlockAllocator::Linear);
 
 	/**
 	 * @return An usable view on a portion of the underlying buffer
@@ -173,8 +201,35 @@ class BufferBlock
 	 */
 	bool can_allocate(DeviceSizeType size) const;
 
+	/**
+	 * @brief Returns a range to a free-list BufferBlock, merging it with the free ranges around it
+	 * @param allocation An allocation from this block, it is emptied
+	 */
+	void free(BufferAllocation<bindingType> &allocation);
+
 	DeviceSizeType get_size() const;
-	void           reset();
+
+	/**
+	 * @brief Reports usage and fragmentation of the block
+	 *        For a linear block, the free space is the tail of the buffer and allocations are not counted
+	 */
+	TLSFAllocator::Statistics get_statistics() const;
+
+	/**
+	 * @return \c true if \a allocation was made from this \c BufferBlock
+	 */
+	bool owns(BufferAllocation<bindingType> &allocation) const;
+
+	/**
+	 * @brief Releases all the ranges of a linear block at once
+	 *        A free-list block is left untouched, as its ranges are long-lived and only returned with free()
+	 */
+	void reset();
+
+	/**
+	 * @return The alignment of the offsets of the allocations from a block with the given usage
+	 */
+	static vk::DeviceSize determine_alignment(vk::BufferUsageFlags usage, vk::PhysicalDeviceLimits const &limits);
 
   private:
 	/**
@@ -182,19 +237,23 @@ class BufferBlock
 	 * @return The current aligned offset.
 	 */
 	vk::DeviceSize aligned_offset() const;
-	vk::DeviceSize determine_alignment(vk::BufferUsageFlags usage, vk::PhysicalDeviceLimits const &limits) const;
 
   private:
-	vkb::core::BufferCpp buffer;
-	vk::DeviceSize       alignment = 0;        // Memory alignment, it may change according to the usage
-	vk::DeviceSize       offset    = 0;        // Current offset, it increases on every allocation
+	vk::DeviceSize aligned_size(vk::DeviceSize size) const;
+
+  private:
+	vkb::core::BufferCpp           buffer;
+	vk::DeviceSize                 alignment = 0;        // Memory alignment, it may change according to the usage
+	std::unique_ptr<TLSFAllocator> free_list;            // Allocator of a BufferBlockAllocator::FreeList block, null for a linear one
+	vk::DeviceSize                 offset = 0;           // Current offset, it increases on every allocation
 };
 
 using BufferBlockC   = BufferBlock<vkb::BindingType::C>;
 using BufferBlockCpp = BufferBlock<vkb::BindingType::Cpp>;
 
 template <vkb::BindingType bindingType>
-BufferBlock<bindingType>::BufferBlock(vkb::core::Device<bindingType> &device, DeviceSizeType size, BufferUsageFlagsType usage, VmaMemoryUsage memory_usage) :
+BufferBlock<bindingType>::BufferBlock(
+    vkb::core::Device<bindingType> &device, DeviceSizeType size, BufferUsageFlagsType usage, VmaMemoryUsage memory_usage, BufferBlockAllocator allocator) :
     buffer{device, size, usage, memory_usage}
 {
 	if constexpr (bindingType == BindingType::Cpp)
@@ -206,11 +265,40 @@ BufferBlock<bindingType>::BufferBlock(vkb::core::Device<bindingType> &device, De
 		alignment =
 		    determine_alignment(static_cast<vk::BufferUsageFlags>(usage), static_cast<vk::PhysicalDeviceLimits>(device.get_gpu().get_properties().limits));
 	}
+
+	if (allocator == BufferBlockAllocator::FreeList)
+	{
+		if (std::numeric_limits<uint32_t>::max() < size)
+		{
+			throw std::runtime_error("Free-list buffer blocks are limited to 4 GiB");
+		}
+
+		// All allocation sizes are rounded up to the alignment, which keeps every offset aligned
+		free_list = std::make_unique<TLSFAllocator>(to_u32(size & ~(alignment - 1)));
+	}
 }
 
 template <vkb::BindingType bindingType>
 BufferAllocation<bindingType> BufferBlock<bindingType>::allocate(DeviceSizeType size)
 {
+	if (free_list)
+	{
+		auto allocation = free_list->allocate(to_u32(aligned_size(size)));
+		if (allocation.node == TLSFAllocator::INVALID_NODE)
+		{
+			return BufferAllocation<bindingType>{};
+		}
+
+		if constexpr (bindingType == vkb::BindingType::Cpp)
+		{
+			return BufferAllocationCpp{buffer, size, allocation.offset, allocation.node};
+		}
+		else
+		{
+			return BufferAllocationC{reinterpret_cast<vkb::core::BufferC &>(buffer), size, allocation.offset, allocation.node};
+		}
+	}
+
 	if (can_allocate(size))
 	{
 		// Move the current offset and return an allocation
@@ -234,19 +322,58 @@ template <vkb::BindingType bindingType>
 bool BufferBlock<bindingType>::can_allocate(DeviceSizeType size) const
 {
 	assert(size > 0 && "Allocation size must be greater than zero");
+	if (free_list)
+	{
+		return aligned_size(size) <= std::numeric_limits<uint32_t>::max() && free_list->can_allocate(to_u32(aligned_size(size)));
+	}
 	return (aligned_offset() + size <= buffer.get_size());
 }
 
+template <vkb::BindingType bindingType>
+void BufferBlock<bindingType>::free(BufferAllocation<bindingType> &allocation)
+{
+	assert(free_list && "Only free-list buffer blocks can free individual allocations");
+	assert(owns(allocation) && allocation.get_node() != TLSFAllocator::INVALID_NODE && "Allocation does not belong to this buffer block");
+
+	free_list->free(TLSFAllocator::Allocation{to_u32(allocation.get_offset()), allocation.get_node()});
+	allocation = BufferAllocation<bindingType>{};
+}
+
 template <vkb::BindingType bindingType>
 typename BufferBlock<bindingType>::DeviceSizeType BufferBlock<bindingType>::get_size() const
 {
 	return buffer.get_size();
 }
 
+template <vkb::BindingType bindingType>
+TLSFAllocator::Statistics BufferBlock<bindingType>::get_statistics() const
+{
+	if (free_list)
+	{
+		return free_list->get_statistics();
+	}
+
+	TLSFAllocator::Statistics statistics;
+	statistics.size                = to_u32(buffer.get_size());
+	statistics.used                = to_u32(offset);
+	statistics.largest_free_region = statistics.size - statistics.used;
+	statistics.free_regions        = statistics.largest_free_region == 0 ? 0 : 1;
+	return statistics;
+}
+
+template <vkb::BindingType bindingType>
+bool BufferBlock<bindingType>::owns(BufferAllocation<bindingType> &allocation) const
+{
+	return !allocation.empty() && reinterpret_cast<vkb::core::BufferCpp const *>(&allocation.get_buffer()) == &buffer;
+}
+
 template <vkb::BindingType bindingType>
 void BufferBlock<bindingType>::reset()
 {
-	offset = 0;
+	if (!free_list)
+	{
+		offset = 0;
+	}
 }
 
 template <vkb::BindingType bindingType>
@@ -256,7 +383,13 @@ vk::DeviceSize BufferBlock<bindingType>::aligned_offset() const
 }
 
 template <vkb::BindingType bindingType>
-vk::DeviceSize BufferBlock<bindingType>::determine_alignment(vk::BufferUsageFlags usage, vk::PhysicalDeviceLimits const &limits) const
+vk::DeviceSize BufferBlock<bindingType>::aligned_size(vk::DeviceSize size) const
+{
+	return (size + alignment - 1) & ~(alignment - 1);
+}
+
+template <vkb::BindingType bindingType>
+vk::DeviceSize BufferBlock<bindingType>::determine_alignment(vk::BufferUsageFlags usage, vk::PhysicalDeviceLimits const &limits)
 {
 	if (usage == vk::BufferUsageFlagBits::eUniformBuffer)
 	{
@@ -295,6 +428,10 @@ vk::DeviceSize BufferBlock<bindingType>::determine_alignment(vk::BufferUsageFlag
  * overwritten. The minimum allocation size is 256 kb, if you ask for more you get a dedicated
  * buffer allocation.
  *
+ * With BufferBlockAllocator::FreeList, the blocks instead sub-allocate long-lived ranges that are
+ * returned individually with free(), so that many meshes or instance buffers can share a few
+ * VkBuffers instead of each needing its own.
+ *
  * We re-use descriptor sets: we only need one for the corresponding buffer infos (and we only
  * have one VkBuffer per BufferBlock), then it is bound and we use dynamic offsets.
  */
@@ -306,19 +443,47 @@ class BufferPool
 	using DeviceSizeType       = typename std::conditional<bindingType == vkb::BindingType::Cpp, vk::DeviceSize, VkDeviceSize>::type;
 
   public:
-	BufferPool(
-	    vkb::core::Device<bindingType> &device, DeviceSizeType block_size, BufferUsageFlagsType usage, VmaMemoryUsage memory_usage = VMA_MEMORY_USAGE_CPU_TO_GPU);
+	BufferPool(vkb::core::Device<bindingType> &device,
+	           DeviceSizeType                  block_size,
+	           BufferUsageFlagsType            usage,
+	           VmaMemoryUsage                  memory_usage = VMA_MEMORY_USAGE_CPU_TO_GPU,
+	           BufferBlockAllocator            allocator    = BufferBlockAllocator::Linear);
+
+	/**
+	 * @brief Allocates from the first block with enough space, creating a new block if there is none
+	 * @param size The number of bytes to allocate
+	 * @return The allocation, to be returned with free() if the pool uses BufferBlockAllocator::FreeList
+	 */
+	BufferAllocation<bindingType> allocate(DeviceSizeType size);
+
+	/**
+	 * @brief Returns an allocation of a BufferBlockAllocator::FreeList pool to the block it was made from
+	 * @param allocation The allocation to free, it is emptied
+	 */
+	void free(BufferAllocation<bindingType> &allocation);
+
+	/**
+	 * @brief Sums up the usage of all blocks, the largest free region is the largest over all blocks
+	 */
+	TLSFAllocator::Statistics get_statistics() const;
 
 	BufferBlock<bindingType> &request_buffer_block(DeviceSizeType minimum_size, bool minimal = false);
 
+	/**
+	 * @brief Resets the blocks of a BufferBlockAllocator::Linear pool, a free-list pool keeps its allocations
+	 */
 	void reset();
 
+  private:
+	BufferAllocationCpp allocate_impl(vk::DeviceSize size);
+
   private:
 	vkb::core::DeviceCpp                        &device;
 	std::vector<std::unique_ptr<BufferBlockCpp>> buffer_blocks;         /// List of blocks requested (need to be pointers in order to keep their address constant on vector resizing)
 	vk::DeviceSize                               block_size = 0;        /// Minimum size of the blocks
 	vk::BufferUsageFlags                         usage;
 	VmaMemoryUsage                               memory_usage{};
+	BufferBlockAllocator                         allocator;
 };
 
 using BufferPoolC   = BufferPool<vkb::BindingType::C>;
@@ -328,17 +493,81 @@ template <vkb::BindingType bindingType>
 BufferPool<bindingType>::BufferPool(vkb::core::Device<bindingType> &device,
                                     DeviceSizeType                  block_size,
                                     BufferUsageFlagsType            usage,
-                                    VmaMemoryUsage                  memory_usage) :
-    device{reinterpret_cast<vkb::core::DeviceCpp &>(device)}, block_size{block_size}, usage{usage}, memory_usage{memory_usage}
+                                    VmaMemoryUsage                  memory_usage,
+                                    BufferBlockAllocator            allocator) :
+    device{reinterpret_cast<vkb::core::DeviceCpp &>(device)}, block_size{block_size}, usage{usage}, memory_usage{memory_usage}, allocator{allocator}
 {
 }
 
+template <vkb::BindingType bindingType>
+BufferAllocation<bindingType> BufferPool<bindingType>::allocate(DeviceSizeType size)
+{
+	if constexpr (bindingType == vkb::BindingType::Cpp)
+	{
+		return allocate_impl(size);
+	}
+	else
+	{
+		BufferAllocationCpp allocation = allocate_impl(static_cast<vk::DeviceSize>(size));
+		return *reinterpret_cast<BufferAllocationC *>(&allocation);
+	}
+}
+
+template <vkb::BindingType bindingType>
+BufferAllocationCpp BufferPool<bindingType>::allocate_impl(vk::DeviceSize size)
+{
+	auto &buffer_block = reinterpret_cast<BufferBlockCpp &>(request_buffer_block(size));
+	return buffer_block.allocate(size);
+}
+
+template <vkb::BindingType bindingType>
+void BufferPool<bindingType>::free(BufferAllocation<bindingType> &allocation)
+{
+	auto &allocation_cpp = reinterpret_cast<BufferAllocationCpp &>(allocation);
+
+	auto it = std::ranges::find_if(buffer_blocks, [&allocation_cpp](auto const &buffer_block) { return buffer_block->owns(allocation_cpp); });
+	if (it == buffer_blocks.end())
+	{
+		LOGE("Buffer allocation does not belong to this buffer pool");
+		return;
+	}
+
+	(*it)->free(allocation_cpp);
+}
+
+template <vkb::BindingType bindingType>
+TLSFAllocator::Statistics BufferPool<bindingType>::get_statistics() const
+{
+	TLSFAllocator::Statistics statistics;
+	for (auto const &buffer_block : buffer_blocks)
+	{
+		auto block_statistics = buffer_block->get_statistics();
+		statistics.size += block_statistics.size;
+		statistics.used += block_statistics.used;
+		statistics.allocations += block_statistics.allocations;
+		statistics.free_regions += block_statistics.free_regions;
+		statistics.largest_free_region = std::max(statistics.largest_free_region, block_statistics.largest_free_region);
+	}
+	return statistics;
+}
+
 template <vkb::BindingType bindingType>
 BufferBlock<bindingType> &BufferPool<bindingType>::request_buffer_block(DeviceSizeType minimum_size, bool minimal)
 {
+	// A free-list block only manages whole aligned ranges and rounds the allocations up to the alignment, so it needs an
+	// aligned size to hold the request
+	vk::DeviceSize minimum_block_size = minimum_size;
+	if (allocator == BufferBlockAllocator::FreeList)
+	{
+		vk::DeviceSize alignment = BufferBlockCpp::determine_alignment(usage, device.get_gpu().get_properties().limits);
+		minimum_block_size       = (minimum_size + alignment - 1) & ~(alignment - 1);
+	}
+
 	// Find a block in the range of the blocks which can fit the minimum size
 	auto it = minimal ? std::ranges::find_if(buffer_blocks,
-	                                         [&minimum_size](auto const &buffer_block) { return (buffer_block->get_size() == minimum_size) && buffer_block->can_allocate(minimum_size); }) :
+	                                         [&minimum_size, &minimum_block_size](auto const &buffer_block) {
+		                                         return (buffer_block->get_size() == minimum_block_size) && buffer_block->can_allocate(minimum_size);
+	                                         }) :
 	                    std::ranges::find_if(buffer_blocks,
 	                                         [&minimum_size](auto const &buffer_block) { return buffer_block->can_allocate(minimum_size); });
 
@@ -346,10 +575,10 @@ BufferBlock<bindingType> &BufferPool<bindingType>::request_buffer_block(DeviceSi
 	{
 		LOGD("Building #{} buffer block ({})", buffer_blocks.size(), vk::to_string(usage));
 
-		vk::DeviceSize new_block_size = minimal ? minimum_size : std::max(block_size, minimum_size);
+		vk::DeviceSize new_block_size = minimal ? minimum_block_size : std::max(block_size, minimum_block_size);
 
 		// Create a new block and get the iterator on it
-		it = buffer_blocks.emplace(buffer_blocks.end(), std::make_unique<BufferBlockCpp>(device, new_block_size, usage, memory_usage));
+		it = buffer_blocks.emplace(buffer_blocks.end(), std::make_unique<BufferBlockCpp>(device, new_block_size, usage, memory_usage, allocator));
 	}
 
 	if constexpr (bindingType == vkb::BindingType::Cpp)
@@ -365,6 +594,11 @@ BufferBlock<bindingType> &BufferPool<bindingType>::request_buffer_block(DeviceSi
 template <vkb::BindingType bindingType>
 void BufferPool<bindingType>::reset()
 {
+	if (allocator == BufferBlockAllocator::FreeList)
+	{
+		return;
+	}
+
 	// Attention: Resetting the BufferPool is not supposed to clear the BufferBlocks, but just reset them!
 	//						The actual VkBuffers are used to hash the DescriptorSet in RenderFrame::request_descriptor_set.
 	//						Don't know (for now) how that works with resetted buffers!
@@ -35,6 +35,7 @@
 #include <vector>
 
 #include "common/error.h"
+#include "core/util/hash.hpp"
 
 #include "common/glm_common.h"
 #include <glm/gtx/hash.hpp>
@@ -172,17 +173,6 @@ inline void write(std::ostringstream &os, const T &first_arg, const Args &...arg
 	write(os, args...);
 }
 
-/**
- * @brief Helper function to combine a given hash
- *        with a generated hash for the input param.
- */
-template <class T>
-inline void hash_combine(size_t &seed, const T &v)
-{
-	std::hash<T> hasher;
-	glm::detail::hash_combine(seed, hasher(v));
-}
-
 /**
  * @brief Helper function to convert a data type
  *        to string using output stream operator.
@@ -18,8 +18,13 @@
 #pragma once
 
 #include "common/hpp_vk_common.h"
+#include "core/hpp_descriptor_pool.h"
 #include "core/hpp_descriptor_set.h"
+#include "core/hpp_descriptor_set_layout.h"
+#include "core/hpp_framebuffer.h"
 #include "core/hpp_image_view.h"
+#include "core/hpp_pipeline.h"
+#include "core/hpp_pipeline_layout.h"
 #include "core/hpp_render_pass.h"
 #include "core/hpp_shader_module.h"
 #include "hpp_resource_record.h"
@@ -269,6 +274,18 @@ struct hash<vkb::rendering::RenderTargetCpp>
 
 namespace vkb
 {
+namespace
+{
+/**
+ * @brief Keys the shader modules like the C bindings do, by their ids and resource modes rather than their addresses
+ */
+template <>
+inline void hash_param<std::vector<vkb::core::HPPShaderModule *>>(size_t &seed, const std::vector<vkb::core::HPPShaderModule *> &value)
+{
+	hash_param(seed, reinterpret_cast<std::vector<vkb::ShaderModule *> const &>(value));
+}
+}        // namespace
+
 namespace common
 {
 /**
@@ -277,6 +294,134 @@ namespace common
 
 namespace
 {
+/**
+ * @brief facade around MatchHelper, see there for documentation
+ */
+template <class T, class... A>
+struct HPPMatchHelper
+{
+	bool matches(T & /*resource*/, A &.../*args*/)
+	{
+		return true;
+	}
+};
+
+template <class... A>
+struct HPPMatchHelper<vkb::core::HPPShaderModule, A...>
+{
+	bool matches(vkb::core::HPPShaderModule        &shader_module,
+	             const vk::ShaderStageFlagBits     &stage,
+	             const vkb::core::HPPShaderSource  &shader_source,
+	             const std::string                 &entry_point,
+	             const vkb::core::HPPShaderVariant &shader_variant)
+	{
+		return vkb::MatchHelper<vkb::ShaderModule>{}.matches(reinterpret_cast<vkb::ShaderModule &>(shader_module),
+		                                                     reinterpret_cast<VkShaderStageFlagBits const &>(stage),
+		                                                     reinterpret_cast<vkb::ShaderSource const &>(shader_source),
+		                                                     entry_point,
+		                                                     reinterpret_cast<vkb::ShaderVariant const &>(shader_variant));
+	}
+};
+
+template <class... A>
+struct HPPMatchHelper<vkb::core::HPPPipelineLayout, A...>
+{
+	bool matches(vkb::core::HPPPipelineLayout &pipeline_layout, const std::vector<vkb::core::HPPShaderModule *> &shader_modules)
+	{
+		return std::ranges::equal(pipeline_layout.get_shader_modules(), shader_modules, [](const vkb::core::HPPShaderModule *lhs, const vkb::core::HPPShaderModule *rhs) {
+			       return lhs->get_id() == rhs->get_id();
+		       }) &&
+		       vkb::resource_modes_equal(reinterpret_cast<std::unordered_map<uint32_t, std::vector<vkb::ShaderResource>> const &>(pipeline_layout.get_shader_sets()),
+		                                 reinterpret_cast<std::vector<vkb::ShaderModule *> const &>(shader_modules));
+	}
+};
+
+template <class... A>
+struct HPPMatchHelper<vkb::core::HPPDescriptorSetLayout, A...>
+{
+	bool matches(vkb::core::HPPDescriptorSetLayout               &descriptor_set_layout,
+	             const uint32_t                                  &set_index,
+	             const std::vector<vkb::core::HPPShaderModule *> &shader_modules,
+	             const std::vector<vkb::core::HPPShaderResource> &set_resources)
+	{
+		return vkb::MatchHelper<vkb::DescriptorSetLayout>{}.matches(reinterpret_cast<vkb::DescriptorSetLayout &>(descriptor_set_layout),
+		                                                            set_index,
+		                                                            reinterpret_cast<std::vector<vkb::ShaderModule *> const &>(shader_modules),
+		                                                            reinterpret_cast<std::vector<vkb::ShaderResource> const &>(set_resources));
+	}
+};
+
+template <class... A>
+struct HPPMatchHelper<vkb::core::HPPDescriptorPool, A...>
+{
+	bool matches(vkb::core::HPPDescriptorPool &descriptor_pool, const vkb::core::HPPDescriptorSetLayout &descriptor_set_layout)
+	{
+		return vkb::MatchHelper<vkb::DescriptorPool>{}.matches(reinterpret_cast<vkb::DescriptorPool &>(descriptor_pool),
+		                                                       reinterpret_cast<vkb::DescriptorSetLayout const &>(descriptor_set_layout));
+	}
+};
+
+template <class... A>
+struct HPPMatchHelper<vkb::core::HPPDescriptorSet, A...>
+{
+	bool matches(vkb::core::HPPDescriptorSet                &descriptor_set,
+	             const vkb::core::HPPDescriptorSetLayout    &descriptor_set_layout,
+	             const vkb::core::HPPDescriptorPool         &descriptor_pool,
+	             const BindingMap<vk::DescriptorBufferInfo> &buffer_infos,
+	             const BindingMap<vk::DescriptorImageInfo>  &image_infos)
+	{
+		return vkb::MatchHelper<vkb::DescriptorSet>{}.matches(reinterpret_cast<vkb::DescriptorSet &>(descriptor_set),
+		                                                      reinterpret_cast<vkb::DescriptorSetLayout const &>(descriptor_set_layout),
+		                                                      reinterpret_cast<vkb::DescriptorPool const &>(descriptor_pool),
+		                                                      reinterpret_cast<BindingMap<VkDescriptorBufferInfo> const &>(buffer_infos),
+		                                                      reinterpret_cast<BindingMap<VkDescriptorImageInfo> const &>(image_infos));
+	}
+};
+
+template <class... A>
+struct HPPMatchHelper<vkb::core::HPPRenderPass, A...>
+{
+	bool matches(vkb::core::HPPRenderPass                         &render_pass,
+	             const std::vector<vkb::rendering::AttachmentCpp> &attachments,
+	             const std::vector<vkb::common::HPPLoadStoreInfo> &load_store_infos,
+	             const std::vector<vkb::core::HPPSubpassInfo>     &subpasses)
+	{
+		return vkb::MatchHelper<vkb::RenderPass>{}.matches(reinterpret_cast<vkb::RenderPass &>(render_pass),
+		                                                   reinterpret_cast<std::vector<vkb::rendering::AttachmentC> const &>(attachments),
+		                                                   reinterpret_cast<std::vector<vkb::LoadStoreInfo> const &>(load_store_infos),
+		                                                   reinterpret_cast<std::vector<vkb::SubpassInfo> const &>(subpasses));
+	}
+};
+
+template <class... A>
+struct HPPMatchHelper<vkb::core::HPPFramebuffer, A...>
+{
+	bool matches(vkb::core::HPPFramebuffer &framebuffer, const vkb::rendering::RenderTargetCpp &render_target, const vkb::core::HPPRenderPass &render_pass)
+	{
+		return vkb::MatchHelper<vkb::Framebuffer>{}.matches(reinterpret_cast<vkb::Framebuffer &>(framebuffer),
+		                                                    reinterpret_cast<vkb::rendering::RenderTargetC const &>(render_target),
+		                                                    reinterpret_cast<vkb::RenderPass const &>(render_pass));
+	}
+};
+
+template <class... A>
+struct HPPMatchHelper<vkb::core::HPPGraphicsPipeline, A...>
+{
+	bool matches(vkb::core::HPPGraphicsPipeline &graphics_pipeline, const vk::PipelineCache & /*pipeline_cache*/, const vkb::rendering::HPPPipelineState &pipeline_state)
+	{
+		return reinterpret_cast<vkb::GraphicsPipeline &>(graphics_pipeline).get_state() == reinterpret_cast<vkb::PipelineState const &>(pipeline_state);
+	}
+};
+
+template <class... A>
+struct HPPMatchHelper<vkb::core::HPPComputePipeline, A...>
+{
+	bool matches(vkb::core::HPPComputePipeline &compute_pipeline, const vk::PipelineCache & /*pipeline_cache*/, const vkb::rendering::HPPPipelineState &pipeline_state)
+	{
+		return reinterpret_cast<vkb::ComputePipeline &>(compute_pipeline).get_state() == reinterpret_cast<vkb::PipelineState const &>(pipeline_state);
+	}
+};
+
 template <class T, class... A>
 struct HPPRecordHelper
 {
@@ -346,6 +491,28 @@ struct HPPRecordHelper<vkb::core::HPPGraphicsPipeline, A...>
 };
 }        // namespace
 
+/**
+ * @brief facade around vkb::find_resource, see there for documentation
+ */
+template <class T, class... A>
+T *find_resource(std::unordered_map<size_t, T> &resources, size_t &hash, A &...args)
+{
+	HPPMatchHelper<T, A...> match_helper;
+
+	for (auto res_it = resources.find(hash); res_it != resources.end(); res_it = resources.find(hash))
+	{
+		if (match_helper.matches(res_it->second, args...))
+		{
+			return &res_it->second;
+		}
+
+		// Different parameters hashed to the same key, probe the next one
+		++hash;
+	}
+
+	return nullptr;
+}
+
 template <class T, class... A>
 T &request_resource(vkb::core::DeviceCpp &device, vkb::HPPResourceRecord *recorder, std::unordered_map<size_t, T> &resources, A &...args)
 {
@@ -354,13 +521,13 @@ T &request_resource(vkb::core::DeviceCpp &device, vkb::HPPResourceRecord *record
 	size_t hash{0U};
 	hash_param(hash, args...);
 
-	auto res_it = resources.find(hash);
-
-	if (res_it != resources.end())
+	if (auto resource = find_resource(resources, hash, args...))
 	{
-		return res_it->second;
+		return *resource;
 	}
 
+	typename std::unordered_map<size_t, T>::iterator res_it;
+
 	// If we do not have it already, create and cache it
 	const char *res_type = typeid(T).name();
 	size_t      res_id   = resources.size();
@@ -0,0 +1,248 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "job_system.h"
+
+#include <iterator>
+
+namespace vkb
+{
+namespace
+{
+/**
+ * @brief The index of a thread in a job system, which is identified by an id rather than its address as it may be
+ *        destroyed and another one created at the same address
+ */
+struct ThreadRegistration
+{
+	uint64_t job_system_id;
+	uint32_t thread_index;
+};
+
+std::atomic<uint64_t> next_job_system_id{0};
+
+thread_local std::vector<ThreadRegistration> thread_registrations;
+}        // namespace
+
+bool JobSystem::TaskGroup::is_done() const
+{
+	return pending_jobs.load(std::memory_order_acquire) == 0;
+}
+
+JobSystem::JobSystem(uint32_t worker_count) :
+    id{next_job_system_id.fetch_add(1, std::memory_order_relaxed)},
+    worker_count{worker_count}
+{
+	queues.resize(worker_count + MAX_EXTERNAL_THREAD_COUNT);
+	for (auto &queue : queues)
+	{
+		queue = std::make_unique<JobQueue>();
+	}
+
+	for (uint32_t thread_index = 1; thread_index <= worker_count; ++thread_index)
+	{
+		workers.emplace_back(&JobSystem::run_worker, this, thread_index);
+	}
+}
+
+JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> guard{sleep_mutex};
+		stopping = true;
+	}
+	sleep_condition.notify_all();
+
+	// The workers drain the queues before they stop
+	for (auto &worker : workers)
+	{
+		worker.join();
+	}
+}
+
+JobSystem &JobSystem::get()
+{
+	static JobSystem job_system{std::max(std::thread::hardware_concurrency(), 2U) - 1};
+	return job_system;
+}
+
+uint32_t JobSystem::get_thread_index()
+{
+	for (auto &registration : thread_registrations)
+	{
+		if (registration.job_system_id == id)
+		{
+			return registration.thread_index;
+		}
+	}
+
+	// The first thread that is not a worker gets index 0, the next ones the indices after the workers
+	uint32_t external_index = external_thread_count.fetch_add(1, std::memory_order_relaxed);
+	uint32_t thread_index   = 0;
+	if (0 < external_index && external_index < MAX_EXTERNAL_THREAD_COUNT)
+	{
+		thread_index = worker_count + external_index;
+	}
+
+	thread_registrations.push_back({id, thread_index});
+	return thread_index;
+}
+
+uint32_t JobSystem::get_thread_count() const
+{
+	return worker_count + 1;
+}
+
+uint32_t JobSystem::get_max_thread_count() const
+{
+	return static_cast<uint32_t>(queues.size());
+}
+
+void JobSystem::submit(TaskGroup &group, std::function<void()> &&job)
+{
+	group.pending_jobs.fetch_add(1, std::memory_order_relaxed);
+
+	// Counted before it is queued, so that the count never drops below the number of queued jobs
+	queued_jobs.fetch_add(1, std::memory_order_release);
+
+	auto &queue = *queues[get_thread_index()];
+	{
+		std::lock_guard<std::mutex> guard{queue.mutex};
+		queue.jobs.push_back(Job{std::move(job), &group});
+	}
+
+	// Taking the lock orders the notification after a worker that just found nothing to do has started waiting
+	{
+		std::lock_guard<std::mutex> guard{sleep_mutex};
+	}
+	sleep_condition.notify_one();
+}
+
+void JobSystem::wait(TaskGroup &group)
+{
+	auto thread_index = get_thread_index();
+
+	Job job;
+	while (!group.is_done() && pop_job(thread_index, &group, job))
+	{
+		execute(job);
+	}
+
+	// The remaining jobs of the group are running on other threads, which can complete them without this one
+	std::unique_lock<std::mutex> lock{group.mutex};
+	group.done_condition.wait(lock, [&group]() { return group.is_done(); });
+
+	if (group.exception)
+	{
+		std::rethrow_exception(group.exception);
+	}
+}
+
+void JobSystem::execute(Job &job)
+{
+	try
+	{
+		job.function();
+	}
+	catch (...)
+	{
+		std::lock_guard<std::mutex> guard{job.group->mutex};
+		if (!job.group->exception)
+		{
+			job.group->exception = std::current_exception();
+		}
+	}
+
+	// The waiting thread destroys the group once it sees its last job done, which it only checks under the lock
+	std::lock_guard<std::mutex> guard{job.group->mutex};
+	if (job.group->pending_jobs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		job.group->done_condition.notify_all();
+	}
+}
+
+uint32_t JobSystem::get_active_queue_count() const
+{
+	// Only the queues of the threads that got an index can hold jobs
+	uint32_t external_count = std::max(external_thread_count.load(std::memory_order_relaxed), 1U);
+	return std::min(worker_count + external_count, get_max_thread_count());
+}
+
+bool JobSystem::pop_job(uint32_t queue_index, const TaskGroup *group, Job &job)
+{
+	if (queued_jobs.load(std::memory_order_acquire) == 0)
+	{
+		return false;
+	}
+
+	auto is_match = [group](const Job &queued_job) { return group == nullptr || queued_job.group == group; };
+
+	// The most recent job of the own queue is the most likely to find its data still in the cache
+	{
+		auto                       &queue = *queues[queue_index];
+		std::lock_guard<std::mutex> guard{queue.mutex};
+		auto                        it = std::find_if(queue.jobs.rbegin(), queue.jobs.rend(), is_match);
+		if (it != queue.jobs.rend())
+		{
+			job = std::move(*it);
+			queue.jobs.erase(std::next(it).base());
+			queued_jobs.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	// Steal the oldest job of another queue, which is likely to be the largest one left
+	uint32_t queue_count = get_active_queue_count();
+	for (uint32_t offset = 1; offset < queue_count; ++offset)
+	{
+		auto                       &queue = *queues[(queue_index + offset) % queue_count];
+		std::lock_guard<std::mutex> guard{queue.mutex};
+		auto                        it = std::find_if(queue.jobs.begin(), queue.jobs.end(), is_match);
+		if (it != queue.jobs.end())
+		{
+			job = std::move(*it);
+			queue.jobs.erase(it);
+			queued_jobs.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void JobSystem::run_worker(uint32_t thread_index)
+{
+	thread_registrations.push_back({id, thread_index});
+
+	while (true)
+	{
+		Job job;
+		if (pop_job(thread_index, nullptr, job))
+		{
+			execute(job);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock{sleep_mutex};
+		sleep_condition.wait(lock, [this]() { return stopping || queued_jobs.load(std::memory_order_acquire) != 0; });
+		if (stopping && queued_jobs.load(std::memory_order_acquire) == 0)
+		{
+			return;
+		}
+	}
+}
+}        // namespace vkb
@@ -0,0 +1,197 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vkb
+{
+/**
+ * @brief Pool of worker threads running small jobs, balanced by work stealing.
+ *
+ * Every thread index has its own deque of jobs. The workers have the indices 1 to the worker count, and any other
+ * thread gets an index when it first uses the job system: 0 for the first one, usually the main thread, and the
+ * indices after the workers for the next ones. A thread pushes and pops jobs at the back of its own deque, most
+ * recent first, while idle threads steal from the front of the other deques, oldest first. A thread waiting on a
+ * group of jobs only runs the queued jobs of that group, then sleeps until the ones running elsewhere are done.
+ *
+ * The thread index of a thread never changes. Per-thread resources, such as the command pools created by
+ * RenderContext::prepare(thread_count), can be indexed with get_thread_index() when there are get_max_thread_count()
+ * of them.
+ */
+class JobSystem
+{
+  public:
+	/**
+	 * @brief Counts the unfinished jobs submitted as part of it, and keeps the first exception thrown by one of them
+	 */
+	class TaskGroup
+	{
+	  public:
+		bool is_done() const;
+
+	  private:
+		friend class JobSystem;
+
+		std::condition_variable done_condition;
+		std::exception_ptr      exception;
+		std::mutex              mutex;
+		std::atomic<uint32_t>   pending_jobs{0};
+	};
+
+  public:
+	/**
+	 * @param worker_count Number of worker threads, in addition to the threads that submit jobs
+	 */
+	explicit JobSystem(uint32_t worker_count);
+
+	~JobSystem();
+
+	JobSystem(const JobSystem &)            = delete;
+	JobSystem(JobSystem &&)                 = delete;
+	JobSystem &operator=(const JobSystem &) = delete;
+	JobSystem &operator=(JobSystem &&)      = delete;
+
+	/**
+	 * @brief Gets the job system shared by the framework, created on first use with a worker for each additional core
+	 */
+	static JobSystem &get();
+
+	/**
+	 * @return The index of the calling thread, below get_max_thread_count()
+	 *         Threads that are not workers share index 0 once there are more of them than MAX_EXTERNAL_THREAD_COUNT
+	 */
+	uint32_t get_thread_index();
+
+	/**
+	 * @return The number of threads running the jobs of a group at once, that is the number of workers plus one
+	 */
+	uint32_t get_thread_count() const;
+
+	/**
+	 * @return The number of thread indices, for the workers and the threads that are not workers
+	 */
+	uint32_t get_max_thread_count() const;
+
+	/**
+	 * @brief Runs a function over the indices [0, count) in chunks of grain_size indices, and waits for all of them
+	 * @param func Called as func(begin, end) for each chunk, the first chunk runs on the calling thread
+	 */
+	template <typename Func>
+	void parallel_for(size_t count, size_t grain_size, Func &&func);
+
+	/**
+	 * @brief Queues a job as part of a group, the group must outlive the job
+	 */
+	void submit(TaskGroup &group, std::function<void()> &&job);
+
+	/**
+	 * @brief Waits for all the jobs of a group, running its queued jobs on the calling thread meanwhile
+	 *        Jobs of other groups are not run, as they could need a lock that the calling thread holds.
+	 *        Rethrows the first exception thrown by a job of the group
+	 */
+	void wait(TaskGroup &group);
+
+	/// Number of threads that are not workers with an index of their own
+	static constexpr uint32_t MAX_EXTERNAL_THREAD_COUNT = 16;
+
+  private:
+	struct Job
+	{
+		std::function<void()> function;
+		TaskGroup            *group = nullptr;
+	};
+
+	struct JobQueue
+	{
+		std::deque<Job> jobs;
+		std::mutex      mutex;
+	};
+
+	void execute(Job &job);
+
+	uint32_t get_active_queue_count() const;
+
+	/**
+	 * @brief Takes a queued job, of any group if group is null
+	 */
+	bool pop_job(uint32_t queue_index, const TaskGroup *group, Job &job);
+
+	void run_worker(uint32_t thread_index);
+
+  private:
+	uint64_t                               id;
+	uint32_t                               worker_count;
+	std::atomic<uint32_t>                  external_thread_count{0};
+	std::vector<std::unique_ptr<JobQueue>> queues;        // One per thread index
+	std::atomic<uint32_t>                  queued_jobs{0};
+	std::condition_variable                sleep_condition;
+	std::mutex                             sleep_mutex;
+	bool                                   stopping = false;
+	std::vector<std::thread>               workers;
+};
+
+template <typename Func>
+inline void JobSystem::parallel_for(size_t count, size_t grain_size, Func &&func)
+{
+	grain_size = std::max<size_t>(grain_size, 1);
+	if (count <= grain_size || workers.empty())
+	{
+		if (0 < count)
+		{
+			func(size_t{0}, count);
+		}
+		return;
+	}
+
+	TaskGroup group;
+	for (size_t begin = grain_size; begin < count; begin += grain_size)
+	{
+		size_t end = std::min(begin + grain_size, count);
+		submit(group, [&func, begin, end]() { func(begin, end); });
+	}
+
+	// The queued chunks reference func, so they have to complete even if the first chunk throws
+	std::exception_ptr exception;
+	try
+	{
+		func(size_t{0}, grain_size);
+	}
+	catch (...)
+	{
+		exception = std::current_exception();
+	}
+
+	wait(group);
+
+	if (exception)
+	{
+		std::rethrow_exception(exception);
+	}
+}
+}        // namespace vkb
@@ -454,6 +454,129 @@ struct hash<vkb::rendering::RenderTargetC>
 	}
 };
 
+template <>
+struct hash<vkb::VertexInputState>
+{
+	std::size_t operator()(const vkb::VertexInputState &vertex_input_state) const
+	{
+		std::size_t result = 0;
+
+		for (auto &attribute : vertex_input_state.attributes)
+		{
+			vkb::hash_combine(result, attribute);
+		}
+
+		for (auto &binding : vertex_input_state.bindings)
+		{
+			vkb::hash_combine(result, binding);
+		}
+
+		return result;
+	}
+};
+
+template <>
+struct hash<vkb::InputAssemblyState>
+{
+	std::size_t operator()(const vkb::InputAssemblyState &input_assembly_state) const
+	{
+		std::size_t result = 0;
+
+		vkb::hash_combine(result, input_assembly_state.primitive_restart_enable);
+		vkb::hash_combine(result, static_cast<std::underlying_type<VkPrimitiveTopology>::type>(input_assembly_state.topology));
+
+		return result;
+	}
+};
+
+template <>
+struct hash<vkb::ViewportState>
+{
+	std::size_t operator()(const vkb::ViewportState &viewport_state) const
+	{
+		std::size_t result = 0;
+
+		vkb::hash_combine(result, viewport_state.viewport_count);
+		vkb::hash_combine(result, viewport_state.scissor_count);
+
+		return result;
+	}
+};
+
+template <>
+struct hash<vkb::RasterizationState>
+{
+	std::size_t operator()(const vkb::RasterizationState &rasterization_state) const
+	{
+		std::size_t result = 0;
+
+		vkb::hash_combine(result, rasterization_state.cull_mode);
+		vkb::hash_combine(result, rasterization_state.depth_bias_enable);
+		vkb::hash_combine(result, rasterization_state.depth_clamp_enable);
+		vkb::hash_combine(result, static_cast<std::underlying_type<VkFrontFace>::type>(rasterization_state.front_face));
+		vkb::hash_combine(result, static_cast<std::underlying_type<VkPolygonMode>::type>(rasterization_state.polygon_mode));
+		vkb::hash_combine(result, rasterization_state.rasterizer_discard_enable);
+
+		return result;
+	}
+};
+
+template <>
+struct hash<vkb::MultisampleState>
+{
+	std::size_t operator()(const vkb::MultisampleState &multisample_state) const
+	{
+		std::size_t result = 0;
+
+		vkb::hash_combine(result, multisample_state.alpha_to_coverage_enable);
+		vkb::hash_combine(result, multisample_state.alpha_to_one_enable);
+		vkb::hash_combine(result, multisample_state.min_sample_shading);
+		vkb::hash_combine(result, static_cast<std::underlying_type<VkSampleCountFlagBits>::type>(multisample_state.rasterization_samples));
+		vkb::hash_combine(result, multisample_state.sample_shading_enable);
+		vkb::hash_combine(result, multisample_state.sample_mask);
+
+		return result;
+	}
+};
+
+template <>
+struct hash<vkb::DepthStencilState>
+{
+	std::size_t operator()(const vkb::DepthStencilState &depth_stencil_state) const
+	{
+		std::size_t result = 0;
+
+		vkb::hash_combine(result, depth_stencil_state.back);
+		vkb::hash_combine(result, depth_stencil_state.depth_bounds_test_enable);
+		vkb::hash_combine(result, static_cast<std::underlying_type<VkCompareOp>::type>(depth_stencil_state.depth_compare_op));
+		vkb::hash_combine(result, depth_stencil_state.depth_test_enable);
+		vkb::hash_combine(result, depth_stencil_state.depth_write_enable);
+		vkb::hash_combine(result, depth_stencil_state.front);
+		vkb::hash_combine(result, depth_stencil_state.stencil_test_enable);
+
+		return result;
+	}
+};
+
+template <>
+struct hash<vkb::ColorBlendState>
+{
+	std::size_t operator()(const vkb::ColorBlendState &color_blend_state) const
+	{
+		std::size_t result = 0;
+
+		vkb::hash_combine(result, static_cast<std::underlying_type<VkLogicOp>::type>(color_blend_state.logic_op));
+		vkb::hash_combine(result, color_blend_state.logic_op_enable);
+
+		for (auto &attachment : color_blend_state.attachments)
+		{
+			vkb::hash_combine(result, attachment);
+		}
+
+		return result;
+	}
+};
+
 template <>
 struct hash<vkb::PipelineState>
 {
@@ -478,58 +601,13 @@ struct hash<vkb::PipelineState>
 			vkb::hash_combine(result, shader_module->get_id());
 		}
 
-		// VkPipelineVertexInputStateCreateInfo
-		for (auto &attribute : pipeline_state.get_vertex_input_state().attributes)
-		{
-			vkb::hash_combine(result, attribute);
-		}
-
-		for (auto &binding : pipeline_state.get_vertex_input_state().bindings)
-		{
-			vkb::hash_combine(result, binding);
-		}
-
-		// VkPipelineInputAssemblyStateCreateInfo
-		vkb::hash_combine(result, pipeline_state.get_input_assembly_state().primitive_restart_enable);
-		vkb::hash_combine(result, static_cast<std::underlying_type<VkPrimitiveTopology>::type>(pipeline_state.get_input_assembly_state().topology));
-
-		// VkPipelineViewportStateCreateInfo
-		vkb::hash_combine(result, pipeline_state.get_viewport_state().viewport_count);
-		vkb::hash_combine(result, pipeline_state.get_viewport_state().scissor_count);
-
-		// VkPipelineRasterizationStateCreateInfo
-		vkb::hash_combine(result, pipeline_state.get_rasterization_state().cull_mode);
-		vkb::hash_combine(result, pipeline_state.get_rasterization_state().depth_bias_enable);
-		vkb::hash_combine(result, pipeline_state.get_rasterization_state().depth_clamp_enable);
-		vkb::hash_combine(result, static_cast<std::underlying_type<VkFrontFace>::type>(pipeline_state.get_rasterization_state().front_face));
-		vkb::hash_combine(result, static_cast<std::underlying_type<VkPolygonMode>::type>(pipeline_state.get_rasterization_state().polygon_mode));
-		vkb::hash_combine(result, pipeline_state.get_rasterization_state().rasterizer_discard_enable);
-
-		// VkPipelineMultisampleStateCreateInfo
-		vkb::hash_combine(result, pipeline_state.get_multisample_state().alpha_to_coverage_enable);
-		vkb::hash_combine(result, pipeline_state.get_multisample_state().alpha_to_one_enable);
-		vkb::hash_combine(result, pipeline_state.get_multisample_state().min_sample_shading);
-		vkb::hash_combine(result, static_cast<std::underlying_type<VkSampleCountFlagBits>::type>(pipeline_state.get_multisample_state().rasterization_samples));
-		vkb::hash_combine(result, pipeline_state.get_multisample_state().sample_shading_enable);
-		vkb::hash_combine(result, pipeline_state.get_multisample_state().sample_mask);
-
-		// VkPipelineDepthStencilStateCreateInfo
-		vkb::hash_combine(result, pipeline_state.get_depth_stencil_state().back);
-		vkb::hash_combine(result, pipeline_state.get_depth_stencil_state().depth_bounds_test_enable);
-		vkb::hash_combine(result, static_cast<std::underlying_type<VkCompareOp>::type>(pipeline_state.get_depth_stencil_state().depth_compare_op));
-		vkb::hash_combine(result, pipeline_state.get_depth_stencil_state().depth_test_enable);
-		vkb::hash_combine(result, pipeline_state.get_depth_stencil_state().depth_write_enable);
-		vkb::hash_combine(result, pipeline_state.get_depth_stencil_state().front);
-		vkb::hash_combine(result, pipeline_state.get_depth_stencil_state().stencil_test_enable);
-
-		// VkPipelineColorBlendStateCreateInfo
-		vkb::hash_combine(result, static_cast<std::underlying_type<VkLogicOp>::type>(pipeline_state.get_color_blend_state().logic_op));
-		vkb::hash_combine(result, pipeline_state.get_color_blend_state().logic_op_enable);
-
-		for (auto &attachment : pipeline_state.get_color_blend_state().attachments)
-		{
-			vkb::hash_combine(result, attachment);
-		}
+		vkb::hash_combine(result, pipeline_state.get_vertex_input_state());
+		vkb::hash_combine(result, pipeline_state.get_input_assembly_state());
+		vkb::hash_combine(result, pipeline_state.get_viewport_state());
+		vkb::hash_combine(result, pipeline_state.get_rasterization_state());
+		vkb::hash_combine(result, pipeline_state.get_multisample_state());
+		vkb::hash_combine(result, pipeline_state.get_depth_stencil_state());
+		vkb::hash_combine(result, pipeline_state.get_color_blend_state());
 
 		return result;
 	}
@@ -556,7 +634,7 @@ inline void hash_param<std::vector<uint8_t>>(
     size_t                     &seed,
     const std::vector<uint8_t> &value)
 {
-	hash_combine(seed, std::string{value.begin(), value.end()});
+	hash_combine(seed, static_cast<size_t>(hash_bytes(value.data(), value.size())));
 }
 
 template <>
@@ -600,6 +678,12 @@ inline void hash_param<std::vector<ShaderModule *>>(
 	for (auto &shader_module : value)
 	{
 		hash_combine(seed, shader_module->get_id());
+
+		// Resource modes are set on a module after it is created, a layout of the same modules with other modes is another resource
+		for (auto &resource : shader_module->get_resources())
+		{
+			hash_combine(seed, resource.mode);
+		}
 	}
 }
 
@@ -656,6 +740,246 @@ inline void hash_param(size_t &seed, const T &first_arg, const Args &...args)
 	hash_param(seed, args...);
 }
 
+template <class T>
+inline bool binding_maps_equal(const BindingMap<T> &lhs, const BindingMap<T> &rhs, bool (*infos_equal)(const T &, const T &))
+{
+	return std::ranges::equal(lhs, rhs, [infos_equal](const auto &lhs_binding, const auto &rhs_binding) {
+		return lhs_binding.first == rhs_binding.first &&
+		       std::ranges::equal(lhs_binding.second, rhs_binding.second, [infos_equal](const auto &lhs_element, const auto &rhs_element) {
+			       return lhs_element.first == rhs_element.first && infos_equal(lhs_element.second, rhs_element.second);
+		       });
+	});
+}
+
+inline bool buffer_infos_equal(const VkDescriptorBufferInfo &lhs, const VkDescriptorBufferInfo &rhs)
+{
+	return lhs.buffer == rhs.buffer && lhs.offset == rhs.offset && lhs.range == rhs.range;
+}
+
+inline bool image_infos_equal(const VkDescriptorImageInfo &lhs, const VkDescriptorImageInfo &rhs)
+{
+	return lhs.sampler == rhs.sampler && lhs.imageView == rhs.imageView && lhs.imageLayout == rhs.imageLayout;
+}
+
+inline bool shader_modules_equal(const std::vector<ShaderModule *> &lhs, const std::vector<ShaderModule *> &rhs)
+{
+	return std::ranges::equal(lhs, rhs, [](const ShaderModule *lhs_module, const ShaderModule *rhs_module) {
+		return lhs_module->get_id() == rhs_module->get_id();
+	});
+}
+
+/**
+ * @brief Whether the resources of the modules still have the modes of the resources of a pipeline layout
+ */
+inline bool resource_modes_equal(const std::unordered_map<uint32_t, std::vector<ShaderResource>> &shader_sets, const std::vector<ShaderModule *> &shader_modules)
+{
+	for (auto *shader_module : shader_modules)
+	{
+		for (auto &resource : shader_module->get_resources())
+		{
+			if (resource.type == ShaderResourceType::Input ||
+			    resource.type == ShaderResourceType::Output ||
+			    resource.type == ShaderResourceType::PushConstant ||
+			    resource.type == ShaderResourceType::SpecializationConstant)
+			{
+				continue;
+			}
+
+			auto set_it = shader_sets.find(resource.set);
+			if (set_it == shader_sets.end())
+			{
+				return false;
+			}
+
+			auto it = std::ranges::find_if(set_it->second, [&resource](const ShaderResource &set_resource) { return set_resource.name == resource.name; });
+			if (it == set_it->second.end() || it->mode != resource.mode)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+inline bool attachments_equal(const vkb::rendering::AttachmentC &lhs, const vkb::rendering::AttachmentC &rhs)
+{
+	return lhs.format == rhs.format && lhs.samples == rhs.samples && lhs.usage == rhs.usage && lhs.initial_layout == rhs.initial_layout;
+}
+
+inline bool load_store_infos_equal(const LoadStoreInfo &lhs, const LoadStoreInfo &rhs)
+{
+	return lhs.load_op == rhs.load_op && lhs.store_op == rhs.store_op;
+}
+
+inline bool subpass_infos_equal(const SubpassInfo &lhs, const SubpassInfo &rhs)
+{
+	return lhs.input_attachments == rhs.input_attachments &&
+	       lhs.output_attachments == rhs.output_attachments &&
+	       lhs.color_resolve_attachments == rhs.color_resolve_attachments &&
+	       lhs.disable_depth_stencil_attachment == rhs.disable_depth_stencil_attachment &&
+	       lhs.depth_stencil_resolve_attachment == rhs.depth_stencil_resolve_attachment &&
+	       lhs.depth_stencil_resolve_mode == rhs.depth_stencil_resolve_mode;
+}
+
+/**
+ * @brief Confirms that a cached resource was built from the requested parameters, so that two keys hashing
+ *        to the same value never return the wrong resource.
+ *        Resources that do not keep their creation parameters are matched on the hash alone.
+ */
+template <class T, class... A>
+struct MatchHelper
+{
+	bool matches(T & /*resource*/, A &.../*args*/)
+	{
+		return true;
+	}
+};
+
+template <class... A>
+struct MatchHelper<ShaderModule, A...>
+{
+	bool matches(ShaderModule                &shader_module,
+	             const VkShaderStageFlagBits &stage,
+	             const ShaderSource          &shader_source,
+	             const std::string           &entry_point,
+	             const ShaderVariant         &shader_variant)
+	{
+		return shader_module.get_stage() == stage &&
+		       shader_module.get_source_id() == shader_source.get_id() &&
+		       shader_module.get_entry_point() == entry_point &&
+		       shader_module.get_variant_id() == shader_variant.get_id();
+	}
+};
+
+template <class... A>
+struct MatchHelper<PipelineLayout, A...>
+{
+	bool matches(PipelineLayout &pipeline_layout, const std::vector<ShaderModule *> &shader_modules)
+	{
+		return shader_modules_equal(pipeline_layout.get_shader_modules(), shader_modules) &&
+		       resource_modes_equal(pipeline_layout.get_shader_sets(), shader_modules);
+	}
+};
+
+template <class... A>
+struct MatchHelper<DescriptorSetLayout, A...>
+{
+	bool matches(DescriptorSetLayout               &descriptor_set_layout,
+	             const uint32_t                    &set_index,
+	             const std::vector<ShaderModule *> &shader_modules,
+	             const std::vector<ShaderResource> &set_resources)
+	{
+		if (descriptor_set_layout.get_index() != set_index || !shader_modules_equal(descriptor_set_layout.get_shader_modules(), shader_modules))
+		{
+			return false;
+		}
+
+		// The layout has one binding per resource with a binding point, in the order of the resources
+		auto  &bindings      = descriptor_set_layout.get_bindings();
+		auto  &binding_flags = descriptor_set_layout.get_binding_flags();
+		size_t index         = 0;
+		for (auto &resource : set_resources)
+		{
+			if (resource.type == ShaderResourceType::Input ||
+			    resource.type == ShaderResourceType::Output ||
+			    resource.type == ShaderResourceType::PushConstant ||
+			    resource.type == ShaderResourceType::SpecializationConstant)
+			{
+				continue;
+			}
+
+			if (index == bindings.size())
+			{
+				return false;
+			}
+
+			auto &binding           = bindings[index];
+			bool  dynamic           = binding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC ||
+			                          binding.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+			bool  update_after_bind = binding_flags[index] & VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT;
+			if (binding.binding != resource.binding ||
+			    binding.descriptorCount != resource.array_size ||
+			    binding.stageFlags != resource.stages ||
+			    dynamic != (resource.mode == ShaderResourceMode::Dynamic) ||
+			    update_after_bind != (resource.mode == ShaderResourceMode::UpdateAfterBind))
+			{
+				return false;
+			}
+			++index;
+		}
+
+		return index == bindings.size();
+	}
+};
+
+template <class... A>
+struct MatchHelper<DescriptorPool, A...>
+{
+	bool matches(DescriptorPool &descriptor_pool, const DescriptorSetLayout &descriptor_set_layout)
+	{
+		return descriptor_pool.get_descriptor_set_layout().get_handle() == descriptor_set_layout.get_handle();
+	}
+};
+
+template <class... A>
+struct MatchHelper<DescriptorSet, A...>
+{
+	bool matches(DescriptorSet                            &descriptor_set,
+	             const DescriptorSetLayout                &descriptor_set_layout,
+	             const DescriptorPool                     & /*descriptor_pool*/,
+	             const BindingMap<VkDescriptorBufferInfo> &buffer_infos,
+	             const BindingMap<VkDescriptorImageInfo>  &image_infos)
+	{
+		return descriptor_set.get_layout().get_handle() == descriptor_set_layout.get_handle() &&
+		       binding_maps_equal(descriptor_set.get_buffer_infos(), buffer_infos, buffer_infos_equal) &&
+		       binding_maps_equal(descriptor_set.get_image_infos(), image_infos, image_infos_equal);
+	}
+};
+
+template <class... A>
+struct MatchHelper<RenderPass, A...>
+{
+	bool matches(RenderPass                                     &render_pass,
+	             const std::vector<vkb::rendering::AttachmentC> &attachments,
+	             const std::vector<LoadStoreInfo>               &load_store_infos,
+	             const std::vector<SubpassInfo>                 &subpasses)
+	{
+		return std::ranges::equal(render_pass.get_attachments(), attachments, attachments_equal) &&
+		       std::ranges::equal(render_pass.get_load_store_infos(), load_store_infos, load_store_infos_equal) &&
+		       std::ranges::equal(render_pass.get_subpasses(), subpasses, subpass_infos_equal);
+	}
+};
+
+template <class... A>
+struct MatchHelper<Framebuffer, A...>
+{
+	bool matches(Framebuffer &framebuffer, const vkb::rendering::RenderTargetC &render_target, const RenderPass &render_pass)
+	{
+		return framebuffer.get_render_pass_handle() == render_pass.get_handle() &&
+		       std::ranges::equal(framebuffer.get_attachments(), render_target.get_views(), [](VkImageView lhs, const vkb::core::ImageView &rhs) {
+			       return lhs == rhs.get_handle();
+		       });
+	}
+};
+
+template <class... A>
+struct MatchHelper<GraphicsPipeline, A...>
+{
+	bool matches(GraphicsPipeline &graphics_pipeline, const VkPipelineCache & /*pipeline_cache*/, const PipelineState &pipeline_state)
+	{
+		return graphics_pipeline.get_state() == pipeline_state;
+	}
+};
+
+template <class... A>
+struct MatchHelper<ComputePipeline, A...>
+{
+	bool matches(ComputePipeline &compute_pipeline, const VkPipelineCache & /*pipeline_cache*/, const PipelineState &pipeline_state)
+	{
+		return compute_pipeline.get_state() == pipeline_state;
+	}
+};
+
 template <class T, class... A>
 struct RecordHelper
 {
@@ -726,6 +1050,46 @@ struct RecordHelper<GraphicsPipeline, A...>
 };
 }        // namespace
 
+/**
+ * @brief Looks up the resource built from the given parameters
+ * @param resources The cache to search
+ * @param hash The hash of the parameters, on a miss it is advanced to the key the resource should be inserted at
+ * @return The cached resource, or nullptr if there is none
+ */
+template <class T, class... A>
+T *find_resource(std::unordered_map<std::size_t, T> &resources, std::size_t &hash, A &...args)
+{
+	MatchHelper<T, A...> match_helper;
+
+	for (auto res_it = resources.find(hash); res_it != resources.end(); res_it = resources.find(hash))
+	{
+		if (match_helper.matches(res_it->second, args...))
+		{
+			return &res_it->second;
+		}
+
+		// Different parameters hashed to the same key, probe the next one
+		++hash;
+	}
+
+	return nullptr;
+}
+
+/**
+ * @brief Caches a resource at the first free key probed from its hash, where find_resource will reach it
+ * @return The cached resource
+ */
+template <class T>
+T &insert_resource(std::unordered_map<std::size_t, T> &resources, std::size_t hash, T &&resource)
+{
+	while (resources.find(hash) != resources.end())
+	{
+		++hash;
+	}
+
+	return resources.emplace(hash, std::move(resource)).first->second;
+}
+
 template <class T, class... A>
 T &request_resource(vkb::core::DeviceC &device, ResourceRecord *recorder, std::unordered_map<std::size_t, T> &resources, A &...args)
 {
@@ -734,13 +1098,13 @@ T &request_resource(vkb::core::DeviceC &device, ResourceRecord *recorder, std::u
 	std::size_t hash{0U};
 	hash_param(hash, args...);
 
-	auto res_it = resources.find(hash);
-
-	if (res_it != resources.end())
+	if (auto resource = find_resource(resources, hash, args...))
 	{
-		return res_it->second;
+		return *resource;
 	}
 
+	typename std::unordered_map<std::size_t, T>::iterator res_it;
+
 	// If we do not have it already, create and cache it
 	const char *res_type = typeid(T).name();
 	size_t      res_id   = resources.size();
@@ -0,0 +1,285 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tlsf_allocator.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+namespace vkb
+{
+namespace
+{
+constexpr uint32_t MANTISSA_BITS  = 3;
+constexpr uint32_t MANTISSA_VALUE = 1U << MANTISSA_BITS;
+constexpr uint32_t MANTISSA_MASK  = MANTISSA_VALUE - 1;
+
+/**
+ * @brief Maps a size to a bin, as a float with 3 bits of mantissa
+ * @param round_up If true, every range in the returned bin is at least as large as size,
+ *        otherwise the returned bin is the one a range of that size is stored in
+ */
+uint32_t size_to_bin(uint32_t size, bool round_up)
+{
+	if (size < MANTISSA_VALUE)
+	{
+		// Small sizes are stored exactly
+		return size;
+	}
+
+	uint32_t highest_bit    = std::bit_width(size) - 1;
+	uint32_t mantissa_start = highest_bit - MANTISSA_BITS;
+	uint32_t exponent       = mantissa_start + 1;
+	uint32_t mantissa       = (size >> mantissa_start) & MANTISSA_MASK;
+
+	if (round_up && (size & ((1U << mantissa_start) - 1)))
+	{
+		// A mantissa overflow carries into the exponent
+		++mantissa;
+	}
+
+	return (exponent << MANTISSA_BITS) + mantissa;
+}
+}        // namespace
+
+TLSFAllocator::TLSFAllocator(uint32_t size, uint32_t max_allocations) :
+    size{size}
+{
+	// Every allocation may split a free range in two
+	nodes.reserve(max_allocations * 2);
+	free_node_indices.reserve(max_allocations * 2);
+	reset();
+}
+
+TLSFAllocator::Allocation TLSFAllocator::allocate(uint32_t alloc_size)
+{
+	assert(alloc_size > 0 && "Allocation size must be greater than zero");
+
+	uint32_t bin = find_free_bin(size_to_bin(alloc_size, true));
+	if (bin == INVALID_NODE)
+	{
+		return Allocation{};
+	}
+
+	uint32_t node_index = bin_heads[bin];
+	remove_free_node(node_index);
+
+	uint32_t remainder     = nodes[node_index].size - alloc_size;
+	nodes[node_index].size = alloc_size;
+	nodes[node_index].used = true;
+
+	if (remainder > 0)
+	{
+		// Return the tail of the range to the free bins, as the new right neighbour of the allocation
+		uint32_t remainder_index = insert_free_node(nodes[node_index].offset + alloc_size, remainder);
+
+		nodes[remainder_index].neighbor_prev = node_index;
+		nodes[remainder_index].neighbor_next = nodes[node_index].neighbor_next;
+		if (nodes[remainder_index].neighbor_next != INVALID_NODE)
+		{
+			nodes[nodes[remainder_index].neighbor_next].neighbor_prev = remainder_index;
+		}
+		nodes[node_index].neighbor_next = remainder_index;
+	}
+
+	used += alloc_size;
+	++allocations;
+
+	return Allocation{nodes[node_index].offset, node_index};
+}
+
+bool TLSFAllocator::can_allocate(uint32_t alloc_size) const
+{
+	assert(alloc_size > 0 && "Allocation size must be greater than zero");
+	return find_free_bin(size_to_bin(alloc_size, true)) != INVALID_NODE;
+}
+
+uint32_t TLSFAllocator::find_free_bin(uint32_t min_bin) const
+{
+	uint32_t top_bin = min_bin / LEAF_BINS_PER_TOP_BIN;
+	if (TOP_BIN_COUNT <= top_bin)
+	{
+		return INVALID_NODE;
+	}
+
+	// First look for a large enough leaf bin within the same top bin
+	uint32_t leaf_mask = used_leaf_bins[top_bin] & (0xFFU << (min_bin % LEAF_BINS_PER_TOP_BIN));
+	if (leaf_mask != 0)
+	{
+		return top_bin * LEAF_BINS_PER_TOP_BIN + std::countr_zero(leaf_mask);
+	}
+
+	// Otherwise any leaf bin of the next non-empty top bin fits
+	uint32_t top_mask = (top_bin + 1 < TOP_BIN_COUNT) ? used_top_bins & (~0U << (top_bin + 1)) : 0;
+	if (top_mask == 0)
+	{
+		return INVALID_NODE;
+	}
+
+	top_bin = std::countr_zero(top_mask);
+	return top_bin * LEAF_BINS_PER_TOP_BIN + std::countr_zero(static_cast<uint32_t>(used_leaf_bins[top_bin]));
+}
+
+void TLSFAllocator::free(Allocation const &allocation)
+{
+	assert(allocation.node < nodes.size() && nodes[allocation.node].used && "Invalid or already freed allocation");
+
+	uint32_t offset        = nodes[allocation.node].offset;
+	uint32_t free_size     = nodes[allocation.node].size;
+	uint32_t neighbor_prev = nodes[allocation.node].neighbor_prev;
+	uint32_t neighbor_next = nodes[allocation.node].neighbor_next;
+
+	used -= free_size;
+	--allocations;
+
+	// Coalesce with the free neighbours
+	if (neighbor_prev != INVALID_NODE && !nodes[neighbor_prev].used)
+	{
+		offset = nodes[neighbor_prev].offset;
+		free_size += nodes[neighbor_prev].size;
+
+		uint32_t merged = neighbor_prev;
+		neighbor_prev   = nodes[merged].neighbor_prev;
+		remove_free_node(merged);
+		release_node(merged);
+	}
+
+	if (neighbor_next != INVALID_NODE && !nodes[neighbor_next].used)
+	{
+		free_size += nodes[neighbor_next].size;
+
+		uint32_t merged = neighbor_next;
+		neighbor_next   = nodes[merged].neighbor_next;
+		remove_free_node(merged);
+		release_node(merged);
+	}
+
+	release_node(allocation.node);
+
+	uint32_t node_index             = insert_free_node(offset, free_size);
+	nodes[node_index].neighbor_prev = neighbor_prev;
+	nodes[node_index].neighbor_next = neighbor_next;
+	if (neighbor_prev != INVALID_NODE)
+	{
+		nodes[neighbor_prev].neighbor_next = node_index;
+	}
+	if (neighbor_next != INVALID_NODE)
+	{
+		nodes[neighbor_next].neighbor_prev = node_index;
+	}
+}
+
+TLSFAllocator::Statistics TLSFAllocator::get_statistics() const
+{
+	Statistics statistics;
+	statistics.size        = size;
+	statistics.used        = used;
+	statistics.allocations = allocations;
+
+	for (uint32_t node_index : bin_heads)
+	{
+		for (; node_index != INVALID_NODE; node_index = nodes[node_index].bin_next)
+		{
+			++statistics.free_regions;
+			statistics.largest_free_region = std::max(statistics.largest_free_region, nodes[node_index].size);
+		}
+	}
+
+	return statistics;
+}
+
+uint32_t TLSFAllocator::insert_free_node(uint32_t offset, uint32_t node_size)
+{
+	uint32_t node_index;
+	if (free_node_indices.empty())
+	{
+		node_index = static_cast<uint32_t>(nodes.size());
+		nodes.emplace_back();
+	}
+	else
+	{
+		node_index = free_node_indices.back();
+		free_node_indices.pop_back();
+	}
+
+	uint32_t bin = size_to_bin(node_size, false);
+
+	nodes[node_index] = Node{offset, node_size, INVALID_NODE, bin_heads[bin]};
+	if (bin_heads[bin] != INVALID_NODE)
+	{
+		nodes[bin_heads[bin]].bin_prev = node_index;
+	}
+	bin_heads[bin] = node_index;
+
+	used_leaf_bins[bin / LEAF_BINS_PER_TOP_BIN] |= static_cast<uint8_t>(1U << (bin % LEAF_BINS_PER_TOP_BIN));
+	used_top_bins |= 1U << (bin / LEAF_BINS_PER_TOP_BIN);
+
+	return node_index;
+}
+
+void TLSFAllocator::release_node(uint32_t node_index)
+{
+	free_node_indices.push_back(node_index);
+}
+
+void TLSFAllocator::remove_free_node(uint32_t node_index)
+{
+	Node const &node = nodes[node_index];
+
+	if (node.bin_prev != INVALID_NODE)
+	{
+		nodes[node.bin_prev].bin_next = node.bin_next;
+	}
+	else
+	{
+		// The node is the head of its bin, clear the bitmaps if the bin becomes empty
+		uint32_t bin   = size_to_bin(node.size, false);
+		bin_heads[bin] = node.bin_next;
+		if (node.bin_next == INVALID_NODE)
+		{
+			uint32_t top_bin = bin / LEAF_BINS_PER_TOP_BIN;
+			used_leaf_bins[top_bin] &= static_cast<uint8_t>(~(1U << (bin % LEAF_BINS_PER_TOP_BIN)));
+			if (used_leaf_bins[top_bin] == 0)
+			{
+				used_top_bins &= ~(1U << top_bin);
+			}
+		}
+	}
+
+	if (node.bin_next != INVALID_NODE)
+	{
+		nodes[node.bin_next].bin_prev = node.bin_prev;
+	}
+}
+
+void TLSFAllocator::reset()
+{
+	nodes.clear();
+	free_node_indices.clear();
+	bin_heads.fill(INVALID_NODE);
+	used_leaf_bins.fill(0);
+	used_top_bins = 0;
+	used          = 0;
+	allocations   = 0;
+
+	if (size > 0)
+	{
+		insert_free_node(0, size);
+	}
+}
+}        // namespace vkb
@@ -0,0 +1,126 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace vkb
+{
+/**
+ * @brief Two-level segregated fit (TLSF) allocator of ranges within a fixed size region.
+ *
+ * The allocator only manages offsets, it does not own any memory. Free ranges are kept in 256 bins indexed by a
+ * small floating point representation of their size (5 bits of exponent, 3 bits of mantissa), with a two-level
+ * bitmap to find the first non-empty bin that fits a request. Allocation and free are O(1), and freed ranges are
+ * coalesced with their free neighbours immediately.
+ *
+ * If every requested size is a multiple of some alignment, every returned offset is aligned to it as well.
+ */
+class TLSFAllocator
+{
+  public:
+	static constexpr uint32_t INVALID_NODE = ~0U;
+
+	struct Allocation
+	{
+		uint32_t offset = 0;
+		uint32_t node   = INVALID_NODE;
+	};
+
+	struct Statistics
+	{
+		uint32_t size                = 0;        // Size of the managed region
+		uint32_t used                = 0;        // Size of all live allocations
+		uint32_t largest_free_region = 0;        // Size of the largest free range
+		uint32_t free_regions        = 0;        // Number of free ranges, 1 when the free space is not fragmented at all
+		uint32_t allocations         = 0;        // Number of live allocations
+
+		/**
+		 * @return 0 when all free space is contiguous, approaching 1 as it is split into small ranges
+		 */
+		float get_fragmentation() const
+		{
+			uint32_t free = size - used;
+			return free == 0 ? 0.0f : 1.0f - static_cast<float>(largest_free_region) / static_cast<float>(free);
+		}
+	};
+
+  public:
+	/**
+	 * @param size Size of the managed region
+	 * @param max_allocations Expected number of live allocations, used to preallocate bookkeeping
+	 */
+	explicit TLSFAllocator(uint32_t size, uint32_t max_allocations = 128);
+
+	/**
+	 * @brief Allocates a range of the given size
+	 * @return The allocation, with node set to INVALID_NODE if no free range is large enough
+	 */
+	Allocation allocate(uint32_t size);
+
+	/**
+	 * @return True if an allocation of the given size would succeed
+	 */
+	bool can_allocate(uint32_t size) const;
+
+	/**
+	 * @brief Frees an allocation and merges it with its free neighbours
+	 */
+	void free(Allocation const &allocation);
+
+	Statistics get_statistics() const;
+
+	/**
+	 * @brief Frees all allocations at once
+	 */
+	void reset();
+
+  private:
+	static constexpr uint32_t LEAF_BINS_PER_TOP_BIN = 8;
+	static constexpr uint32_t TOP_BIN_COUNT         = 32;
+	static constexpr uint32_t BIN_COUNT             = TOP_BIN_COUNT * LEAF_BINS_PER_TOP_BIN;
+
+	struct Node
+	{
+		uint32_t offset        = 0;
+		uint32_t size          = 0;
+		uint32_t bin_prev      = INVALID_NODE;        // Previous free node in the same bin
+		uint32_t bin_next      = INVALID_NODE;        // Next free node in the same bin
+		uint32_t neighbor_prev = INVALID_NODE;        // Node of the range right before this one
+		uint32_t neighbor_next = INVALID_NODE;        // Node of the range right after this one
+		bool     used          = false;
+	};
+
+	uint32_t find_free_bin(uint32_t min_bin) const;
+	uint32_t insert_free_node(uint32_t offset, uint32_t size);
+	void     release_node(uint32_t node_index);
+	void     remove_free_node(uint32_t node_index);
+
+  private:
+	uint32_t                           size;
+	uint32_t                           used           = 0;
+	uint32_t                           allocations    = 0;
+	uint32_t                           used_top_bins  = 0;        // Bit i is set if any leaf bin of top bin i is non-empty
+	std::array<uint8_t, TOP_BIN_COUNT> used_leaf_bins = {};
+	std::array<uint32_t, BIN_COUNT>    bin_heads      = {};
+	std::vector<Node>                  nodes;
+	std::vector<uint32_t>              free_node_indices;        // Unused entries of nodes
+};
+}        // namespace vkb
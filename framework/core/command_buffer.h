@@ -18,6 +18,11 @@
 
 #pragma once
 
+#include <array>
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
 #include "common/hpp_vk_common.h"
 #include "core/device.h"
 #include "core/hpp_descriptor_set_layout.h"
@@ -225,6 +230,11 @@ class CommandBuffer
 	 */
 	void flush_push_constants();
 
+	/**
+	 * @brief Appends bytes to the push constants stored for the next flush
+	 */
+	void store_push_constants(const void *data, uint32_t size);
+
 	/**
 	 * @brief Check that the render area is an optimal size by comparing to the render area granularity
 	 */
@@ -261,17 +271,20 @@ class CommandBuffer
 	vk::Result                reset_impl(vkb::CommandBufferResetMode reset_mode);
 
   private:
-	vkb::core::CommandPoolCpp                                              &command_pool;
-	vkb::core::HPPFramebuffer const                                        *current_framebuffer = nullptr;
-	vkb::core::HPPRenderPass const                                         *current_render_pass = nullptr;
-	std::unordered_map<uint32_t, vkb::core::HPPDescriptorSetLayout const *> descriptor_set_layout_binding_state;
-	vk::Extent2D                                                            last_framebuffer_extent = {};
-	vk::Extent2D                                                            last_render_area_extent = {};
-	const vk::CommandBufferLevel                                            level                   = {};
-	const uint32_t                                                          max_push_constants_size = {};
-	vkb::rendering::HPPPipelineState                                        pipeline_state          = {};
-	vkb::HPPResourceBindingState                                            resource_binding_state  = {};
-	std::vector<uint8_t>                                                    stored_push_constants   = {};
+	vkb::core::CommandPoolCpp                                                                &command_pool;
+	vkb::core::HPPFramebuffer const                                                          *current_framebuffer                 = nullptr;
+	vkb::core::HPPRenderPass const                                                           *current_render_pass                 = nullptr;
+	std::array<vkb::core::HPPDescriptorSetLayout const *, vkb::ResourceBindingState::MAX_SETS> descriptor_set_layout_binding_state = {};
+	vk::Extent2D                                                                              last_framebuffer_extent             = {};
+	vk::Extent2D                                                                              last_render_area_extent             = {};
+	const vk::CommandBufferLevel                                                              level                               = {};
+	const uint32_t                                                                            max_push_constants_size             = {};
+	vkb::rendering::HPPPipelineState                                                          pipeline_state                      = {};
+	vkb::HPPResourceBindingState                                                              resource_binding_state              = {};
+	std::vector<uint8_t>                                                                      stored_push_constants               = {};        // Sized to max_push_constants_size once
+	uint32_t                                                                                  stored_push_constants_size          = 0;
+	std::vector<uint32_t>                                                                     dynamic_offsets                     = {};
+	std::vector<vk::WriteDescriptorSet>                                                       push_descriptor_writes              = {};
 
 	// If true, it becomes the responsibility of the caller to update ANY descriptor bindings
 	// that contain update after bind, as they wont be implicitly updated
@@ -296,6 +309,8 @@ template <vkb::BindingType bindingType>
 inline vkb::core::CommandBuffer<bindingType>::CommandBuffer(vkb::core::CommandPool<bindingType> &command_pool_, CommandBufferLevelType level_) :
     vkb::core::VulkanResource<bindingType, CommandBufferType>(nullptr, &command_pool_.get_device()), level(static_cast<vk::CommandBufferLevel>(level_)), command_pool(reinterpret_cast<vkb::core::CommandPoolCpp &>(command_pool_)), max_push_constants_size(command_pool_.get_device().get_gpu().get_properties().limits.maxPushConstantsSize)
 {
+	stored_push_constants.resize(max_push_constants_size);
+
 	vk::CommandBufferAllocateInfo allocate_info{.commandPool = command_pool.get_handle(), .level = level, .commandBufferCount = 1};
 
 	this->set_handle(this->get_device().get_resource().allocateCommandBuffers(allocate_info).front());
@@ -368,8 +383,8 @@ inline void CommandBuffer<bindingType>::begin_impl(vk::CommandBufferUsageFlags
 	// Reset state
 	pipeline_state.reset();
 	resource_binding_state.reset();
-	descriptor_set_layout_binding_state.clear();
-	stored_push_constants.clear();
+	descriptor_set_layout_binding_state.fill(nullptr);
+	stored_push_constants_size = 0;
 
 	vk::CommandBufferBeginInfo       begin_info{.flags = flags};
 	vk::CommandBufferInheritanceInfo inheritance;
@@ -414,7 +429,7 @@ inline void CommandBuffer<bindingType>::begin_render_pass(vkb::rendering::Render
 	// Reset state
 	pipeline_state.reset();
 	resource_binding_state.reset();
-	descriptor_set_layout_binding_state.clear();
+	descriptor_set_layout_binding_state.fill(nullptr);
 
 	auto &render_pass = get_render_pass(render_target, load_store_infos, subpasses);
 	auto &framebuffer = this->get_device().get_resource_cache().request_framebuffer(render_target, render_pass);
@@ -563,6 +578,18 @@ inline void CommandBuffer<bindingType>::bind_lighting(vkb::rendering::LightingSt
 	set_specialization_constant(0, to_u32(lighting_state.directional_lights.size()));
 	set_specialization_constant(1, to_u32(lighting_state.point_lights.size()));
 	set_specialization_constant(2, to_u32(lighting_state.spot_lights.size()));
+
+	// The clustered lights follow the light buffer, as declared in clustered_lighting.h
+	if (!lighting_state.cluster_info_buffer.empty())
+	{
+		for (auto *allocation : {&lighting_state.cluster_info_buffer,
+		                         &lighting_state.clustered_light_buffer,
+		                         &lighting_state.cluster_range_buffer,
+		                         &lighting_state.cluster_light_index_buffer})
+		{
+			bind_buffer(allocation->get_buffer(), allocation->get_offset(), allocation->get_size(), set, ++binding, 0);
+		}
+	}
 }
 
 template <vkb::BindingType bindingType>
@@ -997,10 +1024,10 @@ inline void CommandBuffer<bindingType>::next_subpass()
 
 	// Reset descriptor sets
 	resource_binding_state.reset();
-	descriptor_set_layout_binding_state.clear();
+	descriptor_set_layout_binding_state.fill(nullptr);
 
 	// Clear stored push constants
-	stored_push_constants.clear();
+	stored_push_constants_size = 0;
 
 	this->get_resource().nextSubpass(vk::SubpassContents::eInline);
 }
@@ -1008,34 +1035,15 @@ inline void CommandBuffer<bindingType>::next_subpass()
 template <vkb::BindingType bindingType>
 inline void CommandBuffer<bindingType>::push_constants(const std::vector<uint8_t> &values)
 {
-	uint32_t push_constant_size = to_u32(stored_push_constants.size() + values.size());
-
-	if (push_constant_size > max_push_constants_size)
-	{
-		LOGE("Push constant limit of {} exceeded (pushing {} bytes for a total of {} bytes)", max_push_constants_size, values.size(), push_constant_size);
-		throw std::runtime_error("Push constant limit exceeded.");
-	}
-	else
-	{
-		stored_push_constants.insert(stored_push_constants.end(), values.begin(), values.end());
-	}
+	store_push_constants(values.data(), to_u32(values.size()));
 }
 
 template <vkb::BindingType bindingType>
 template <typename T>
 inline void CommandBuffer<bindingType>::push_constants(const T &value)
 {
-	auto data = to_bytes(value);
-
-	uint32_t size = to_u32(stored_push_constants.size() + data.size());
-
-	if (size > max_push_constants_size)
-	{
-		LOGE("Push constant limit exceeded ({} / {} bytes)", size, max_push_constants_size);
-		throw std::runtime_error("Cannot overflow push constant limit");
-	}
-
-	stored_push_constants.insert(stored_push_constants.end(), data.begin(), data.end());
+	static_assert(std::is_trivially_copyable_v<T>, "Push constants must be trivially copyable");
+	store_push_constants(&value, to_u32(sizeof(T)));
 }
 
 template <vkb::BindingType bindingType>
@@ -1315,148 +1323,153 @@ inline void CommandBuffer<bindingType>::flush_descriptor_state_impl(vk::Pipeline
 
 	const auto &pipeline_layout = pipeline_state.get_pipeline_layout();
 
-	std::unordered_set<uint32_t> update_descriptor_sets;
-
-	// Iterate over the shader sets to check if they have already been bound
-	// If they have, add the set so that the command buffer later updates it
-	for (auto &set_it : pipeline_layout.get_shader_sets())
+	// Check if the bound descriptor set layouts still match the pipeline layout
+	// If a layout changed, mark the set so that the command buffer later updates it
+	// If a layout no longer exists in the pipeline layout, forget it
+	uint32_t update_descriptor_sets = 0;
+	for (uint32_t descriptor_set_id = 0; descriptor_set_id < descriptor_set_layout_binding_state.size(); ++descriptor_set_id)
 	{
-		uint32_t descriptor_set_id = set_it.first;
-
-		auto descriptor_set_layout_it = descriptor_set_layout_binding_state.find(descriptor_set_id);
-
-		if (descriptor_set_layout_it != descriptor_set_layout_binding_state.end())
+		auto &bound_layout = descriptor_set_layout_binding_state[descriptor_set_id];
+		if (bound_layout == nullptr)
 		{
-			if (descriptor_set_layout_it->second->get_handle() != pipeline_layout.get_descriptor_set_layout(descriptor_set_id).get_handle())
-			{
-				update_descriptor_sets.emplace(descriptor_set_id);
-			}
+			continue;
 		}
-	}
 
-	// Validate that the bound descriptor set layouts exist in the pipeline layout
-	for (auto set_it = descriptor_set_layout_binding_state.begin(); set_it != descriptor_set_layout_binding_state.end();)
-	{
-		if (!pipeline_layout.has_descriptor_set_layout(set_it->first))
+		if (!pipeline_layout.has_descriptor_set_layout(descriptor_set_id))
 		{
-			set_it = descriptor_set_layout_binding_state.erase(set_it);
+			bound_layout = nullptr;
 		}
-		else
+		else if (bound_layout->get_handle() != pipeline_layout.get_descriptor_set_layout(descriptor_set_id).get_handle())
 		{
-			++set_it;
+			update_descriptor_sets |= 1u << descriptor_set_id;
 		}
 	}
 
-	// Check if a descriptor set needs to be created
-	if (resource_binding_state.is_dirty() || !update_descriptor_sets.empty())
+	// Only the resource sets that changed or whose layout changed need a descriptor set
+	uint32_t flush_sets = resource_binding_state.get_bound_sets() & (resource_binding_state.get_dirty_sets() | update_descriptor_sets);
+	resource_binding_state.clear_dirty();
+
+	for (; flush_sets != 0; flush_sets &= flush_sets - 1)
 	{
-		resource_binding_state.clear_dirty();
+		uint32_t descriptor_set_id = std::countr_zero(flush_sets);
+		auto    &resource_set      = resource_binding_state.get_resource_set(descriptor_set_id);
 
-		// Iterate over all of the resource sets bound by the command buffer
-		for (auto &resource_set_it : resource_binding_state.get_resource_sets())
+		// Skip resource set if a descriptor set layout doesn't exist for it
+		if (!pipeline_layout.has_descriptor_set_layout(descriptor_set_id))
 		{
-			uint32_t descriptor_set_id = resource_set_it.first;
-			auto    &resource_set      = resource_set_it.second;
-
-			// Don't update resource set if it's not in the update list OR its state hasn't changed
-			if (!resource_set.is_dirty() && (update_descriptor_sets.find(descriptor_set_id) == update_descriptor_sets.end()))
-			{
-				continue;
-			}
-
-			// Clear dirty flag for resource set
-			resource_binding_state.clear_dirty(descriptor_set_id);
+			continue;
+		}
 
-			// Skip resource set if a descriptor set layout doesn't exist for it
-			if (!pipeline_layout.has_descriptor_set_layout(descriptor_set_id))
-			{
-				continue;
-			}
+		auto &descriptor_set_layout = pipeline_layout.get_descriptor_set_layout(descriptor_set_id);
 
-			auto &descriptor_set_layout = pipeline_layout.get_descriptor_set_layout(descriptor_set_id);
+		// Make descriptor set layout bound for current set
+		descriptor_set_layout_binding_state[descriptor_set_id] = &descriptor_set_layout;
 
-			// Make descriptor set layout bound for current set
-			descriptor_set_layout_binding_state[descriptor_set_id] = &descriptor_set_layout;
+		BindingMap<vk::DescriptorBufferInfo> buffer_infos;
+		BindingMap<vk::DescriptorImageInfo>  image_infos;
 
-			BindingMap<vk::DescriptorBufferInfo> buffer_infos;
-			BindingMap<vk::DescriptorImageInfo>  image_infos;
+		// The dynamic offsets are kept across flushes, so that they are only allocated once
+		dynamic_offsets.clear();
 
-			std::vector<uint32_t> dynamic_offsets;
+		// Iterate over all resource bindings
+		for (uint32_t bindings = resource_set.get_bound_bindings(); bindings != 0; bindings &= bindings - 1)
+		{
+			uint32_t    binding_index     = std::countr_zero(bindings);
+			auto const &binding_resources = resource_set.get_binding_resources(binding_index);
 
-			// Iterate over all resource bindings
-			for (auto &binding_it : resource_set.get_resource_bindings())
+			// Check if binding exists in the pipeline layout
+			if (auto binding_info = descriptor_set_layout.get_layout_binding(binding_index))
 			{
-				auto  binding_index     = binding_it.first;
-				auto &binding_resources = binding_it.second;
-
-				// Check if binding exists in the pipeline layout
-				if (auto binding_info = descriptor_set_layout.get_layout_binding(binding_index))
+				// Iterate over all binding resources
+				for (uint32_t array_element = 0; array_element < binding_resources.size(); ++array_element)
 				{
-					// Iterate over all binding resources
-					for (auto &element_it : binding_resources)
-					{
-						auto  array_element = element_it.first;
-						auto &resource_info = element_it.second;
+					auto &resource_info = binding_resources[array_element];
 
-						// Pointer references
-						auto &buffer     = resource_info.buffer;
-						auto &sampler    = resource_info.sampler;
-						auto &image_view = resource_info.image_view;
+					// Pointer references
+					auto &buffer     = resource_info.buffer;
+					auto &sampler    = resource_info.sampler;
+					auto &image_view = resource_info.image_view;
+
+					// Get buffer info
+					if (buffer != nullptr && vkb::common::is_buffer_descriptor_type(binding_info->descriptorType))
+					{
+						vk::DescriptorBufferInfo buffer_info{resource_info.buffer->get_handle(), resource_info.offset, resource_info.range};
 
-						// Get buffer info
-						if (buffer != nullptr && vkb::common::is_buffer_descriptor_type(binding_info->descriptorType))
+						if (vkb::common::is_dynamic_buffer_descriptor_type(binding_info->descriptorType))
 						{
-							vk::DescriptorBufferInfo buffer_info{resource_info.buffer->get_handle(), resource_info.offset, resource_info.range};
+							dynamic_offsets.push_back(to_u32(buffer_info.offset));
+							buffer_info.offset = 0;
+						}
 
-							if (vkb::common::is_dynamic_buffer_descriptor_type(binding_info->descriptorType))
-							{
-								dynamic_offsets.push_back(to_u32(buffer_info.offset));
-								buffer_info.offset = 0;
-							}
+						buffer_infos[binding_index][array_element] = buffer_info;
+					}
 
-							buffer_infos[binding_index][array_element] = buffer_info;
-						}
+					// Get image info
+					else if (image_view != nullptr || sampler != nullptr)
+					{
+						// Can be null for input attachments
+						vk::DescriptorImageInfo image_info{sampler ? sampler->get_handle() : nullptr, image_view->get_handle()};
 
-						// Get image info
-						else if (image_view != nullptr || sampler != nullptr)
+						if (image_view != nullptr)
 						{
-							// Can be null for input attachments
-							vk::DescriptorImageInfo image_info{sampler ? sampler->get_handle() : nullptr, image_view->get_handle()};
-
-							if (image_view != nullptr)
+							// Add image layout info based on descriptor type
+							switch (binding_info->descriptorType)
 							{
-								// Add image layout info based on descriptor type
-								switch (binding_info->descriptorType)
-								{
-									case vk::DescriptorType::eCombinedImageSampler:
-										image_info.imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal;
-										break;
-									case vk::DescriptorType::eInputAttachment:
-										image_info.imageLayout = vkb::common::is_depth_format(image_view->get_format()) ? vk::ImageLayout::eDepthStencilReadOnlyOptimal : vk::ImageLayout::eShaderReadOnlyOptimal;
-										break;
-									case vk::DescriptorType::eStorageImage:
-										image_info.imageLayout = vk::ImageLayout::eGeneral;
-										break;
-									default:
-										continue;
-								}
+								case vk::DescriptorType::eCombinedImageSampler:
+									image_info.imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal;
+									break;
+								case vk::DescriptorType::eInputAttachment:
+									image_info.imageLayout = vkb::common::is_depth_format(image_view->get_format()) ? vk::ImageLayout::eDepthStencilReadOnlyOptimal : vk::ImageLayout::eShaderReadOnlyOptimal;
+									break;
+								case vk::DescriptorType::eStorageImage:
+									image_info.imageLayout = vk::ImageLayout::eGeneral;
+									break;
+								default:
+									continue;
 							}
-
-							image_infos[binding_index][array_element] = image_info;
 						}
-					}
 
-					assert((!update_after_bind || (buffer_infos.count(binding_index) > 0 || (image_infos.count(binding_index) > 0))) &&
-					       "binding index with no buffer or image infos can't be checked for adding to bindings_to_update");
+						image_infos[binding_index][array_element] = image_info;
+					}
 				}
+
+				assert((!update_after_bind || (buffer_infos.count(binding_index) > 0 || (image_infos.count(binding_index) > 0))) &&
+				       "binding index with no buffer or image infos can't be checked for adding to bindings_to_update");
 			}
+		}
 
-			vk::DescriptorSet descriptor_set_handle = command_pool.get_render_frame()->request_descriptor_set(
-			    descriptor_set_layout, buffer_infos, image_infos, update_after_bind, command_pool.get_thread_index());
+		if (descriptor_set_layout.is_push_descriptor())
+		{
+			// Push descriptors are recorded straight into the command buffer, no descriptor set is allocated nor updated
+			push_descriptor_writes.clear();
+			for (auto const &[binding_index, binding_infos] : buffer_infos)
+			{
+				auto descriptor_type = descriptor_set_layout.get_layout_binding(binding_index)->descriptorType;
+				for (auto const &[array_element, buffer_info] : binding_infos)
+				{
+					push_descriptor_writes.push_back(
+					    {.dstBinding = binding_index, .dstArrayElement = array_element, .descriptorCount = 1, .descriptorType = descriptor_type, .pBufferInfo = &buffer_info});
+				}
+			}
+			for (auto const &[binding_index, binding_infos] : image_infos)
+			{
+				auto descriptor_type = descriptor_set_layout.get_layout_binding(binding_index)->descriptorType;
+				for (auto const &[array_element, image_info] : binding_infos)
+				{
+					push_descriptor_writes.push_back(
+					    {.dstBinding = binding_index, .dstArrayElement = array_element, .descriptorCount = 1, .descriptorType = descriptor_type, .pImageInfo = &image_info});
+				}
+			}
 
-			// Bind descriptor set
-			this->get_resource().bindDescriptorSets(pipeline_bind_point, pipeline_layout.get_handle(), descriptor_set_id, descriptor_set_handle, dynamic_offsets);
+			this->get_resource().pushDescriptorSetKHR(pipeline_bind_point, pipeline_layout.get_handle(), descriptor_set_id, push_descriptor_writes);
+			continue;
 		}
+
+		vk::DescriptorSet descriptor_set_handle = command_pool.get_render_frame()->request_descriptor_set(
+		    descriptor_set_layout, buffer_infos, image_infos, update_after_bind, command_pool.get_thread_index());
+
+		// Bind descriptor set
+		this->get_resource().bindDescriptorSets(pipeline_bind_point, pipeline_layout.get_handle(), descriptor_set_id, descriptor_set_handle, dynamic_offsets);
 	}
 }
 
@@ -1491,28 +1504,43 @@ inline void CommandBuffer<bindingType>::flush_pipeline_state_impl(vkb::core::Dev
 	}
 }
 
+template <vkb::BindingType bindingType>
+inline void CommandBuffer<bindingType>::store_push_constants(const void *data, uint32_t size)
+{
+	uint32_t push_constant_size = stored_push_constants_size + size;
+
+	if (push_constant_size > max_push_constants_size)
+	{
+		LOGE("Push constant limit of {} exceeded (pushing {} bytes for a total of {} bytes)", max_push_constants_size, size, push_constant_size);
+		throw std::runtime_error("Push constant limit exceeded.");
+	}
+
+	std::memcpy(stored_push_constants.data() + stored_push_constants_size, data, size);
+	stored_push_constants_size = push_constant_size;
+}
+
 template <vkb::BindingType bindingType>
 inline void CommandBuffer<bindingType>::flush_push_constants()
 {
-	if (stored_push_constants.empty())
+	if (stored_push_constants_size == 0)
 	{
 		return;
 	}
 
 	auto const &pipeline_layout = pipeline_state.get_pipeline_layout();
 
-	vk::ShaderStageFlags shader_stage = pipeline_layout.get_push_constant_range_stage(to_u32(stored_push_constants.size()));
+	vk::ShaderStageFlags shader_stage = pipeline_layout.get_push_constant_range_stage(stored_push_constants_size);
 
 	if (shader_stage)
 	{
-		this->get_resource().template pushConstants<uint8_t>(pipeline_layout.get_handle(), shader_stage, 0, stored_push_constants);
+		this->get_resource().pushConstants(pipeline_layout.get_handle(), shader_stage, 0, stored_push_constants_size, stored_push_constants.data());
 	}
 	else
 	{
-		LOGW("Push constant range [{}, {}] not found", 0, stored_push_constants.size());
+		LOGW("Push constant range [{}, {}] not found", 0, stored_push_constants_size);
 	}
 
-	stored_push_constants.clear();
+	stored_push_constants_size = 0;
 }
 
 template <vkb::BindingType bindingType>
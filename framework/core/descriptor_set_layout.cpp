@@ -1,4 +1,4 @@
-/* Copyright (c) 2019-2025, Arm Limited and Contributors
+/* Copyright (c) 2019-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -94,6 +94,36 @@ inline bool validate_flags(vkb::core::PhysicalDeviceC const                &gpu,
 
 	return true;
 }
+
+inline bool is_push_descriptor_supported(vkb::core::DeviceC &device, const std::vector<VkDescriptorSetLayoutBinding> &bindings)
+{
+	if (!device.is_extension_enabled(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME))
+	{
+		return false;
+	}
+
+	VkPhysicalDevicePushDescriptorPropertiesKHR push_descriptor_properties{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR};
+	VkPhysicalDeviceProperties2                 device_properties{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2};
+	device_properties.pNext = &push_descriptor_properties;
+	vkGetPhysicalDeviceProperties2(device.get_gpu().get_handle(), &device_properties);
+
+	uint32_t descriptor_count = 0;
+	for (auto &binding : bindings)
+	{
+		descriptor_count += binding.descriptorCount;
+	}
+
+	// Larger sets fall back to descriptor sets allocated from a pool
+	if (descriptor_count > push_descriptor_properties.maxPushDescriptors)
+	{
+		LOGW("Descriptor set with {} descriptors exceeds the push descriptor limit of {}, using a descriptor pool instead.",
+		     descriptor_count,
+		     push_descriptor_properties.maxPushDescriptors);
+		return false;
+	}
+
+	return true;
+}
 }        // namespace
 
 DescriptorSetLayout::DescriptorSetLayout(vkb::core::DeviceC                &device,
@@ -181,6 +211,24 @@ DescriptorSetLayout::DescriptorSetLayout(vkb::core::DeviceC                &devi
 		create_info.flags |= std::ranges::find(binding_flags, VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT) != binding_flags.end() ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT : 0;
 	}
 
+	// Handle push descriptors, requested by any resource of the set
+	if (std::ranges::find_if(resource_set,
+	                         [](const ShaderResource &shader_resource) { return shader_resource.mode == ShaderResourceMode::Push; }) != resource_set.end())
+	{
+		if (std::ranges::find_if(resource_set, [](const ShaderResource &shader_resource) {
+			    return shader_resource.mode == ShaderResourceMode::Dynamic || shader_resource.mode == ShaderResourceMode::UpdateAfterBind;
+		    }) != resource_set.end())
+		{
+			throw std::runtime_error("Cannot create descriptor set layout, dynamic and update-after-bind resources are not allowed in a push descriptor set.");
+		}
+
+		push_descriptor = is_push_descriptor_supported(device, bindings);
+		if (push_descriptor)
+		{
+			create_info.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+		}
+	}
+
 	// Create the Vulkan descriptor set layout handle
 	VkResult result = vkCreateDescriptorSetLayout(device.get_handle(), &create_info, nullptr, &handle);
 
@@ -199,7 +247,8 @@ DescriptorSetLayout::DescriptorSetLayout(DescriptorSetLayout &&other) :
     binding_flags{std::move(other.binding_flags)},
     bindings_lookup{std::move(other.bindings_lookup)},
     binding_flags_lookup{std::move(other.binding_flags_lookup)},
-    resources_lookup{std::move(other.resources_lookup)}
+    resources_lookup{std::move(other.resources_lookup)},
+    push_descriptor{other.push_descriptor}
 {
 	other.handle = VK_NULL_HANDLE;
 }
@@ -274,4 +323,8 @@ const std::vector<ShaderModule *> &DescriptorSetLayout::get_shader_modules() con
 	return shader_modules;
 }
 
+bool DescriptorSetLayout::is_push_descriptor() const
+{
+	return push_descriptor;
+}
 }        // namespace vkb
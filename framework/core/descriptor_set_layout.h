@@ -1,4 +1,4 @@
-/* Copyright (c) 2019-2025, Arm Limited and Contributors
+/* Copyright (c) 2019-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -79,6 +79,11 @@ class DescriptorSetLayout
 
 	const std::vector<ShaderModule *> &get_shader_modules() const;
 
+	/**
+	 * @return True if the set is pushed with vkCmdPushDescriptorSetKHR instead of being allocated from a pool
+	 */
+	bool is_push_descriptor() const;
+
   private:
 	vkb::core::DeviceC &device;
 
@@ -97,5 +102,7 @@ class DescriptorSetLayout
 	std::unordered_map<std::string, uint32_t> resources_lookup;
 
 	std::vector<ShaderModule *> shader_modules;
+
+	bool push_descriptor{false};
 };
 }        // namespace vkb
@@ -32,12 +32,21 @@ const VkExtent2D &Framebuffer::get_extent() const
 	return extent;
 }
 
+const std::vector<VkImageView> &Framebuffer::get_attachments() const
+{
+	return attachments;
+}
+
+VkRenderPass Framebuffer::get_render_pass_handle() const
+{
+	return render_pass_handle;
+}
+
 Framebuffer::Framebuffer(vkb::core::DeviceC &device, const vkb::rendering::RenderTargetC &render_target, const RenderPass &render_pass) :
     device{device},
-    extent{render_target.get_extent()}
+    extent{render_target.get_extent()},
+    render_pass_handle{render_pass.get_handle()}
 {
-	std::vector<VkImageView> attachments;
-
 	for (auto &view : render_target.get_views())
 	{
 		attachments.emplace_back(view.get_handle());
@@ -45,7 +54,7 @@ Framebuffer::Framebuffer(vkb::core::DeviceC &device, const vkb::rendering::Rende
 
 	VkFramebufferCreateInfo create_info{VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO};
 
-	create_info.renderPass      = render_pass.get_handle();
+	create_info.renderPass      = render_pass_handle;
 	create_info.attachmentCount = to_u32(attachments.size());
 	create_info.pAttachments    = attachments.data();
 	create_info.width           = extent.width;
@@ -63,7 +72,9 @@ Framebuffer::Framebuffer(vkb::core::DeviceC &device, const vkb::rendering::Rende
 Framebuffer::Framebuffer(Framebuffer &&other) :
     device{other.device},
     handle{other.handle},
-    extent{other.extent}
+    extent{other.extent},
+    attachments{std::move(other.attachments)},
+    render_pass_handle{other.render_pass_handle}
 {
 	other.handle = VK_NULL_HANDLE;
 }
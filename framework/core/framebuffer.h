@@ -57,11 +57,20 @@ class Framebuffer
 
 	const VkExtent2D &get_extent() const;
 
+	const std::vector<VkImageView> &get_attachments() const;
+
+	VkRenderPass get_render_pass_handle() const;
+
   private:
 	vkb::core::DeviceC &device;
 
 	VkFramebuffer handle{VK_NULL_HANDLE};
 
 	VkExtent2D extent{};
+
+	// Creation parameters, kept for the resource cache to match requests against
+	std::vector<VkImageView> attachments;
+
+	VkRenderPass render_pass_handle{VK_NULL_HANDLE};
 };
 }        // namespace vkb
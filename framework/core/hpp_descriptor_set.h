@@ -1,4 +1,4 @@
-/* Copyright (c) 2023-2025, NVIDIA CORPORATION. All rights reserved.
+/* Copyright (c) 2023-2026, NVIDIA CORPORATION. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -67,6 +67,12 @@ class HPPDescriptorSet : private vkb::DescriptorSet
 	{
 		return reinterpret_cast<vkb::core::HPPDescriptorSetLayout const &>(vkb::DescriptorSet::get_layout());
 	}
+
+	void reset(const BindingMap<vk::DescriptorBufferInfo> &new_buffer_infos = {}, const BindingMap<vk::DescriptorImageInfo> &new_image_infos = {})
+	{
+		vkb::DescriptorSet::reset(reinterpret_cast<BindingMap<VkDescriptorBufferInfo> const &>(new_buffer_infos),
+		                          reinterpret_cast<BindingMap<VkDescriptorImageInfo> const &>(new_image_infos));
+	}
 };
 }        // namespace core
 }        // namespace vkb
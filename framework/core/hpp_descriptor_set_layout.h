@@ -1,4 +1,4 @@
-/* Copyright (c) 2023-2025, NVIDIA CORPORATION. All rights reserved.
+/* Copyright (c) 2023-2026, NVIDIA CORPORATION. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -41,6 +41,7 @@ class HPPDescriptorSetLayout : private vkb::DescriptorSetLayout
 {
   public:
 	using vkb::DescriptorSetLayout::get_index;
+	using vkb::DescriptorSetLayout::is_push_descriptor;
 
   public:
 	HPPDescriptorSetLayout(vkb::core::DeviceCpp                            &device,
@@ -53,6 +54,11 @@ class HPPDescriptorSetLayout : private vkb::DescriptorSetLayout
 	                             reinterpret_cast<std::vector<vkb::ShaderResource> const &>(resource_set))
 	{}
 
+	const std::vector<vk::DescriptorSetLayoutBinding> &get_bindings() const
+	{
+		return reinterpret_cast<std::vector<vk::DescriptorSetLayoutBinding> const &>(vkb::DescriptorSetLayout::get_bindings());
+	}
+
 	vk::DescriptorSetLayout get_handle() const
 	{
 		return static_cast<vk::DescriptorSetLayout>(vkb::DescriptorSetLayout::get_handle());
@@ -1,4 +1,4 @@
-/* Copyright (c) 2023-2025, NVIDIA CORPORATION. All rights reserved.
+/* Copyright (c) 2023-2026, NVIDIA CORPORATION. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -85,6 +85,12 @@ HPPPipelineLayout::HPPPipelineLayout(vkb::core::DeviceCpp &device, const std::ve
 		    &device.get_resource_cache().request_descriptor_set_layout(shader_set_it.first, shader_modules, shader_set_it.second));
 	}
 
+	// Only one set of a pipeline layout can use push descriptors
+	if (std::ranges::count_if(descriptor_set_layouts, [](const vkb::core::HPPDescriptorSetLayout *layout) { return layout->is_push_descriptor(); }) > 1)
+	{
+		throw std::runtime_error("Cannot create HPPPipelineLayout, only one descriptor set can use push descriptors.");
+	}
+
 	// Collect all the descriptor set layout handles, maintaining set order
 	std::vector<vk::DescriptorSetLayout> descriptor_set_layout_handles;
 	for (auto descriptor_set_layout : descriptor_set_layouts)
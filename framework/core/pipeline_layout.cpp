@@ -1,4 +1,4 @@
-/* Copyright (c) 2019-2025, Arm Limited and Contributors
+/* Copyright (c) 2019-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -85,6 +85,12 @@ PipelineLayout::PipelineLayout(vkb::core::DeviceC &device, const std::vector<Sha
 		descriptor_set_layouts.emplace_back(&device.get_resource_cache().request_descriptor_set_layout(shader_set_it.first, shader_modules, shader_set_it.second));
 	}
 
+	// Only one set of a pipeline layout can use push descriptors
+	if (std::ranges::count_if(descriptor_set_layouts, [](const DescriptorSetLayout *layout) { return layout->is_push_descriptor(); }) > 1)
+	{
+		throw std::runtime_error("Cannot create PipelineLayout, only one descriptor set can use push descriptors.");
+	}
+
 	// Collect all the descriptor set layout handles, maintaining set order
 	std::vector<VkDescriptorSetLayout> descriptor_set_layout_handles;
 	for (uint32_t i = 0; i < descriptor_set_layouts.size(); ++i)
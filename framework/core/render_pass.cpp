@@ -515,6 +515,9 @@ RenderPass::RenderPass(vkb::core::DeviceC                             &device,
                        const std::vector<LoadStoreInfo>               &load_store_infos,
                        const std::vector<SubpassInfo>                 &subpasses) :
     VulkanResource{VK_NULL_HANDLE, &device}, subpass_count{std::max<size_t>(1, subpasses.size())},        // At least 1 subpass
+    attachments{attachments},
+    load_store_infos{load_store_infos},
+    subpasses{subpasses},
     color_output_count{}
 {
 	if (device.is_extension_enabled(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME))
@@ -532,6 +535,9 @@ RenderPass::RenderPass(vkb::core::DeviceC                             &device,
 RenderPass::RenderPass(RenderPass &&other) :
     VulkanResource{std::move(other)},
     subpass_count{other.subpass_count},
+    attachments{std::move(other.attachments)},
+    load_store_infos{std::move(other.load_store_infos)},
+    subpasses{std::move(other.subpasses)},
     color_output_count{other.color_output_count}
 {}
 
@@ -556,4 +562,19 @@ VkExtent2D RenderPass::get_render_area_granularity() const
 
 	return render_area_granularity;
 }
+
+const std::vector<vkb::rendering::AttachmentC> &RenderPass::get_attachments() const
+{
+	return attachments;
+}
+
+const std::vector<LoadStoreInfo> &RenderPass::get_load_store_infos() const
+{
+	return load_store_infos;
+}
+
+const std::vector<SubpassInfo> &RenderPass::get_subpasses() const
+{
+	return subpasses;
+}
 }        // namespace vkb
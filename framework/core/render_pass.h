@@ -74,9 +74,20 @@ class RenderPass : public vkb::core::VulkanResourceC<VkRenderPass>
 
 	VkExtent2D get_render_area_granularity() const;
 
+	const std::vector<vkb::rendering::AttachmentC> &get_attachments() const;
+
+	const std::vector<LoadStoreInfo> &get_load_store_infos() const;
+
+	const std::vector<SubpassInfo> &get_subpasses() const;
+
   private:
 	size_t subpass_count;
 
+	// Creation parameters, kept for the resource cache to match requests against
+	std::vector<vkb::rendering::AttachmentC> attachments;
+	std::vector<LoadStoreInfo>               load_store_infos;
+	std::vector<SubpassInfo>                 subpasses;
+
 	template <typename T_SubpassDescription, typename T_AttachmentDescription, typename T_AttachmentReference, typename T_SubpassDependency, typename T_RenderPassCreateInfo>
 	void create_renderpass(const std::vector<vkb::rendering::AttachmentC> &attachments, const std::vector<LoadStoreInfo> &load_store_infos, const std::vector<SubpassInfo> &subpasses);
 
@@ -1,4 +1,4 @@
-/* Copyright (c) 2019-2025, Arm Limited and Contributors
+/* Copyright (c) 2019-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -17,6 +17,7 @@
 
 #include "shader_module.h"
 
+#include "core/util/hash.hpp"
 #include "core/util/logging.hpp"
 #include "device.h"
 #include "filesystem/legacy.h"
@@ -29,31 +30,37 @@ ShaderModule::ShaderModule(vkb::core::DeviceC   &device,
                            const ShaderSource   &shader_source,
                            const std::string    &entry_point,
                            const ShaderVariant  &shader_variant) :
-    device{device}, stage{stage}, entry_point{entry_point}
+    device{device}, source_id{shader_source.get_id()}, variant_id{shader_variant.get_id()}, stage{stage}, entry_point{entry_point}
 {
 	debug_name = fmt::format("{} [variant {:X}] [entrypoint {}]", shader_source.get_filename(), shader_variant.get_id(), entry_point);
 
 	// Shaders in binary SPIR-V format can be loaded directly
 	spirv = vkb::fs::read_shader_binary_u32(shader_source.get_filename());
 
-	// Reflection is used to dynamically create descriptor bindings
-
-	SPIRVReflection spirv_reflection;
-	// Reflect all shader resources
-	if (!spirv_reflection.reflect_shader_resources(stage, spirv, resources, shader_variant))
+	// Reflection is used to dynamically create descriptor bindings, its results are cached per variant in memory and on disk
+	auto &reflection_cache = SPIRVReflectionCache::get();
+	auto  reflection_key   = SPIRVReflectionCache::get_key(stage, spirv, shader_variant);
+	if (!reflection_cache.find(reflection_key, resources))
 	{
-		throw VulkanException{VK_ERROR_INITIALIZATION_FAILED};
+		SPIRVReflection spirv_reflection;
+		// Reflect all shader resources
+		if (!spirv_reflection.reflect_shader_resources(stage, spirv, resources, shader_variant))
+		{
+			throw VulkanException{VK_ERROR_INITIALIZATION_FAILED};
+		}
+
+		reflection_cache.insert(reflection_key, resources);
 	}
 
 	// Generate a unique id, determined by source and variant
-	std::hash<std::string> hasher{};
-	id = hasher(std::string{reinterpret_cast<const char *>(spirv.data()),
-	                        reinterpret_cast<const char *>(spirv.data() + spirv.size())});
+	id = static_cast<size_t>(hash_bytes(spirv.data(), spirv.size() * sizeof(uint32_t)));
 }
 
 ShaderModule::ShaderModule(ShaderModule &&other) :
     device{other.device},
     id{other.id},
+    source_id{other.source_id},
+    variant_id{other.variant_id},
     stage{other.stage},
     entry_point{other.entry_point},
     debug_name{other.debug_name},
@@ -68,6 +75,16 @@ size_t ShaderModule::get_id() const
 	return id;
 }
 
+size_t ShaderModule::get_source_id() const
+{
+	return source_id;
+}
+
+size_t ShaderModule::get_variant_id() const
+{
+	return variant_id;
+}
+
 VkShaderStageFlagBits ShaderModule::get_stage() const
 {
 	return stage;
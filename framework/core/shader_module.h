@@ -1,4 +1,4 @@
-/* Copyright (c) 2019-2025, Arm Limited and Contributors
+/* Copyright (c) 2019-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -55,7 +55,8 @@ enum class ShaderResourceMode
 {
 	Static,
 	Dynamic,
-	UpdateAfterBind
+	UpdateAfterBind,
+	Push        // The whole set of the resource is pushed with vkCmdPushDescriptorSetKHR, if VK_KHR_push_descriptor is enabled
 };
 
 /// A bitmask of qualifiers applied to a resource
@@ -186,6 +187,10 @@ class ShaderModule
 
 	size_t get_id() const;
 
+	size_t get_source_id() const;
+
+	size_t get_variant_id() const;
+
 	VkShaderStageFlagBits get_stage() const;
 
 	const std::string &get_entry_point() const;
@@ -217,6 +222,11 @@ class ShaderModule
 	/// Shader unique id
 	size_t id;
 
+	/// Ids of the source and the variant the module was created from, which the resource cache matches requests against
+	size_t source_id;
+
+	size_t variant_id;
+
 	/// Stage of the shader (vertex, fragment, etc)
 	VkShaderStageFlagBits stage{};
 
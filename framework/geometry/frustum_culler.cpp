@@ -0,0 +1,215 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "frustum_culler.h"
+
+#include <array>
+#include <cmath>
+
+#include "common/job_system.h"
+#include "core/util/profiling.hpp"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#	include <xmmintrin.h>
+#	define VKB_FRUSTUM_CULLER_SSE
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#	include <arm_neon.h>
+#	define VKB_FRUSTUM_CULLER_NEON
+#endif
+
+namespace vkb
+{
+std::atomic<uint32_t> FrustumCuller::total_culled{0};
+std::atomic<uint32_t> FrustumCuller::total_visible{0};
+
+size_t FrustumCuller::add(const glm::vec3 &min, const glm::vec3 &max, const glm::mat4 &world_matrix)
+{
+	glm::vec3 center = (min + max) * 0.5f;
+	glm::vec3 extent = (max - min) * 0.5f;
+
+	// The extent of the transformed box along an axis is the extent projected on that axis by the absolute matrix
+	glm::vec3 world_center = glm::vec3(world_matrix * glm::vec4(center, 1.0f));
+	glm::vec3 world_extent = glm::abs(glm::vec3(world_matrix[0])) * extent.x +
+	                         glm::abs(glm::vec3(world_matrix[1])) * extent.y +
+	                         glm::abs(glm::vec3(world_matrix[2])) * extent.z;
+
+	center_x.push_back(world_center.x);
+	center_y.push_back(world_center.y);
+	center_z.push_back(world_center.z);
+	extent_x.push_back(world_extent.x);
+	extent_y.push_back(world_extent.y);
+	extent_z.push_back(world_extent.z);
+
+	return center_x.size() - 1;
+}
+
+void FrustumCuller::clear()
+{
+	center_x.clear();
+	center_y.clear();
+	center_z.clear();
+	extent_x.clear();
+	extent_y.clear();
+	extent_z.clear();
+	visible.clear();
+}
+
+size_t FrustumCuller::cull(const Frustum &frustum, bool allow_parallel)
+{
+	PROFILE_SCOPE("Frustum Cull");
+
+	size_t count = center_x.size();
+
+	// Pad to a whole number of SIMD batches, the padding is never reported
+	size_t padded_count = (count + 3) & ~size_t{3};
+	for (auto *component : {&center_x, &center_y, &center_z, &extent_x, &extent_y, &extent_z})
+	{
+		component->resize(padded_count, 0.0f);
+	}
+	visible.resize(padded_count);
+
+	if (allow_parallel && 2 * PARALLEL_GRAIN_SIZE <= padded_count)
+	{
+		JobSystem::get().parallel_for(padded_count, PARALLEL_GRAIN_SIZE, [this, &frustum](size_t begin, size_t end) { cull_range(frustum, begin, end); });
+	}
+	else
+	{
+		cull_range(frustum, 0, padded_count);
+	}
+
+	for (auto *component : {&center_x, &center_y, &center_z, &extent_x, &extent_y, &extent_z})
+	{
+		component->resize(count);
+	}
+	visible.resize(count);
+
+	size_t visible_count = 0;
+	for (auto is_visible : visible)
+	{
+		visible_count += is_visible;
+	}
+
+	total_visible.fetch_add(static_cast<uint32_t>(visible_count), std::memory_order_relaxed);
+	total_culled.fetch_add(static_cast<uint32_t>(count - visible_count), std::memory_order_relaxed);
+
+	return visible_count;
+}
+
+void FrustumCuller::cull_range(const Frustum &frustum, size_t begin, size_t end)
+{
+	// A box is outside if it is entirely behind any of the planes, that is if the distance of its center to the
+	// plane is less than the extent of the box projected on the plane normal
+	auto const &planes = frustum.get_planes();
+
+#if defined(VKB_FRUSTUM_CULLER_SSE)
+	struct SimdPlane
+	{
+		__m128 x, y, z, w;
+		__m128 abs_x, abs_y, abs_z;
+	};
+	std::array<SimdPlane, 6> simd_planes;
+	for (size_t p = 0; p < planes.size(); ++p)
+	{
+		simd_planes[p] = {_mm_set1_ps(planes[p].x), _mm_set1_ps(planes[p].y), _mm_set1_ps(planes[p].z), _mm_set1_ps(planes[p].w),
+		                  _mm_set1_ps(std::abs(planes[p].x)), _mm_set1_ps(std::abs(planes[p].y)), _mm_set1_ps(std::abs(planes[p].z))};
+	}
+
+	__m128 zero = _mm_setzero_ps();
+	for (size_t i = begin; i < end; i += 4)
+	{
+		__m128 cx = _mm_loadu_ps(&center_x[i]);
+		__m128 cy = _mm_loadu_ps(&center_y[i]);
+		__m128 cz = _mm_loadu_ps(&center_z[i]);
+		__m128 ex = _mm_loadu_ps(&extent_x[i]);
+		__m128 ey = _mm_loadu_ps(&extent_y[i]);
+		__m128 ez = _mm_loadu_ps(&extent_z[i]);
+
+		__m128 outside = zero;
+		for (auto const &plane : simd_planes)
+		{
+			__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(plane.x, cx), _mm_mul_ps(plane.y, cy)), _mm_add_ps(_mm_mul_ps(plane.z, cz), plane.w));
+			__m128 radius   = _mm_add_ps(_mm_add_ps(_mm_mul_ps(plane.abs_x, ex), _mm_mul_ps(plane.abs_y, ey)), _mm_mul_ps(plane.abs_z, ez));
+			outside         = _mm_or_ps(outside, _mm_cmple_ps(_mm_add_ps(distance, radius), zero));
+		}
+
+		int outside_mask = _mm_movemask_ps(outside);
+		for (size_t lane = 0; lane < 4; ++lane)
+		{
+			visible[i + lane] = ((outside_mask >> lane) & 1) == 0;
+		}
+	}
+#elif defined(VKB_FRUSTUM_CULLER_NEON)
+	float32x4_t zero = vdupq_n_f32(0.0f);
+	for (size_t i = begin; i < end; i += 4)
+	{
+		float32x4_t cx = vld1q_f32(&center_x[i]);
+		float32x4_t cy = vld1q_f32(&center_y[i]);
+		float32x4_t cz = vld1q_f32(&center_z[i]);
+		float32x4_t ex = vld1q_f32(&extent_x[i]);
+		float32x4_t ey = vld1q_f32(&extent_y[i]);
+		float32x4_t ez = vld1q_f32(&extent_z[i]);
+
+		uint32x4_t outside = vdupq_n_u32(0);
+		for (auto const &plane : planes)
+		{
+			float32x4_t distance = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(plane.w), cx, plane.x), cy, plane.y), cz, plane.z);
+			float32x4_t radius   = vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(ex, std::abs(plane.x)), ey, std::abs(plane.y)), ez, std::abs(plane.z));
+			outside              = vorrq_u32(outside, vcleq_f32(vaddq_f32(distance, radius), zero));
+		}
+
+		uint32_t outside_lanes[4];
+		vst1q_u32(outside_lanes, outside);
+		for (size_t lane = 0; lane < 4; ++lane)
+		{
+			visible[i + lane] = outside_lanes[lane] == 0;
+		}
+	}
+#else
+	for (size_t i = begin; i < end; ++i)
+	{
+		bool outside = false;
+		for (auto const &plane : planes)
+		{
+			float distance = plane.x * center_x[i] + plane.y * center_y[i] + plane.z * center_z[i] + plane.w;
+			float radius   = std::abs(plane.x) * extent_x[i] + std::abs(plane.y) * extent_y[i] + std::abs(plane.z) * extent_z[i];
+			outside |= distance + radius <= 0.0f;
+		}
+		visible[i] = !outside;
+	}
+#endif
+}
+
+glm::vec3 FrustumCuller::get_center(size_t index) const
+{
+	return glm::vec3(center_x[index], center_y[index], center_z[index]);
+}
+
+bool FrustumCuller::is_visible(size_t index) const
+{
+	return visible[index] != 0;
+}
+
+FrustumCuller::Counters FrustumCuller::reset_counters()
+{
+	return Counters{total_visible.exchange(0, std::memory_order_relaxed), total_culled.exchange(0, std::memory_order_relaxed)};
+}
+
+size_t FrustumCuller::size() const
+{
+	return center_x.size();
+}
+}        // namespace vkb
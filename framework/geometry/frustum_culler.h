@@ -0,0 +1,103 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "common/glm_common.h"
+#include "geometry/frustum.h"
+
+namespace vkb
+{
+/**
+ * @brief Tests a batch of bounding boxes against a frustum.
+ *
+ * The boxes are transformed to world space as they are added, and stored as centers and extents in separate
+ * arrays per component, so that the frustum test runs on four boxes at a time with SSE or NEON. Large batches are
+ * split across the job system.
+ *
+ * All cullers count the boxes they test, so the results can be reported by a stats provider.
+ */
+class FrustumCuller
+{
+  public:
+	struct Counters
+	{
+		uint32_t visible{0};
+		uint32_t culled{0};
+	};
+
+  public:
+	/**
+	 * @brief Adds an axis aligned bounding box
+	 * @param min The minimum corner of the box in local space
+	 * @param max The maximum corner of the box in local space
+	 * @param world_matrix The affine transform from local to world space
+	 * @return The index of the box
+	 */
+	size_t add(const glm::vec3 &min, const glm::vec3 &max, const glm::mat4 &world_matrix);
+
+	/**
+	 * @brief Removes all the boxes, keeping the storage for the next batch
+	 */
+	void clear();
+
+	/**
+	 * @brief Tests all the boxes against the frustum
+	 * @param frustum The frustum, with normalized planes
+	 * @param allow_parallel Split large batches across the job system
+	 * @return The number of visible boxes
+	 */
+	size_t cull(const Frustum &frustum, bool allow_parallel = true);
+
+	/**
+	 * @return The center of a box in world space
+	 */
+	glm::vec3 get_center(size_t index) const;
+
+	/**
+	 * @return True if the box at the given index intersects the frustum, only valid after cull
+	 */
+	bool is_visible(size_t index) const;
+
+	/**
+	 * @brief Returns the visible and culled counts of all cullers since the last call and resets them
+	 */
+	static Counters reset_counters();
+
+	size_t size() const;
+
+  private:
+	static constexpr size_t PARALLEL_GRAIN_SIZE = 4096;
+
+	void cull_range(const Frustum &frustum, size_t begin, size_t end);
+
+  private:
+	std::vector<float>   center_x;
+	std::vector<float>   center_y;
+	std::vector<float>   center_z;
+	std::vector<float>   extent_x;
+	std::vector<float>   extent_y;
+	std::vector<float>   extent_z;
+	std::vector<uint8_t> visible;
+
+	static std::atomic<uint32_t> total_culled;
+	static std::atomic<uint32_t> total_visible;
+};
+}        // namespace vkb
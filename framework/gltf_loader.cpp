@@ -19,6 +19,8 @@
 #define TINYGLTF_IMPLEMENTATION
 #include "gltf_loader.h"
 
+#include <atomic>
+#include <cstring>
 #include <future>
 #include <limits>
 #include <queue>
@@ -31,6 +33,7 @@
 #include <core/util/profiling.hpp>
 
 #include "api_vulkan_sample.h"
+#include "common/job_system.h"
 #include "common/utils.h"
 #include "common/vk_common.h"
 #include "core/device.h"
@@ -45,6 +48,7 @@
 #include "scene_graph/components/pbr_material.h"
 #include "scene_graph/components/perspective_camera.h"
 #include "scene_graph/components/sampler.h"
+#include "scene_graph/components/skin.h"
 #include "scene_graph/components/sub_mesh.h"
 #include "scene_graph/components/texture.h"
 #include "scene_graph/components/transform.h"
@@ -132,20 +136,107 @@ inline std::vector<uint8_t> get_attribute_data(const tinygltf::Model *model, uin
 	return {buffer.data.begin() + startByte, buffer.data.begin() + endByte};
 };
 
-inline size_t get_attribute_size(const tinygltf::Model *model, uint32_t accessorId)
+/**
+ * @brief Reads the elements of an accessor with up to four components as vectors of floats, applying sparse substitutions
+ *        Normalized integer components are mapped to [0, 1] or [-1, 1], other integers such as joint indices keep their value
+ */
+inline std::vector<glm::vec4> read_accessor_vec4(const tinygltf::Model &model, int accessor_id)
 {
-	assert(accessorId < model->accessors.size());
-	return model->accessors[accessorId].count;
-};
+	assert(0 <= accessor_id && accessor_id < model.accessors.size());
+	auto &accessor = model.accessors[accessor_id];
+
+	size_t component_count = std::min(tinygltf::GetNumComponentsInType(accessor.type), 4);
+	size_t component_size  = tinygltf::GetComponentSizeInBytes(accessor.componentType);
+
+	auto read_component = [&accessor](const uint8_t *data) -> float {
+		switch (accessor.componentType)
+		{
+			case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+				return accessor.normalized ? *data / 255.0f : *data;
+			case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+			{
+				uint16_t value;
+				std::memcpy(&value, data, sizeof(value));
+				return accessor.normalized ? value / 65535.0f : value;
+			}
+			case TINYGLTF_COMPONENT_TYPE_BYTE:
+			{
+				int8_t value = static_cast<int8_t>(*data);
+				return accessor.normalized ? std::max(value / 127.0f, -1.0f) : value;
+			}
+			case TINYGLTF_COMPONENT_TYPE_SHORT:
+			{
+				int16_t value;
+				std::memcpy(&value, data, sizeof(value));
+				return accessor.normalized ? std::max(value / 32767.0f, -1.0f) : value;
+			}
+			case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+			{
+				uint32_t value;
+				std::memcpy(&value, data, sizeof(value));
+				return static_cast<float>(value);
+			}
+			case TINYGLTF_COMPONENT_TYPE_FLOAT:
+			{
+				float value;
+				std::memcpy(&value, data, sizeof(value));
+				return value;
+			}
+			default:
+				return 0.0f;
+		}
+	};
+
+	auto read_element = [&](const uint8_t *data) {
+		glm::vec4 element{0.0f};
+		for (size_t c = 0; c < component_count; ++c)
+		{
+			element[static_cast<glm::length_t>(c)] = read_component(data + c * component_size);
+		}
+		return element;
+	};
+
+	// Without a buffer view the elements are zeros, which is how morph targets usually store sparse offsets
+	std::vector<glm::vec4> elements(accessor.count, glm::vec4{0.0f});
+	if (0 <= accessor.bufferView)
+	{
+		auto          &buffer_view = model.bufferViews[accessor.bufferView];
+		const uint8_t *data        = model.buffers[buffer_view.buffer].data.data() + buffer_view.byteOffset + accessor.byteOffset;
+		size_t         stride      = accessor.ByteStride(buffer_view);
+		for (size_t i = 0; i < accessor.count; ++i)
+		{
+			elements[i] = read_element(data + i * stride);
+		}
+	}
+
+	if (accessor.sparse.isSparse)
+	{
+		auto          &indices_view = model.bufferViews[accessor.sparse.indices.bufferView];
+		auto          &values_view  = model.bufferViews[accessor.sparse.values.bufferView];
+		const uint8_t *indices      = model.buffers[indices_view.buffer].data.data() + indices_view.byteOffset + accessor.sparse.indices.byteOffset;
+		const uint8_t *values       = model.buffers[values_view.buffer].data.data() + values_view.byteOffset + accessor.sparse.values.byteOffset;
+		size_t         index_size   = tinygltf::GetComponentSizeInBytes(accessor.sparse.indices.componentType);
+		size_t         value_size   = tinygltf::GetNumComponentsInType(accessor.type) * component_size;
 
-inline size_t get_attribute_stride(const tinygltf::Model *model, uint32_t accessorId)
+		for (int i = 0; i < accessor.sparse.count; ++i)
+		{
+			// Indices are little-endian unsigned integers of up to 4 bytes
+			uint32_t index = 0;
+			std::memcpy(&index, indices + i * index_size, index_size);
+			if (index < elements.size())
+			{
+				elements[index] = read_element(values + i * value_size);
+			}
+		}
+	}
+
+	return elements;
+}
+
+inline size_t get_attribute_size(const tinygltf::Model *model, uint32_t accessorId)
 {
 	assert(accessorId < model->accessors.size());
-	auto &accessor = model->accessors[accessorId];
-	assert(accessor.bufferView < model->bufferViews.size());
-	auto &bufferView = model->bufferViews[accessor.bufferView];
-
-	return accessor.ByteStride(bufferView);
+	return model->accessors[accessorId].count;
 };
 
 inline VkFormat get_attribute_format(const tinygltf::Model *model, uint32_t accessorId)
@@ -268,23 +359,7 @@ inline VkFormat get_attribute_format(const tinygltf::Model *model, uint32_t acce
 	return format;
 };
 
-inline std::vector<uint8_t> convert_underlying_data_stride(const std::vector<uint8_t> &src_data, uint32_t src_stride, uint32_t dst_stride)
-{
-	auto elem_count = to_u32(src_data.size()) / src_stride;
-
-	std::vector<uint8_t> result(elem_count * dst_stride);
-
-	for (uint32_t idxSrc = 0, idxDst = 0;
-	     idxSrc < src_data.size() && idxDst < result.size();
-	     idxSrc += src_stride, idxDst += dst_stride)
-	{
-		std::copy(src_data.begin() + idxSrc, src_data.begin() + idxSrc + src_stride, result.begin() + idxDst);
-	}
-
-	return result;
-}
-
-inline void upload_image_to_gpu(vkb::core::CommandBufferC &command_buffer, vkb::core::BufferC &staging_buffer, sg::Image &image)
+inline void upload_image_to_gpu(vkb::core::CommandBufferC &command_buffer, vkb::core::BufferC &staging_buffer, sg::Image &image, VkDeviceSize staging_offset = 0)
 {
 	// Clean up the image data, as they are copied in the staging buffer
 	image.clear_data();
@@ -311,7 +386,7 @@ inline void upload_image_to_gpu(vkb::core::CommandBufferC &command_buffer, vkb::
 		auto &mipmap      = mipmaps[i];
 		auto &copy_region = buffer_copy_regions[i];
 
-		copy_region.bufferOffset     = mipmap.offset;
+		copy_region.bufferOffset     = staging_offset + mipmap.offset;
 		copy_region.imageSubresource = image.get_vk_image_view().get_subresource_layers();
 		// Update miplevel
 		copy_region.imageSubresource.mipLevel = mipmap.level;
@@ -397,6 +472,95 @@ static inline bool texture_needs_srgb_colorspace(const std::string &name)
 	return false;
 }
 
+// Size of the staging buffers images are uploaded through
+constexpr VkDeviceSize STAGING_BATCH_SIZE = 64 * 1024 * 1024;
+
+// Images are packed in a staging buffer at offsets that are a multiple of every texel block size (1, 2, 3, 4, 6, 8, 12 and 16 bytes)
+constexpr VkDeviceSize STAGING_OFFSET_ALIGNMENT = 48;
+
+/**
+ * @brief A staging buffer together with the command buffer copying out of it, and the fence of its last submission
+ */
+struct StagingBatch
+{
+	std::unique_ptr<vkb::core::BufferC>        buffer;
+	std::shared_ptr<vkb::core::CommandBufferC> command_buffer;
+	std::vector<vkb::core::BufferC>            dedicated_buffers;        // Staging buffers of images too large for the batch buffer
+	VkFence                                    fence  = VK_NULL_HANDLE;
+	VkDeviceSize                               offset = 0;
+};
+
+/**
+ * @brief Runs a function over a range of indices on the job system
+ *
+ * Indices are queued in increasing order, and each result is handed out through its own future, so that a
+ * consumer can process results in order while later ones are still being computed. The destructor skips the
+ * indices that have not started yet and waits for the others.
+ */
+template <typename T>
+class WorkQueue
+{
+  public:
+	template <typename Func>
+	WorkQueue(size_t count, Func function) :
+	    func{function}, promises(count)
+	{
+		for (auto &promise : promises)
+		{
+			futures.push_back(promise.get_future());
+		}
+
+		for (size_t index = 0; index < count; ++index)
+		{
+			vkb::JobSystem::get().submit(group, [this, index]() {
+				if (cancelled.load(std::memory_order_relaxed))
+				{
+					return;
+				}
+				try
+				{
+					promises[index].set_value(func(index));
+				}
+				catch (...)
+				{
+					promises[index].set_exception(std::current_exception());
+				}
+			});
+		}
+	}
+
+	WorkQueue(const WorkQueue &)            = delete;
+	WorkQueue(WorkQueue &&)                 = delete;
+	WorkQueue &operator=(const WorkQueue &) = delete;
+	WorkQueue &operator=(WorkQueue &&)      = delete;
+
+	~WorkQueue()
+	{
+		cancelled = true;
+		vkb::JobSystem::get().wait(group);
+	}
+
+	/**
+	 * @brief Waits for the result at the given index, rethrowing any exception of the function
+	 */
+	T get(size_t index)
+	{
+		// Blocking rather than helping, as the calling thread would pick up the most recently queued index first
+		return futures[index].get();
+	}
+
+	size_t get_worker_count() const
+	{
+		return std::max<size_t>(vkb::JobSystem::get().get_thread_count() - 1, 1);
+	}
+
+  private:
+	std::atomic<bool>            cancelled{false};
+	std::function<T(size_t)>     func;
+	std::vector<std::future<T>>  futures;
+	vkb::JobSystem::TaskGroup    group;
+	std::vector<std::promise<T>> promises;
+};
 }        // namespace
 
 std::unordered_map<std::string, bool> GLTFLoader::supported_extensions = {
@@ -552,76 +716,126 @@ vkb::scene_graph::SceneC GLTFLoader::load_scene(int scene_index, VkBufferUsageFl
 	// Load images
 	auto image_count = to_u32(model.images.size());
 
-	std::vector<std::future<std::unique_ptr<sg::Image>>> image_component_futures;
-	for (size_t image_index = 0; image_index < image_count; image_index++)
-	{
-		image_component_futures.push_back(std::async(
-		    [this, image_index]() {
-			    auto image = parse_image(model.images[image_index]);
+	// Decode on a bounded set of workers, while this thread stages and uploads the images in order as they complete
+	std::atomic<double> decode_time{0.0};
 
-			    LOGI("Loaded gltf image #{} ({})", image_index, model.images[image_index].uri.c_str());
+	WorkQueue<std::unique_ptr<sg::Image>> image_decode_queue(image_count, [this, &decode_time](size_t image_index) {
+		Timer decode_timer;
+		decode_timer.start();
 
-			    return image;
-		    }));
-	}
+		auto image = parse_image(model.images[image_index]);
 
-	std::vector<std::unique_ptr<sg::Image>> image_components;
+		decode_time.fetch_add(decode_timer.stop());
+		LOGI("Loaded gltf image #{} ({})", image_index, model.images[image_index].uri.c_str());
 
-	// Upload images to GPU. We do this in batches of 64MB of data to avoid needing
-	// double the amount of memory (all the images and all the corresponding buffers).
-	// This helps keep memory footprint lower which is helpful on smaller devices.
-	size_t image_index = 0;
-	while (image_index < image_count)
-	{
-		std::vector<vkb::core::BufferC> transient_buffers;
+		return image;
+	});
 
-		auto command_buffer = device.get_command_pool().request_command_buffer();
+	std::vector<std::unique_ptr<sg::Image>> image_components;
 
-		command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, 0);
+	// Upload images to GPU. Image data is copied into one of two persistently mapped staging buffers of 64MB, so that
+	// the next batch can be staged while the GPU copies the previous one, and memory footprint stays low on smaller
+	// devices. Images larger than a staging buffer get a dedicated one.
+	std::array<StagingBatch, 2> staging_batches;
+	size_t                      batch_index = 0;
 
-		size_t batch_size = 0;
+	double wait_decode_time = 0.0;
+	double staging_time     = 0.0;
+	double wait_upload_time = 0.0;
 
-		// Deal with 64MB of image data at a time to keep memory footprint low
-		while (image_index < image_count && batch_size < 64 * 1024 * 1024)
-		{
-			// Wait for this image to complete loading, then stage for upload
-			image_components.push_back(image_component_futures[image_index].get());
+	auto &queue = device.get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT, 0);
 
-			auto &image = image_components[image_index];
+	// Waits for the previous use of a batch to complete on the GPU, and starts recording it again
+	auto begin_batch = [&](StagingBatch &batch) {
+		if (batch.fence != VK_NULL_HANDLE)
+		{
+			Timer wait_timer;
+			wait_timer.start();
+			VK_CHECK(vkWaitForFences(device.get_handle(), 1, &batch.fence, VK_TRUE, std::numeric_limits<uint64_t>::max()));
+			wait_upload_time += wait_timer.stop();
+		}
+		if (!batch.buffer)
+		{
+			batch.buffer = std::make_unique<vkb::core::BufferC>(vkb::core::BufferC::create_staging_buffer(device, STAGING_BATCH_SIZE, nullptr));
+		}
+		batch.fence  = VK_NULL_HANDLE;
+		batch.offset = 0;
+		batch.dedicated_buffers.clear();
+		batch.command_buffer = device.get_command_pool().request_command_buffer();
+		batch.command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, 0);
+	};
 
-			core::Buffer stage_buffer = vkb::core::BufferC::create_staging_buffer(device, image->get_data());
+	auto submit_batch = [&](StagingBatch &batch) {
+		batch.command_buffer->end();
+		batch.fence = device.get_fence_pool().request_fence();
+		queue.submit(*batch.command_buffer, batch.fence);
+	};
 
-			batch_size += image->get_data().size();
+	if (0 < image_count)
+	{
+		begin_batch(staging_batches[batch_index]);
+	}
 
-			upload_image_to_gpu(*command_buffer, stage_buffer, *image);
+	for (size_t image_index = 0; image_index < image_count; image_index++)
+	{
+		// Wait for this image to complete decoding, then stage it for upload
+		Timer stage_timer;
+		stage_timer.start();
+		image_components.push_back(image_decode_queue.get(image_index));
+		wait_decode_time += stage_timer.stop();
 
-			transient_buffers.push_back(std::move(stage_buffer));
+		stage_timer.start();
+		auto &image     = image_components[image_index];
+		auto  data_size = image->get_data().size();
 
-			image_index++;
+		if (STAGING_BATCH_SIZE < data_size)
+		{
+			auto &batch = staging_batches[batch_index];
+			batch.dedicated_buffers.push_back(vkb::core::BufferC::create_staging_buffer(device, image->get_data()));
+			upload_image_to_gpu(*batch.command_buffer, batch.dedicated_buffers.back(), *image);
 		}
+		else
+		{
+			VkDeviceSize offset = (staging_batches[batch_index].offset + STAGING_OFFSET_ALIGNMENT - 1) / STAGING_OFFSET_ALIGNMENT * STAGING_OFFSET_ALIGNMENT;
+			if (STAGING_BATCH_SIZE < offset + data_size)
+			{
+				// This batch is full, hand it to the GPU and continue with the other one
+				submit_batch(staging_batches[batch_index]);
+				batch_index = (batch_index + 1) % staging_batches.size();
+				begin_batch(staging_batches[batch_index]);
+				offset = 0;
+			}
 
-		command_buffer->end();
-
-		auto &queue = device.get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT, 0);
+			auto &batch = staging_batches[batch_index];
+			batch.buffer->update(image->get_data(), offset);
+			batch.offset = offset + data_size;
+			upload_image_to_gpu(*batch.command_buffer, *batch.buffer, *image, offset);
+		}
+		staging_time += stage_timer.stop();
+	}
 
-		queue.submit(*command_buffer, device.get_fence_pool().request_fence());
+	if (0 < image_count)
+	{
+		submit_batch(staging_batches[batch_index]);
+	}
 
-		device.get_fence_pool().wait();
-		device.get_fence_pool().reset();
-		device.get_command_pool().reset_pool();
-		device.wait_idle();
+	Timer wait_timer;
+	wait_timer.start();
+	device.get_fence_pool().wait();
+	device.get_fence_pool().reset();
+	device.get_command_pool().reset_pool();
+	wait_upload_time += wait_timer.stop();
 
-		// Remove the staging buffers for the batch we just processed
-		transient_buffers.clear();
-	}
+	// Release the staging buffers once all uploads completed
+	staging_batches = {};
 
 	scene.set_components(std::move(image_components));
 
 	auto elapsed_time = timer.stop();
 
-	auto thread_count = std::thread::hardware_concurrency();
-	thread_count      = thread_count == 0 ? 1 : thread_count;
-	LOGI("Time spent loading images: {} seconds across {} threads.", vkb::to_string(elapsed_time), thread_count);
+	LOGI("Time spent loading images: {} seconds across {} threads.", vkb::to_string(elapsed_time), image_decode_queue.get_worker_count());
+	LOGI("  decode: {} seconds of worker time, waiting for decode: {} seconds, staging: {} seconds, waiting for uploads: {} seconds",
+	     vkb::to_string(decode_time.load()), vkb::to_string(wait_decode_time), vkb::to_string(staging_time), vkb::to_string(wait_upload_time));
 
 	// Load textures
 	auto images                  = scene.get_components<sg::Image>();
@@ -727,99 +941,199 @@ vkb::scene_graph::SceneC GLTFLoader::load_scene(int scene_index, VkBufferUsageFl
 	// Load meshes
 	auto materials = scene.get_components<sg::PBRMaterial>();
 
-	for (auto &gltf_mesh : model.meshes)
+	// Attribute conversion and buffer uploads of all primitives run on the workers. The buffers are host visible, so
+	// uploading them is a copy into mapped memory, which is the bulk of the mesh loading time for large scenes.
+	std::vector<std::pair<size_t, size_t>> primitive_indices;        // Mesh and primitive index of each primitive
+	for (size_t mesh_index = 0; mesh_index < model.meshes.size(); mesh_index++)
 	{
-		PROFILE_SCOPE("Processing Mesh");
-
-		auto mesh = parse_mesh(gltf_mesh);
-
-		for (size_t i_primitive = 0; i_primitive < gltf_mesh.primitives.size(); i_primitive++)
+		for (size_t i_primitive = 0; i_primitive < model.meshes[mesh_index].primitives.size(); i_primitive++)
 		{
-			const auto &gltf_primitive = gltf_mesh.primitives[i_primitive];
+			primitive_indices.emplace_back(mesh_index, i_primitive);
+		}
+	}
 
-			auto submesh_name = fmt::format("'{}' mesh, primitive #{}", gltf_mesh.name, i_primitive);
-			auto submesh      = std::make_unique<sg::SubMesh>(std::move(submesh_name));
+	timer.start();
 
-			for (auto &attribute : gltf_primitive.attributes)
-			{
-				std::string attrib_name = attribute.first;
-				std::transform(attrib_name.begin(), attrib_name.end(), attrib_name.begin(), ::tolower);
+	WorkQueue<std::unique_ptr<sg::SubMesh>> submesh_queue(primitive_indices.size(), [&](size_t primitive_index) {
+		PROFILE_SCOPE("Processing Primitive");
 
-				auto vertex_data = get_attribute_data(&model, attribute.second);
+		auto [mesh_index, i_primitive] = primitive_indices[primitive_index];
 
-				if (attrib_name == "position")
-				{
-					assert(attribute.second < model.accessors.size());
-					submesh->vertices_count = to_u32(model.accessors[attribute.second].count);
-				}
+		auto       &gltf_mesh      = model.meshes[mesh_index];
+		const auto &gltf_primitive = gltf_mesh.primitives[i_primitive];
 
-				vkb::core::BufferC buffer{device,
-				                          vertex_data.size(),
-				                          VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | additional_buffer_usage_flags,
-				                          VMA_MEMORY_USAGE_CPU_TO_GPU};
-				buffer.update(vertex_data);
-				buffer.set_debug_name(fmt::format("'{}' mesh, primitive #{}: '{}' vertex buffer",
-				                                  gltf_mesh.name, i_primitive, attrib_name));
+		auto submesh_name = fmt::format("'{}' mesh, primitive #{}", gltf_mesh.name, i_primitive);
+		auto submesh      = std::make_unique<sg::SubMesh>(std::move(submesh_name));
 
-				submesh->vertex_buffers.insert(std::make_pair(attrib_name, std::move(buffer)));
+		// The positions and normals of skinned and morphed primitives are also read by the skinning pass
+		bool skinned    = gltf_primitive.attributes.contains("JOINTS_0") && gltf_primitive.attributes.contains("WEIGHTS_0");
+		bool deformable = skinned || !gltf_primitive.targets.empty();
 
-				sg::VertexAttribute attrib;
-				attrib.format = get_attribute_format(&model, attribute.second);
-				attrib.stride = to_u32(get_attribute_stride(&model, attribute.second));
+		for (auto &attribute : gltf_primitive.attributes)
+		{
+			std::string attrib_name = attribute.first;
+			std::transform(attrib_name.begin(), attrib_name.end(), attrib_name.begin(), ::tolower);
 
-				submesh->set_attribute(attrib_name, attrib);
+			auto vertex_view = get_accessor_view(&model, attribute.second);
+
+			if (attrib_name == "position")
+			{
+				assert(attribute.second < model.accessors.size());
+				submesh->vertices_count = to_u32(model.accessors[attribute.second].count);
 			}
 
-			if (gltf_primitive.indices >= 0)
+			// Each attribute gets its own buffer, so interleaved source data is packed, keeping glTF's 4 byte element alignment
+			size_t vertex_stride = (vertex_view.element_size + 3) & ~size_t{3};
+
+			VkBufferUsageFlags usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | additional_buffer_usage_flags;
+			if (deformable && (attrib_name == "position" || attrib_name == "normal"))
 			{
-				submesh->vertex_indices = to_u32(get_attribute_size(&model, gltf_primitive.indices));
+				usage |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+			}
 
-				auto format = get_attribute_format(&model, gltf_primitive.indices);
+			vkb::core::BufferC buffer{device,
+			                          vertex_view.count * vertex_stride,
+			                          usage,
+			                          VMA_MEMORY_USAGE_CPU_TO_GPU};
+			vertex_view.copy_to(buffer.map(), vertex_stride);
+			buffer.flush();
+			buffer.unmap();
+			buffer.set_debug_name(fmt::format("'{}' mesh, primitive #{}: '{}' vertex buffer",
+			                                  gltf_mesh.name, i_primitive, attrib_name));
 
-				auto index_data = get_attribute_data(&model, gltf_primitive.indices);
+			submesh->vertex_buffers.insert(std::make_pair(attrib_name, std::move(buffer)));
 
-				switch (format)
-				{
-					case VK_FORMAT_R8_UINT:
-						// Converts uint8 data into uint16 data, still represented by a uint8 vector
-						index_data          = convert_underlying_data_stride(index_data, 1, 2);
-						submesh->index_type = VK_INDEX_TYPE_UINT16;
-						break;
-					case VK_FORMAT_R16_UINT:
-						submesh->index_type = VK_INDEX_TYPE_UINT16;
-						break;
-					case VK_FORMAT_R32_UINT:
-						submesh->index_type = VK_INDEX_TYPE_UINT32;
-						break;
-					default:
-						LOGE("gltf primitive has invalid format type");
-						break;
-				}
+			sg::VertexAttribute attrib;
+			attrib.format = get_attribute_format(&model, attribute.second);
+			attrib.stride = to_u32(vertex_stride);
 
-				submesh->index_buffer = std::make_unique<vkb::core::BufferC>(device,
-				                                                             index_data.size(),
-				                                                             VK_BUFFER_USAGE_INDEX_BUFFER_BIT | additional_buffer_usage_flags,
-				                                                             VMA_MEMORY_USAGE_GPU_TO_CPU);
-				submesh->index_buffer->set_debug_name(fmt::format("'{}' mesh, primitive #{}: index buffer",
-				                                                  gltf_mesh.name, i_primitive));
+			submesh->set_attribute(attrib_name, attrib);
+		}
 
-				submesh->index_buffer->update(index_data);
-			}
-			else
+		if (skinned)
+		{
+			auto joints  = read_accessor_vec4(model, gltf_primitive.attributes.at("JOINTS_0"));
+			auto weights = read_accessor_vec4(model, gltf_primitive.attributes.at("WEIGHTS_0"));
+
+			std::vector<sg::SkinVertex> skin_vertices(std::min(joints.size(), weights.size()));
+			for (size_t i = 0; i < skin_vertices.size(); ++i)
 			{
-				submesh->vertices_count = to_u32(get_attribute_size(&model, gltf_primitive.attributes.at("POSITION")));
+				skin_vertices[i] = {glm::uvec4(joints[i]), weights[i]};
 			}
 
-			if (gltf_primitive.material < 0)
+			submesh->skin_buffer = std::make_unique<vkb::core::BufferC>(device,
+			                                                            std::max<size_t>(skin_vertices.size(), 1) * sizeof(sg::SkinVertex),
+			                                                            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+			                                                            VMA_MEMORY_USAGE_CPU_TO_GPU);
+			submesh->skin_buffer->update(skin_vertices);
+			submesh->skin_buffer->set_debug_name(fmt::format("'{}' mesh, primitive #{}: skin buffer", gltf_mesh.name, i_primitive));
+		}
+
+		if (!gltf_primitive.targets.empty())
+		{
+			// Only the position and normal offsets are applied, the tangents of a target are ignored
+			std::vector<sg::MorphTargetVertex> target_vertices(gltf_primitive.targets.size() * submesh->vertices_count,
+			                                                   {glm::vec4{0.0f}, glm::vec4{0.0f}});
+			for (size_t target_index = 0; target_index < gltf_primitive.targets.size(); ++target_index)
 			{
-				submesh->set_material(*default_material);
+				auto &gltf_target = gltf_primitive.targets[target_index];
+				auto *target      = target_vertices.data() + target_index * submesh->vertices_count;
+
+				if (auto position_it = gltf_target.find("POSITION"); position_it != gltf_target.end())
+				{
+					auto offsets = read_accessor_vec4(model, position_it->second);
+					for (size_t i = 0; i < std::min<size_t>(offsets.size(), submesh->vertices_count); ++i)
+					{
+						target[i].position = offsets[i];
+					}
+				}
+				if (auto normal_it = gltf_target.find("NORMAL"); normal_it != gltf_target.end())
+				{
+					auto offsets = read_accessor_vec4(model, normal_it->second);
+					for (size_t i = 0; i < std::min<size_t>(offsets.size(), submesh->vertices_count); ++i)
+					{
+						target[i].normal = offsets[i];
+					}
+				}
 			}
-			else
+
+			submesh->morph_target_count  = to_u32(gltf_primitive.targets.size());
+			submesh->morph_target_buffer = std::make_unique<vkb::core::BufferC>(device,
+			                                                                    std::max<size_t>(target_vertices.size(), 1) * sizeof(sg::MorphTargetVertex),
+			                                                                    VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+			                                                                    VMA_MEMORY_USAGE_CPU_TO_GPU);
+			submesh->morph_target_buffer->update(target_vertices);
+			submesh->morph_target_buffer->set_debug_name(fmt::format("'{}' mesh, primitive #{}: morph target buffer", gltf_mesh.name, i_primitive));
+		}
+
+		if (gltf_primitive.indices >= 0)
+		{
+			submesh->vertex_indices = to_u32(get_attribute_size(&model, gltf_primitive.indices));
+
+			auto format = get_attribute_format(&model, gltf_primitive.indices);
+
+			auto index_view = get_accessor_view(&model, gltf_primitive.indices);
+
+			size_t index_size = index_view.element_size;
+
+			switch (format)
 			{
-				assert(gltf_primitive.material < materials.size());
-				submesh->set_material(*materials[gltf_primitive.material]);
+				case VK_FORMAT_R8_UINT:
+					// uint8 indices are widened to uint16 while they are copied
+					index_size          = 2;
+					submesh->index_type = VK_INDEX_TYPE_UINT16;
+					break;
+				case VK_FORMAT_R16_UINT:
+					submesh->index_type = VK_INDEX_TYPE_UINT16;
+					break;
+				case VK_FORMAT_R32_UINT:
+					submesh->index_type = VK_INDEX_TYPE_UINT32;
+					break;
+				default:
+					LOGE("gltf primitive has invalid format type");
+					break;
 			}
 
+			submesh->index_buffer = std::make_unique<vkb::core::BufferC>(device,
+			                                                             index_view.count * index_size,
+			                                                             VK_BUFFER_USAGE_INDEX_BUFFER_BIT | additional_buffer_usage_flags,
+			                                                             VMA_MEMORY_USAGE_GPU_TO_CPU);
+			submesh->index_buffer->set_debug_name(fmt::format("'{}' mesh, primitive #{}: index buffer",
+			                                                  gltf_mesh.name, i_primitive));
+
+			index_view.copy_to(submesh->index_buffer->map(), index_size);
+			submesh->index_buffer->flush();
+			submesh->index_buffer->unmap();
+		}
+		else
+		{
+			submesh->vertices_count = to_u32(get_attribute_size(&model, gltf_primitive.attributes.at("POSITION")));
+		}
+
+		if (gltf_primitive.material < 0)
+		{
+			submesh->set_material(*default_material);
+		}
+		else
+		{
+			assert(gltf_primitive.material < materials.size());
+			submesh->set_material(*materials[gltf_primitive.material]);
+		}
+
+		return submesh;
+	});
+
+	size_t primitive_index = 0;
+	for (auto &gltf_mesh : model.meshes)
+	{
+		PROFILE_SCOPE("Processing Mesh");
+
+		auto mesh = parse_mesh(gltf_mesh);
+
+		for (size_t i_primitive = 0; i_primitive < gltf_mesh.primitives.size(); i_primitive++)
+		{
+			auto submesh = submesh_queue.get(primitive_index++);
+
 			mesh->add_submesh(*submesh);
 
 			scene.add_component(std::move(submesh));
@@ -828,6 +1142,8 @@ vkb::scene_graph::SceneC GLTFLoader::load_scene(int scene_index, VkBufferUsageFl
 		scene.add_component(std::move(mesh));
 	}
 
+	LOGI("Time spent loading meshes: {} seconds across {} threads.", vkb::to_string(timer.stop()), submesh_queue.get_worker_count());
+
 	device.get_fence_pool().wait();
 	device.get_fence_pool().reset();
 	device.get_command_pool().reset_pool();
@@ -887,6 +1203,42 @@ vkb::scene_graph::SceneC GLTFLoader::load_scene(int scene_index, VkBufferUsageFl
 		nodes.push_back(std::move(node));
 	}
 
+	// Load skins, the joints are nodes so this needs all the nodes
+	for (size_t skin_index = 0; skin_index < model.skins.size(); ++skin_index)
+	{
+		auto &gltf_skin = model.skins[skin_index];
+
+		auto skin = std::make_unique<sg::Skin>(gltf_skin.name);
+
+		std::vector<uint8_t> inverse_bind_matrix_data;
+		if (gltf_skin.inverseBindMatrices >= 0)
+		{
+			inverse_bind_matrix_data = get_attribute_data(&model, gltf_skin.inverseBindMatrices);
+		}
+		const glm::mat4 *inverse_bind_matrices = reinterpret_cast<const glm::mat4 *>(inverse_bind_matrix_data.data());
+
+		for (size_t joint_index = 0; joint_index < gltf_skin.joints.size(); ++joint_index)
+		{
+			auto joint = gltf_skin.joints[joint_index];
+			assert(joint < nodes.size());
+
+			// Without inverse bind matrices the joints are assumed to be in bind pose at the origin
+			glm::mat4 inverse_bind_matrix = inverse_bind_matrices ? inverse_bind_matrices[joint_index] : glm::mat4(1.0f);
+
+			skin->add_joint(*nodes[joint], inverse_bind_matrix);
+		}
+
+		for (size_t node_index = 0; node_index < model.nodes.size(); ++node_index)
+		{
+			if (model.nodes[node_index].skin == static_cast<int>(skin_index))
+			{
+				nodes[node_index]->set_component(*skin);
+			}
+		}
+
+		scene.add_component(std::move(skin));
+	}
+
 	std::vector<std::unique_ptr<sg::Animation>> animations;
 
 	// Load animations
@@ -950,10 +1302,21 @@ vkb::scene_graph::SceneC GLTFLoader::load_scene(int scene_index, VkBufferUsageFl
 					}
 					break;
 				}
+				case TINYGLTF_TYPE_SCALAR:
+				{
+					// Morph target weights, one per target and keyframe
+					const float *data = reinterpret_cast<const float *>(output_accessor_data.data());
+					for (size_t i = 0; i < output_accessor.count; ++i)
+					{
+						sampler.outputs.push_back(glm::vec4(data[i], 0.0f, 0.0f, 0.0f));
+					}
+					break;
+				}
 				default:
 				{
+					// The sampler is still added, with no outputs, so that the channels find their samplers by index
 					LOGW("Gltf animation sampler #{} has unknown output data type", sampler_index);
-					continue;
+					break;
 				}
 			}
 
@@ -981,8 +1344,7 @@ vkb::scene_graph::SceneC GLTFLoader::load_scene(int scene_index, VkBufferUsageFl
 			}
 			else if (gltf_channel.target_path == "weights")
 			{
-				LOGW("Gltf animation channel #{} has unsupported target path: {}", channel_index, gltf_channel.target_path);
-				continue;
+				target = sg::AnimationTarget::Weights;
 			}
 			else
 			{
@@ -1246,31 +1608,18 @@ std::unique_ptr<sg::SubMesh> GLTFLoader::load_model(uint32_t index, bool storage
 		submesh->vertex_indices = to_u32(get_attribute_size(&model, gltf_primitive.indices));
 
 		auto format     = get_attribute_format(&model, gltf_primitive.indices);
-		auto index_data = get_attribute_data(&model, gltf_primitive.indices);
+		auto index_view = get_accessor_view(&model, gltf_primitive.indices);
 
-		switch (format)
+		// uint8 and uint16 indices are widened to uint32 while they are copied
+		size_t index_size = 4;
+		if (format != VK_FORMAT_R32_UINT && format != VK_FORMAT_R16_UINT && format != VK_FORMAT_R8_UINT)
 		{
-			case VK_FORMAT_R32_UINT:
-			{
-				// Correct format
-				break;
-			}
-			case VK_FORMAT_R16_UINT:
-			{
-				index_data = convert_underlying_data_stride(index_data, 2, 4);
-				break;
-			}
-			case VK_FORMAT_R8_UINT:
-			{
-				index_data = convert_underlying_data_stride(index_data, 1, 4);
-				break;
-			}
-			default:
-			{
-				break;
-			}
+			index_size = index_view.element_size;
 		}
 
+		std::vector<uint8_t> index_data(index_view.count * index_size);
+		index_view.copy_to(index_data.data(), index_size);
+
 		// Always do uint32
 		submesh->index_type = VK_INDEX_TYPE_UINT32;
 
@@ -1390,7 +1739,17 @@ std::unique_ptr<sg::Camera> GLTFLoader::parse_camera(const tinygltf::Camera &glt
 
 std::unique_ptr<sg::Mesh> GLTFLoader::parse_mesh(const tinygltf::Mesh &gltf_mesh) const
 {
-	return std::make_unique<sg::Mesh>(gltf_mesh.name);
+	auto mesh = std::make_unique<sg::Mesh>(gltf_mesh.name);
+
+	// The default weights of the morph targets, all the primitives of a mesh have the same number of targets
+	std::vector<float> morph_weights(gltf_mesh.weights.begin(), gltf_mesh.weights.end());
+	if (morph_weights.empty() && !gltf_mesh.primitives.empty())
+	{
+		morph_weights.resize(gltf_mesh.primitives.front().targets.size(), 0.0f);
+	}
+	mesh->set_morph_weights(morph_weights.data(), morph_weights.size());
+
+	return mesh;
 }
 
 std::unique_ptr<sg::PBRMaterial> GLTFLoader::parse_material(const tinygltf::Material &gltf_material) const
@@ -1487,7 +1846,10 @@ std::unique_ptr<sg::Image> GLTFLoader::parse_image(tinygltf::Image &gltf_image)
 		if (!device.is_image_format_supported(image->get_format()))
 		{
 			image = std::make_unique<sg::Astc>(*image);
-			image->generate_mipmaps();
+			if (image->get_mipmaps().size() == 1)
+			{
+				image->generate_mipmaps();
+			}
 		}
 	}
 
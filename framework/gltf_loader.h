@@ -19,6 +19,8 @@
 #pragma once
 
 #include "common/vk_common.h"
+#include <cassert>
+#include <cstring>
 #include <memory>
 #include <mutex>
 
@@ -74,6 +76,85 @@ struct TypeCast
 	}
 };
 
+/**
+ * @brief A strided, non-owning view of the elements of a glTF accessor, in the buffer data loaded by tinygltf
+ */
+struct AccessorView
+{
+	const uint8_t *data         = nullptr;
+	size_t         count        = 0;
+	size_t         element_size = 0;        // Size of one element in bytes
+	size_t         stride       = 0;        // Distance between two elements in bytes, larger than element_size for interleaved data
+
+	/**
+	 * @brief Copies the elements to dst, one every dst_stride bytes, in a single pass
+	 *        Bytes of an element beyond element_size are zeroed, which widens little-endian unsigned integers
+	 *        (e.g. uint8 indices to uint16) and removes the interleaving of the source
+	 * @param dst Memory with room for count * dst_stride bytes, usually mapped buffer memory
+	 * @param dst_stride Distance between two elements in dst, at least element_size
+	 */
+	void copy_to(uint8_t *dst, size_t dst_stride) const
+	{
+		assert(element_size <= dst_stride);
+
+		// Typed loops for the common cases, which compilers vectorize
+		if (stride == element_size && element_size == dst_stride)
+		{
+			std::memcpy(dst, data, count * stride);
+		}
+		else if (stride == 1 && element_size == 1 && dst_stride == 2)
+		{
+			widen<uint8_t, uint16_t>(dst);
+		}
+		else if (stride == 1 && element_size == 1 && dst_stride == 4)
+		{
+			widen<uint8_t, uint32_t>(dst);
+		}
+		else if (stride == 2 && element_size == 2 && dst_stride == 4)
+		{
+			widen<uint16_t, uint32_t>(dst);
+		}
+		else
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				std::memcpy(dst + i * dst_stride, data + i * stride, element_size);
+				std::memset(dst + i * dst_stride + element_size, 0, dst_stride - element_size);
+			}
+		}
+	}
+
+	template <typename Src, typename Dst>
+	void widen(uint8_t *dst) const
+	{
+		// The source of an accessor is not necessarily aligned to its component type
+		for (size_t i = 0; i < count; ++i)
+		{
+			Src value;
+			std::memcpy(&value, data + i * sizeof(Src), sizeof(Src));
+			Dst widened = value;
+			std::memcpy(dst + i * sizeof(Dst), &widened, sizeof(Dst));
+		}
+	}
+};
+
+inline AccessorView get_accessor_view(const tinygltf::Model *model, uint32_t accessorId)
+{
+	assert(accessorId < model->accessors.size());
+	auto &accessor = model->accessors[accessorId];
+	assert(accessor.bufferView < model->bufferViews.size());
+	auto &bufferView = model->bufferViews[accessor.bufferView];
+	assert(bufferView.buffer < model->buffers.size());
+	auto &buffer = model->buffers[bufferView.buffer];
+
+	AccessorView view;
+	view.data         = buffer.data.data() + accessor.byteOffset + bufferView.byteOffset;
+	view.count        = accessor.count;
+	view.element_size = tinygltf::GetComponentSizeInBytes(accessor.componentType) * tinygltf::GetNumComponentsInType(accessor.type);
+	view.stride       = accessor.ByteStride(bufferView);
+	return view;
+}
+
 /// Read a gltf file and return a scene object. Converts the gltf objects
 /// to our internal scene implementation. Mesh data is copied to vulkan buffers and
 /// images are loaded from the folder of gltf file to vulkan images.
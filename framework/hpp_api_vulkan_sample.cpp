@@ -177,6 +177,11 @@ void HPPApiVulkanSample::prepare_render_context()
 	vkb::VulkanSampleCpp::prepare_render_context();
 }
 
+bool HPPApiVulkanSample::supports_frames_in_flight() const
+{
+	return false;
+}
+
 void HPPApiVulkanSample::input_event(const vkb::InputEvent &input_event)
 {
 	vkb::VulkanSampleCpp::input_event(input_event);
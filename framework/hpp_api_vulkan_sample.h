@@ -90,6 +90,9 @@ class HPPApiVulkanSample : public vkb::VulkanSampleCpp
 	void create_render_context() override;
 	void prepare_render_context() override;
 
+	// The swapchain images are acquired by the sample itself, and index its command buffers and framebuffers
+	bool supports_frames_in_flight() const override;
+
 	// Handle to the device graphics queue that command buffers are submitted to
 	vk::Queue queue;
 
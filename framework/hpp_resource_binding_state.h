@@ -1,4 +1,4 @@
-/* Copyright (c) 2023-2025, NVIDIA CORPORATION. All rights reserved.
+/* Copyright (c) 2023-2026, NVIDIA CORPORATION. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -38,7 +38,6 @@ class HPPSampler;
  */
 struct HPPResourceInfo
 {
-	bool                           dirty      = false;
 	const vkb::core::BufferCpp    *buffer     = nullptr;
 	vk::DeviceSize                 offset     = 0;
 	vk::DeviceSize                 range      = 0;
@@ -49,12 +48,14 @@ struct HPPResourceInfo
 class HPPResourceSet : private vkb::ResourceSet
 {
   public:
+	using vkb::ResourceSet::get_bound_bindings;
+	using vkb::ResourceSet::get_dirty_bindings;
 	using vkb::ResourceSet::is_dirty;
 
   public:
-	const BindingMap<HPPResourceInfo> &get_resource_bindings() const
+	const std::vector<HPPResourceInfo> &get_binding_resources(uint32_t binding) const
 	{
-		return reinterpret_cast<BindingMap<HPPResourceInfo> const &>(vkb::ResourceSet::get_resource_bindings());
+		return reinterpret_cast<std::vector<HPPResourceInfo> const &>(vkb::ResourceSet::get_binding_resources(binding));
 	}
 };
 
@@ -62,6 +63,8 @@ class HPPResourceBindingState : private vkb::ResourceBindingState
 {
   public:
 	using vkb::ResourceBindingState::clear_dirty;
+	using vkb::ResourceBindingState::get_bound_sets;
+	using vkb::ResourceBindingState::get_dirty_sets;
 	using vkb::ResourceBindingState::is_dirty;
 	using vkb::ResourceBindingState::reset;
 
@@ -92,9 +95,9 @@ class HPPResourceBindingState : private vkb::ResourceBindingState
 		vkb::ResourceBindingState::bind_input(reinterpret_cast<vkb::core::ImageView const &>(image_view), set, binding, array_element);
 	}
 
-	const std::unordered_map<uint32_t, vkb::HPPResourceSet> &get_resource_sets()
+	const vkb::HPPResourceSet &get_resource_set(uint32_t set) const
 	{
-		return reinterpret_cast<std::unordered_map<uint32_t, vkb::HPPResourceSet> const &>(vkb::ResourceBindingState::get_resource_sets());
+		return reinterpret_cast<vkb::HPPResourceSet const &>(vkb::ResourceBindingState::get_resource_set(set));
 	}
 };
 }        // namespace vkb
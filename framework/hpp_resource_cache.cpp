@@ -22,6 +22,7 @@
 #include "core/hpp_image_view.h"
 #include "core/hpp_pipeline.h"
 #include "core/hpp_pipeline_layout.h"
+#include "resource_cache.h"
 
 namespace vkb
 {
@@ -29,9 +30,23 @@ namespace
 {
 template <class T, class... A>
 T &request_resource(
-    vkb::core::DeviceCpp &device, vkb::HPPResourceRecord &recorder, std::mutex &resource_mutex, std::unordered_map<std::size_t, T> &resources, A &...args)
+    vkb::core::DeviceCpp &device, vkb::HPPResourceRecord &recorder, std::shared_mutex &resource_mutex, std::unordered_map<std::size_t, T> &resources, A &...args)
 {
-	std::lock_guard<std::mutex> guard(resource_mutex);
+	size_t hash{0U};
+	hash_param(hash, args...);
+
+	{
+		// Cache hits only take a shared lock, so threads looking up existing resources never wait on each other
+		std::shared_lock<std::shared_mutex> guard(resource_mutex);
+
+		if (auto resource = vkb::common::find_resource(resources, hash, args...))
+		{
+			return *resource;
+		}
+	}
+
+	// On a miss another thread may have created the resource in the meantime, so look it up again under the exclusive lock
+	std::lock_guard<std::shared_mutex> guard(resource_mutex);
 
 	auto &res = vkb::common::request_resource(device, &recorder, resources, args...);
 
@@ -70,6 +85,11 @@ const HPPResourceCacheState &HPPResourceCache::get_internal_state() const
 	return state;
 }
 
+vkb::ResourceReplayStats HPPResourceCache::load(const vkb::filesystem::Path &path)
+{
+	return reinterpret_cast<vkb::ResourceCache &>(*this).load(path);
+}
+
 vkb::core::HPPComputePipeline &HPPResourceCache::request_compute_pipeline(vkb::rendering::HPPPipelineState &pipeline_state)
 {
 	return request_resource(device, recorder, compute_pipeline_mutex, state.compute_pipelines, pipeline_cache, pipeline_state);
@@ -121,6 +141,11 @@ vkb::core::HPPShaderModule &HPPResourceCache::request_shader_module(vk::ShaderSt
 	return request_resource(device, recorder, shader_module_mutex, state.shader_modules, stage, glsl_source, entry_point, shader_variant);
 }
 
+void HPPResourceCache::save(const vkb::filesystem::Path &path)
+{
+	reinterpret_cast<vkb::ResourceCache &>(*this).save(path);
+}
+
 std::vector<uint8_t> HPPResourceCache::serialize()
 {
 	return recorder.get_data();
@@ -211,8 +236,6 @@ void HPPResourceCache::update_descriptor_sets(const std::vector<vkb::core::HPPIm
 
 void HPPResourceCache::warmup(const std::vector<uint8_t> &data)
 {
-	recorder.set_data(data);
-
-	replayer.play(*this, recorder);
+	replayer.play(*this, data);
 }
 }        // namespace vkb
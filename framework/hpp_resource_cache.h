@@ -22,8 +22,10 @@
 #include "core/hpp_pipeline.h"
 #include "core/hpp_pipeline_layout.h"
 #include "core/hpp_render_pass.h"
+#include "filesystem/filesystem.hpp"
 #include "hpp_resource_record.h"
 #include "hpp_resource_replay.h"
+#include <shared_mutex>
 #include <vulkan/vulkan.hpp>
 
 namespace vkb
@@ -82,6 +84,7 @@ class HPPResourceCache
 	void                               clear_framebuffers();
 	void                               clear_pipelines();
 	const HPPResourceCacheState       &get_internal_state() const;
+	vkb::ResourceReplayStats           load(const vkb::filesystem::Path &path);
 	vkb::core::HPPComputePipeline     &request_compute_pipeline(vkb::rendering::HPPPipelineState &pipeline_state);
 	vkb::core::HPPDescriptorSet       &request_descriptor_set(vkb::core::HPPDescriptorSetLayout          &descriptor_set_layout,
 	                                                          const BindingMap<vk::DescriptorBufferInfo> &buffer_infos,
@@ -97,6 +100,7 @@ class HPPResourceCache
 	                                                       const std::vector<vkb::core::HPPSubpassInfo>     &subpasses);
 	vkb::core::HPPShaderModule        &request_shader_module(
 	           vk::ShaderStageFlagBits stage, const vkb::core::HPPShaderSource &glsl_source, const vkb::core::HPPShaderVariant &shader_variant = {});
+	void                 save(const vkb::filesystem::Path &path);
 	std::vector<uint8_t> serialize();
 	void                 set_pipeline_cache(vk::PipelineCache pipeline_cache);
 
@@ -113,13 +117,13 @@ class HPPResourceCache
 	vkb::HPPResourceReplay replayer                    = {};
 	vk::PipelineCache      pipeline_cache              = nullptr;
 	HPPResourceCacheState  state                       = {};
-	std::mutex             descriptor_set_mutex        = {};
-	std::mutex             pipeline_layout_mutex       = {};
-	std::mutex             shader_module_mutex         = {};
-	std::mutex             descriptor_set_layout_mutex = {};
-	std::mutex             graphics_pipeline_mutex     = {};
-	std::mutex             render_pass_mutex           = {};
-	std::mutex             compute_pipeline_mutex      = {};
-	std::mutex             framebuffer_mutex           = {};
+	std::shared_mutex      descriptor_set_mutex        = {};
+	std::shared_mutex      pipeline_layout_mutex       = {};
+	std::shared_mutex      shader_module_mutex         = {};
+	std::shared_mutex      descriptor_set_layout_mutex = {};
+	std::shared_mutex      graphics_pipeline_mutex     = {};
+	std::shared_mutex      render_pass_mutex           = {};
+	std::shared_mutex      compute_pipeline_mutex      = {};
+	std::shared_mutex      framebuffer_mutex           = {};
 };
 }        // namespace vkb
@@ -32,9 +32,11 @@ class HPPResourceRecord;
 class HPPResourceReplay : private vkb::ResourceReplay
 {
   public:
-	void play(vkb::HPPResourceCache &resource_cache, vkb::HPPResourceRecord &recorder)
+	using vkb::ResourceReplay::get_stats;
+
+	void play(vkb::HPPResourceCache &resource_cache, const std::vector<uint8_t> &data)
 	{
-		vkb::ResourceReplay::play(reinterpret_cast<vkb::ResourceCache &>(resource_cache), reinterpret_cast<vkb::ResourceRecord &>(recorder));
+		vkb::ResourceReplay::play(reinterpret_cast<vkb::ResourceCache &>(resource_cache), data);
 	}
 };
 }        // namespace vkb
@@ -0,0 +1,231 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "descriptor_set_cache.h"
+
+#include "common/hpp_resource_caching.h"
+
+namespace vkb
+{
+namespace rendering
+{
+namespace
+{
+uint32_t get_descriptor_count(vkb::core::HPPDescriptorSetLayout const &descriptor_set_layout)
+{
+	uint32_t descriptor_count = 0;
+	for (auto &binding : descriptor_set_layout.get_bindings())
+	{
+		descriptor_count += binding.descriptorCount;
+	}
+	return descriptor_count;
+}
+
+bool descriptor_set_matches(vkb::core::HPPDescriptorSet                &descriptor_set,
+                            vkb::core::HPPDescriptorSetLayout const    &descriptor_set_layout,
+                            BindingMap<vk::DescriptorBufferInfo> const &buffer_infos,
+                            BindingMap<vk::DescriptorImageInfo> const  &image_infos)
+{
+	return descriptor_set.get_layout().get_handle() == descriptor_set_layout.get_handle() &&
+	       vkb::binding_maps_equal(reinterpret_cast<BindingMap<VkDescriptorBufferInfo> const &>(descriptor_set.get_buffer_infos()),
+	                               reinterpret_cast<BindingMap<VkDescriptorBufferInfo> const &>(buffer_infos),
+	                               vkb::buffer_infos_equal) &&
+	       vkb::binding_maps_equal(reinterpret_cast<BindingMap<VkDescriptorImageInfo> const &>(descriptor_set.get_image_infos()),
+	                               reinterpret_cast<BindingMap<VkDescriptorImageInfo> const &>(image_infos),
+	                               vkb::image_infos_equal);
+}
+}        // namespace
+
+DescriptorSetCache::DescriptorSetCache(vkb::core::DeviceCpp &device, size_t descriptor_budget) :
+    device{device},
+    descriptor_budget{descriptor_budget}
+{}
+
+void DescriptorSetCache::begin_frame(size_t frame_slot)
+{
+	std::lock_guard<std::mutex> guard(mutex);
+
+	assert(frame_slot < frame_serials.size() && "Frame slot is out of bounds");
+
+	// The frame has waited on its fences, so all the work it recorded under its previous serial has completed
+	frame_serials[frame_slot] = ++serial;
+}
+
+void DescriptorSetCache::clear()
+{
+	std::lock_guard<std::mutex> guard(mutex);
+
+	lru.clear();
+	entries.clear();
+	free_descriptor_sets.clear();
+	descriptor_pools.clear();
+	cached_descriptor_count = 0;
+}
+
+void DescriptorSetCache::evict(uint32_t required_descriptor_count)
+{
+	uint64_t retired_serial = get_retired_serial();
+
+	while (!lru.empty() && descriptor_budget < cached_descriptor_count + required_descriptor_count)
+	{
+		Entry *entry = lru.front();
+
+		// Entries are ordered by last use, so if this one may still be in flight all the others may be as well
+		if (retired_serial < entry->last_used_serial)
+		{
+			break;
+		}
+
+		// Only this entry is erased, the other sets sharing its hash stay reachable
+		auto [entry_it, bucket_end] = entries.equal_range(entry->hash);
+		while (&entry_it->second != entry)
+		{
+			++entry_it;
+			assert(entry_it != bucket_end);
+		}
+
+		free_descriptor_sets[entry_it->second.layout].push_back(std::move(entry_it->second.descriptor_set));
+		cached_descriptor_count -= entry_it->second.descriptor_count;
+
+		entries.erase(entry_it);
+		lru.pop_front();
+
+		++counters.evictions;
+	}
+}
+
+size_t DescriptorSetCache::get_cached_descriptor_count()
+{
+	std::lock_guard<std::mutex> guard(mutex);
+
+	return cached_descriptor_count;
+}
+
+uint64_t DescriptorSetCache::get_retired_serial() const
+{
+	// Every serial older than the oldest frame still being recorded or in flight has had its fences waited on
+	uint64_t retired_serial = serial;
+	for (auto frame_serial : frame_serials)
+	{
+		if (frame_serial != 0)
+		{
+			retired_serial = std::min(retired_serial, frame_serial - 1);
+		}
+	}
+	return retired_serial;
+}
+
+size_t DescriptorSetCache::register_frame()
+{
+	std::lock_guard<std::mutex> guard(mutex);
+
+	if (!free_frame_slots.empty())
+	{
+		size_t frame_slot = free_frame_slots.back();
+		free_frame_slots.pop_back();
+		return frame_slot;
+	}
+
+	frame_serials.push_back(0);
+	return frame_serials.size() - 1;
+}
+
+vk::DescriptorSet DescriptorSetCache::request_descriptor_set(vkb::core::HPPDescriptorSetLayout const    &descriptor_set_layout,
+                                                             BindingMap<vk::DescriptorBufferInfo> const &buffer_infos,
+                                                             BindingMap<vk::DescriptorImageInfo> const  &image_infos)
+{
+	std::lock_guard<std::mutex> guard(mutex);
+
+	std::size_t hash{0U};
+	hash_param(hash, descriptor_set_layout, buffer_infos, image_infos);
+
+	// Sets with colliding hashes share a key, so the first one whose contents match is the cached set
+	auto [entry_it, bucket_end] = entries.equal_range(hash);
+	while (entry_it != bucket_end && !descriptor_set_matches(entry_it->second.descriptor_set, descriptor_set_layout, buffer_infos, image_infos))
+	{
+		++entry_it;
+	}
+
+	if (entry_it != bucket_end)
+	{
+		++counters.hits;
+
+		entry_it->second.last_used_serial = serial;
+		lru.splice(lru.end(), lru, entry_it->second.lru_it);
+
+		return entry_it->second.descriptor_set.get_handle();
+	}
+
+	++counters.misses;
+
+	uint32_t descriptor_count = get_descriptor_count(descriptor_set_layout);
+	evict(descriptor_count);
+
+	auto create_descriptor_set = [&]() {
+		auto free_it = free_descriptor_sets.find(descriptor_set_layout.get_handle());
+		if (free_it != free_descriptor_sets.end() && !free_it->second.empty())
+		{
+			// Recycle an evicted set, its last use has already completed on the GPU
+			vkb::core::HPPDescriptorSet descriptor_set = std::move(free_it->second.back());
+			free_it->second.pop_back();
+			descriptor_set.reset(buffer_infos, image_infos);
+			return descriptor_set;
+		}
+
+		auto &descriptor_pool = vkb::common::request_resource(device, nullptr, descriptor_pools, descriptor_set_layout);
+		return vkb::core::HPPDescriptorSet{device, descriptor_set_layout, descriptor_pool, buffer_infos, image_infos};
+	};
+
+	auto inserted_it = entries.emplace(hash, Entry{create_descriptor_set(), descriptor_set_layout.get_handle(), hash, descriptor_count, serial, {}});
+
+	// Elements of the map keep their address when it rehashes, so the LRU list can point at them directly
+	inserted_it->second.lru_it = lru.insert(lru.end(), &inserted_it->second);
+
+	cached_descriptor_count += descriptor_count;
+
+	// The contents of a cached set never change, so all bindings are written once here, including update-after-bind ones
+	inserted_it->second.descriptor_set.update();
+
+	return inserted_it->second.descriptor_set.get_handle();
+}
+
+DescriptorSetCache::Counters DescriptorSetCache::reset_counters()
+{
+	std::lock_guard<std::mutex> guard(mutex);
+
+	return std::exchange(counters, Counters{});
+}
+
+void DescriptorSetCache::set_descriptor_budget(size_t new_budget)
+{
+	std::lock_guard<std::mutex> guard(mutex);
+
+	descriptor_budget = new_budget;
+}
+
+void DescriptorSetCache::unregister_frame(size_t frame_slot)
+{
+	std::lock_guard<std::mutex> guard(mutex);
+
+	assert(frame_slot < frame_serials.size() && "Frame slot is out of bounds");
+
+	// The slot no longer holds back the retired serial, so the sets the frame used can be recycled
+	frame_serials[frame_slot] = 0;
+	free_frame_slots.push_back(frame_slot);
+}
+}        // namespace rendering
+}        // namespace vkb
@@ -0,0 +1,153 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "core/hpp_descriptor_pool.h"
+#include "core/hpp_descriptor_set.h"
+#include "core/hpp_descriptor_set_layout.h"
+
+namespace vkb
+{
+namespace rendering
+{
+/**
+ * @brief DescriptorSetCache stores descriptor sets keyed by their contents (layout, buffer infos and image infos)
+ * and shares them between all the RenderFrames of a RenderContext.
+ *
+ * A descriptor set is written once when it is created, and handed out unchanged on every later request with the
+ * same contents, regardless of the frame asking for it. The number of cached descriptors is kept within a budget
+ * by evicting the least recently used sets. An evicted set is only recycled for new contents once every frame that
+ * used it has waited on its fence, so a set is never rewritten while the GPU may still read it.
+ */
+class DescriptorSetCache
+{
+  public:
+	static constexpr size_t DEFAULT_DESCRIPTOR_BUDGET = 64 * 1024;
+
+	struct Counters
+	{
+		uint32_t hits{0};
+		uint32_t misses{0};
+		uint32_t evictions{0};
+	};
+
+  public:
+	/**
+	 * @param device A valid device
+	 * @param descriptor_budget Maximum number of descriptors kept in cached sets, descriptor pool memory scales with it
+	 */
+	explicit DescriptorSetCache(vkb::core::DeviceCpp &device, size_t descriptor_budget = DEFAULT_DESCRIPTOR_BUDGET);
+
+	DescriptorSetCache(const DescriptorSetCache &)            = delete;
+	DescriptorSetCache(DescriptorSetCache &&)                 = delete;
+	DescriptorSetCache &operator=(const DescriptorSetCache &) = delete;
+	DescriptorSetCache &operator=(DescriptorSetCache &&)      = delete;
+
+	/**
+	 * @brief Marks the start of a new frame, must be called after waiting on the frame's fences
+	 * @param frame_slot The slot returned by register_frame for the frame being started
+	 */
+	void begin_frame(size_t frame_slot);
+
+	/**
+	 * @brief Drops all cached descriptor sets and their pools
+	 *        The device must be idle, as the sets may still be referenced by pending command buffers otherwise
+	 */
+	void clear();
+
+	/**
+	 * @return The number of descriptors currently held by cached descriptor sets
+	 */
+	size_t get_cached_descriptor_count();
+
+	/**
+	 * @brief Registers a frame that will request descriptor sets from the cache
+	 * @return The slot to pass to begin_frame for that frame
+	 */
+	size_t register_frame();
+
+	/**
+	 * @brief Returns a descriptor set with the given contents, writing a new or recycled one on a miss
+	 * @param descriptor_set_layout The layout of the descriptor set
+	 * @param buffer_infos The buffer descriptors of the set
+	 * @param image_infos The image descriptors of the set
+	 * @return The descriptor set handle, which stays valid while the frame that requested it is in flight
+	 */
+	vk::DescriptorSet request_descriptor_set(vkb::core::HPPDescriptorSetLayout const    &descriptor_set_layout,
+	                                         BindingMap<vk::DescriptorBufferInfo> const &buffer_infos,
+	                                         BindingMap<vk::DescriptorImageInfo> const  &image_infos);
+
+	/**
+	 * @brief Returns the hit, miss and eviction counts since the last call and resets them
+	 */
+	Counters reset_counters();
+
+	/**
+	 * @brief Sets a new descriptor budget, taking effect on the next miss
+	 * @param new_budget Maximum number of descriptors kept in cached sets
+	 */
+	void set_descriptor_budget(size_t new_budget);
+
+	/**
+	 * @brief Releases the slot of a frame that no longer requests descriptor sets, such as a frame dropped after the
+	 *        swapchain shrank. The frame must have no work in flight, its slot may be handed out to a new frame
+	 * @param frame_slot The slot returned by register_frame for that frame
+	 */
+	void unregister_frame(size_t frame_slot);
+
+  private:
+	struct Entry
+	{
+		vkb::core::HPPDescriptorSet  descriptor_set;
+		vk::DescriptorSetLayout      layout;
+		std::size_t                  hash;
+		uint32_t                     descriptor_count;
+		uint64_t                     last_used_serial;
+		std::list<Entry *>::iterator lru_it;
+	};
+
+	/**
+	 * @brief Evicts least recently used sets that are no longer in flight, until the required descriptors fit in the budget
+	 */
+	void evict(uint32_t required_descriptor_count);
+
+	/**
+	 * @return The latest frame serial whose frame is known to have completed on the GPU
+	 */
+	uint64_t get_retired_serial() const;
+
+  private:
+	vkb::core::DeviceCpp                                                                 &device;
+	size_t                                                                                cached_descriptor_count = 0;
+	Counters                                                                              counters;
+	size_t                                                                                descriptor_budget;
+	std::unordered_map<std::size_t, vkb::core::HPPDescriptorPool>                         descriptor_pools;            // Descriptor pools per layout
+	std::unordered_multimap<std::size_t, Entry>                                           entries;                     // Cached descriptor sets keyed by content hash, colliding sets share a key
+	std::vector<uint64_t>                                                                 frame_serials;               // Serial of the frame currently recorded in each slot, 0 if unused
+	std::vector<size_t>                                                                   free_frame_slots;            // Slots released by unregister_frame
+	std::unordered_map<vk::DescriptorSetLayout, std::vector<vkb::core::HPPDescriptorSet>> free_descriptor_sets;        // Evicted sets ready to be recycled, per layout
+	std::list<Entry *>                                                                    lru;                         // Entries, least recently used first
+	std::mutex                                                                            mutex;
+	uint64_t                                                                              serial = 0;
+};
+}        // namespace rendering
+}        // namespace vkb
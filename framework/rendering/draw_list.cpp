@@ -0,0 +1,140 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "draw_list.h"
+
+#include <array>
+#include <bit>
+#include <utility>
+
+#include "core/util/profiling.hpp"
+
+namespace vkb
+{
+namespace rendering
+{
+namespace
+{
+// Below this size an insertion sort is faster than the radix sort passes
+constexpr size_t RADIX_SORT_THRESHOLD = 64;
+
+/**
+ * @brief Reduces an identifier to a hash of the given number of bits
+ */
+uint64_t fold_id(uint64_t id, uint32_t bits)
+{
+	// Fibonacci hashing spreads nearby values, such as pointers, over the high bits
+	return (id * 0x9E3779B97F4A7C15ULL) >> (64 - bits);
+}
+
+/**
+ * @brief Maps a distance to an integer with the same order, non-negative floats already order like their bits
+ */
+uint32_t distance_bits(float distance)
+{
+	// Also maps NaN to 0
+	return std::bit_cast<uint32_t>(0.0f < distance ? distance : 0.0f);
+}
+}        // namespace
+
+uint64_t make_draw_sort_key(DrawOrder order, float distance, uint64_t state_id, uint64_t material_id, uint64_t mesh_id)
+{
+	uint64_t depth = distance_bits(distance);
+
+	switch (order)
+	{
+		case DrawOrder::FrontToBack:
+			return (depth << 32) | (fold_id(state_id, 16) << 16) | (fold_id(material_id, 8) << 8) | fold_id(mesh_id, 8);
+		case DrawOrder::BackToFront:
+			return ((~depth & 0xFFFFFFFF) << 32) | (fold_id(state_id, 16) << 16) | (fold_id(material_id, 8) << 8) | fold_id(mesh_id, 8);
+		case DrawOrder::StateMinimizing:
+			// The sign bit of the distance is always clear, and the lowest mantissa bits barely matter for the order
+			return (fold_id(state_id, 16) << 48) | (fold_id(material_id, 12) << 36) | (fold_id(mesh_id, 12) << 24) | ((depth >> 7) & 0xFFFFFF);
+		default:
+			return depth << 32;
+	}
+}
+
+void radix_sort(std::vector<DrawSortEntry> &entries, std::vector<DrawSortEntry> &scratch)
+{
+	PROFILE_SCOPE("Sort Draws");
+
+	size_t count = entries.size();
+
+	if (count < RADIX_SORT_THRESHOLD)
+	{
+		for (size_t i = 1; i < count; ++i)
+		{
+			DrawSortEntry entry = entries[i];
+			size_t        j     = i;
+			for (; 0 < j && entry.key < entries[j - 1].key; --j)
+			{
+				entries[j] = entries[j - 1];
+			}
+			entries[j] = entry;
+		}
+		return;
+	}
+
+	// The histograms of all the bytes are gathered in a single pass over the keys
+	std::array<std::array<uint32_t, 256>, sizeof(uint64_t)> histograms{};
+	for (auto const &entry : entries)
+	{
+		for (size_t digit = 0; digit < sizeof(uint64_t); ++digit)
+		{
+			++histograms[digit][(entry.key >> (8 * digit)) & 0xFF];
+		}
+	}
+
+	scratch.resize(count);
+
+	auto *source      = &entries;
+	auto *destination = &scratch;
+	for (size_t digit = 0; digit < sizeof(uint64_t); ++digit)
+	{
+		auto &histogram = histograms[digit];
+		auto  shift     = 8 * digit;
+
+		// A byte that is the same in all the keys does not change the order
+		if (histogram[(source->front().key >> shift) & 0xFF] == count)
+		{
+			continue;
+		}
+
+		uint32_t offset = 0;
+		for (auto &bucket : histogram)
+		{
+			uint32_t bucket_count = bucket;
+			bucket                = offset;
+			offset += bucket_count;
+		}
+
+		for (auto const &entry : *source)
+		{
+			(*destination)[histogram[(entry.key >> shift) & 0xFF]++] = entry;
+		}
+
+		std::swap(source, destination);
+	}
+
+	if (source != &entries)
+	{
+		entries.swap(scratch);
+	}
+}
+}        // namespace rendering
+}        // namespace vkb
@@ -0,0 +1,133 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace vkb
+{
+namespace rendering
+{
+/**
+ * @brief The order in which the draws of a DrawList are sorted
+ */
+enum class DrawOrder
+{
+	FrontToBack,           // Nearest first, so that hidden fragments are rejected early
+	BackToFront,           // Farthest first, as needed for blending
+	StateMinimizing        // Grouped by pipeline state, material and mesh, then nearest first, to minimize rebinding
+};
+
+struct DrawSortEntry
+{
+	uint64_t key;
+	uint32_t index;
+};
+
+/**
+ * @brief Builds the sort key of a draw
+ * @param order The order the key sorts in
+ * @param distance The distance of the draw from the camera
+ * @param state_id Identifies the pipeline state of the draw, only a hash of it is kept
+ * @param material_id Identifies the material of the draw, only a hash of it is kept
+ * @param mesh_id Identifies the mesh of the draw, only a hash of it is kept
+ */
+uint64_t make_draw_sort_key(DrawOrder order, float distance, uint64_t state_id, uint64_t material_id, uint64_t mesh_id);
+
+/**
+ * @brief Sorts entries by key, keeping the order of equal keys, with a least significant digit radix sort
+ *        The passes over bytes that are the same in all the keys are skipped
+ * @param entries The entries to sort
+ * @param scratch Second buffer of the sort, resized as needed and reusable across calls
+ */
+void radix_sort(std::vector<DrawSortEntry> &entries, std::vector<DrawSortEntry> &scratch);
+
+/**
+ * @brief A flat list of draws sorted by 64-bit keys
+ *
+ * Clearing the list keeps its storage, so a list that is rebuilt every frame only allocates while it grows.
+ */
+template <typename T>
+class DrawList
+{
+  public:
+	void add(uint64_t key, T const &item);
+
+	void clear();
+
+	bool empty() const;
+
+	size_t size() const;
+
+	/**
+	 * @brief Sorts the draws by key, draws with the same key keep the order they were added in
+	 */
+	void sort();
+
+	/**
+	 * @return The draw at the given position in the sorted order
+	 */
+	T const &operator[](size_t position) const;
+
+  private:
+	std::vector<DrawSortEntry> entries;
+	std::vector<T>             items;
+	std::vector<DrawSortEntry> scratch;
+};
+
+template <typename T>
+inline void DrawList<T>::add(uint64_t key, T const &item)
+{
+	entries.push_back({key, static_cast<uint32_t>(items.size())});
+	items.push_back(item);
+}
+
+template <typename T>
+inline void DrawList<T>::clear()
+{
+	entries.clear();
+	items.clear();
+}
+
+template <typename T>
+inline bool DrawList<T>::empty() const
+{
+	return entries.empty();
+}
+
+template <typename T>
+inline size_t DrawList<T>::size() const
+{
+	return entries.size();
+}
+
+template <typename T>
+inline void DrawList<T>::sort()
+{
+	radix_sort(entries, scratch);
+}
+
+template <typename T>
+inline T const &DrawList<T>::operator[](size_t position) const
+{
+	return items[entries[position].index];
+}
+}        // namespace rendering
+}        // namespace vkb
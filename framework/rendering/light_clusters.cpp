@@ -0,0 +1,358 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "light_clusters.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include "common/job_system.h"
+#include "core/util/profiling.hpp"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#	include <xmmintrin.h>
+#	define VKB_LIGHT_CLUSTERS_SSE
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#	include <arm_neon.h>
+#	define VKB_LIGHT_CLUSTERS_NEON
+#endif
+
+namespace vkb
+{
+namespace rendering
+{
+namespace
+{
+// The smallest near depth, and the depth range used for a projection with an infinite far plane
+constexpr float MIN_NEAR_DEPTH      = 1e-4f;
+constexpr float INFINITE_FAR_FACTOR = 1e4f;
+}        // namespace
+
+LightClusters::LightClusters(const glm::uvec3 &grid_size) :
+    grid_size{glm::max(grid_size, glm::uvec3(1))}
+{
+	slices.resize(this->grid_size.z);
+	cluster_ranges.resize(get_cluster_count());
+}
+
+void LightClusters::update(const glm::mat4 &view, const glm::mat4 &projection_, const glm::uvec2 &extent_)
+{
+	info.view = view;
+
+	if (projection_ != projection || extent_ != extent)
+	{
+		projection = projection_;
+		extent     = glm::max(extent_, glm::uvec2(1));
+		compute_bounds();
+	}
+}
+
+void LightClusters::compute_bounds()
+{
+	glm::mat4 inverse_projection = glm::inverse(projection);
+
+	auto unproject = [&inverse_projection](float x, float y, float z) {
+		return inverse_projection * glm::vec4(x, y, z, 1.0f);
+	};
+
+	// The depth range is found from the depth buffer range, so it does not matter if the depth is reversed
+	glm::vec4 point_0 = unproject(0.0f, 0.0f, 0.0f);
+	glm::vec4 point_1 = unproject(0.0f, 0.0f, 1.0f);
+	float     depth_0 = std::abs(point_0.w) > std::numeric_limits<float>::epsilon() ? -point_0.z / point_0.w : std::numeric_limits<float>::infinity();
+	float     depth_1 = std::abs(point_1.w) > std::numeric_limits<float>::epsilon() ? -point_1.z / point_1.w : std::numeric_limits<float>::infinity();
+
+	near_depth = std::max(std::min(depth_0, depth_1), MIN_NEAR_DEPTH);
+	far_depth  = std::max(depth_0, depth_1);
+	if (!std::isfinite(far_depth) || far_depth <= near_depth)
+	{
+		far_depth = near_depth * INFINITE_FAR_FACTOR;
+	}
+
+	float log_depth_range = std::log(far_depth / near_depth);
+
+	info.grid_size  = glm::uvec4(grid_size, info.grid_size.w);
+	info.tile_scale = glm::vec4(static_cast<float>(grid_size.x) / extent.x,
+	                            static_cast<float>(grid_size.y) / extent.y,
+	                            grid_size.z / log_depth_range,
+	                            -(grid_size.z * std::log(near_depth)) / log_depth_range);
+
+	size_t cluster_count = get_cluster_count();
+	for (auto *bounds : {&min_x, &min_y, &min_z, &max_x, &max_y, &max_z})
+	{
+		bounds->resize(cluster_count);
+	}
+
+	for (uint32_t y = 0; y < grid_size.y; ++y)
+	{
+		for (uint32_t x = 0; x < grid_size.x; ++x)
+		{
+			// Each corner of a tile unprojects to a line in view space, for both perspective and orthographic
+			// projections. The line is found from two points at finite depths, even with an infinite far plane
+			std::array<glm::vec3, 4> line_points;
+			std::array<glm::vec3, 4> line_directions;
+			for (uint32_t corner = 0; corner < 4; ++corner)
+			{
+				float ndc_x = -1.0f + 2.0f * static_cast<float>(x + (corner & 1)) / grid_size.x;
+				float ndc_y = -1.0f + 2.0f * static_cast<float>(y + (corner >> 1)) / grid_size.y;
+
+				glm::vec4 a = unproject(ndc_x, ndc_y, 0.25f);
+				glm::vec4 b = unproject(ndc_x, ndc_y, 0.75f);
+
+				glm::vec3 point_a = glm::vec3(a) / a.w;
+				glm::vec3 point_b = glm::vec3(b) / b.w;
+
+				// Scaled so that a step of 1 along the line moves 1 deeper in view space
+				line_directions[corner] = (point_b - point_a) / (point_a.z - point_b.z);
+				line_points[corner]     = point_a + line_directions[corner] * point_a.z;
+			}
+
+			for (uint32_t z = 0; z < grid_size.z; ++z)
+			{
+				glm::vec3 cluster_min{std::numeric_limits<float>::max()};
+				glm::vec3 cluster_max{std::numeric_limits<float>::lowest()};
+				for (float depth : {get_slice_depth(z), get_slice_depth(z + 1)})
+				{
+					for (uint32_t corner = 0; corner < 4; ++corner)
+					{
+						glm::vec3 point = line_points[corner] + line_directions[corner] * depth;
+						cluster_min     = glm::min(cluster_min, point);
+						cluster_max     = glm::max(cluster_max, point);
+					}
+				}
+
+				size_t index = x + grid_size.x * (y + grid_size.y * z);
+				min_x[index] = cluster_min.x;
+				min_y[index] = cluster_min.y;
+				min_z[index] = cluster_min.z;
+				max_x[index] = cluster_max.x;
+				max_y[index] = cluster_max.y;
+				max_z[index] = cluster_max.z;
+			}
+		}
+	}
+}
+
+void LightClusters::bin(const std::vector<glm::vec4> &bounding_spheres, bool allow_parallel)
+{
+	PROFILE_SCOPE("Bin Lights");
+
+	size_t count = bounding_spheres.size();
+	for (auto *component : {&light_x, &light_y, &light_z, &light_radius_sq, &light_min_depth, &light_max_depth})
+	{
+		component->resize(count);
+	}
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		glm::vec4 center = info.view * glm::vec4(glm::vec3(bounding_spheres[i]), 1.0f);
+		float     radius = 0.0f < bounding_spheres[i].w ? bounding_spheres[i].w : std::numeric_limits<float>::infinity();
+
+		light_x[i]         = center.x;
+		light_y[i]         = center.y;
+		light_z[i]         = center.z;
+		light_radius_sq[i] = radius * radius;
+		light_min_depth[i] = -center.z - radius;
+		light_max_depth[i] = -center.z + radius;
+	}
+
+	info.grid_size.w = static_cast<uint32_t>(count);
+
+	if (allow_parallel && PARALLEL_LIGHT_COUNT <= count)
+	{
+		JobSystem::get().parallel_for(grid_size.z, 1, [this](size_t begin, size_t end) {
+			for (size_t slice_index = begin; slice_index < end; ++slice_index)
+			{
+				bin_slice(static_cast<uint32_t>(slice_index));
+			}
+		});
+	}
+	else
+	{
+		for (uint32_t slice_index = 0; slice_index < grid_size.z; ++slice_index)
+		{
+			bin_slice(slice_index);
+		}
+	}
+
+	// The slices list their lights independently, they are concatenated in cluster order
+	size_t total_count = 0;
+	for (auto const &slice : slices)
+	{
+		total_count += slice.light_indices.size();
+	}
+	light_indices.resize(total_count);
+
+	uint32_t slice_offset   = 0;
+	uint32_t slice_clusters = grid_size.x * grid_size.y;
+	for (uint32_t slice_index = 0; slice_index < grid_size.z; ++slice_index)
+	{
+		auto const &slice = slices[slice_index];
+		std::ranges::copy(slice.light_indices, light_indices.begin() + slice_offset);
+		for (uint32_t i = 0; i < slice_clusters; ++i)
+		{
+			cluster_ranges[slice_index * slice_clusters + i].x += slice_offset;
+		}
+		slice_offset += static_cast<uint32_t>(slice.light_indices.size());
+	}
+}
+
+void LightClusters::bin_slice(uint32_t slice_index)
+{
+	auto &slice = slices[slice_index];
+
+	float slice_near = get_slice_depth(slice_index);
+	float slice_far  = get_slice_depth(slice_index + 1);
+
+	slice.candidates.clear();
+	for (uint32_t i = 0; i < light_x.size(); ++i)
+	{
+		if (light_min_depth[i] <= slice_far && slice_near <= light_max_depth[i])
+		{
+			slice.candidates.push_back(i);
+		}
+	}
+
+	// Pad to a whole number of SIMD batches with spheres of negative squared radius, which overlap nothing
+	size_t padded_count = (slice.candidates.size() + 3) & ~size_t{3};
+	slice.x.resize(padded_count, 0.0f);
+	slice.y.resize(padded_count, 0.0f);
+	slice.z.resize(padded_count, 0.0f);
+	slice.radius_sq.resize(padded_count, -1.0f);
+	for (size_t i = 0; i < padded_count; ++i)
+	{
+		bool     padding   = slice.candidates.size() <= i;
+		uint32_t light     = padding ? 0 : slice.candidates[i];
+		slice.x[i]         = padding ? 0.0f : light_x[light];
+		slice.y[i]         = padding ? 0.0f : light_y[light];
+		slice.z[i]         = padding ? 0.0f : light_z[light];
+		slice.radius_sq[i] = padding ? -1.0f : light_radius_sq[light];
+	}
+
+	slice.light_indices.clear();
+
+	uint32_t first_cluster = slice_index * grid_size.x * grid_size.y;
+	for (uint32_t cluster = first_cluster; cluster < first_cluster + grid_size.x * grid_size.y; ++cluster)
+	{
+		uint32_t offset = static_cast<uint32_t>(slice.light_indices.size());
+
+		// A sphere overlaps a box if the squared distance from its center to the box is at most its squared radius
+#if defined(VKB_LIGHT_CLUSTERS_SSE)
+		__m128 box_min_x = _mm_set1_ps(min_x[cluster]);
+		__m128 box_min_y = _mm_set1_ps(min_y[cluster]);
+		__m128 box_min_z = _mm_set1_ps(min_z[cluster]);
+		__m128 box_max_x = _mm_set1_ps(max_x[cluster]);
+		__m128 box_max_y = _mm_set1_ps(max_y[cluster]);
+		__m128 box_max_z = _mm_set1_ps(max_z[cluster]);
+		__m128 zero      = _mm_setzero_ps();
+
+		for (size_t i = 0; i < padded_count; i += 4)
+		{
+			__m128 cx = _mm_loadu_ps(&slice.x[i]);
+			__m128 cy = _mm_loadu_ps(&slice.y[i]);
+			__m128 cz = _mm_loadu_ps(&slice.z[i]);
+
+			__m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(box_min_x, cx), _mm_sub_ps(cx, box_max_x)), zero);
+			__m128 dy = _mm_max_ps(_mm_max_ps(_mm_sub_ps(box_min_y, cy), _mm_sub_ps(cy, box_max_y)), zero);
+			__m128 dz = _mm_max_ps(_mm_max_ps(_mm_sub_ps(box_min_z, cz), _mm_sub_ps(cz, box_max_z)), zero);
+
+			__m128 distance_sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+
+			int overlap_mask = _mm_movemask_ps(_mm_cmple_ps(distance_sq, _mm_loadu_ps(&slice.radius_sq[i])));
+			for (size_t lane = 0; overlap_mask != 0; ++lane, overlap_mask >>= 1)
+			{
+				if (overlap_mask & 1)
+				{
+					slice.light_indices.push_back(slice.candidates[i + lane]);
+				}
+			}
+		}
+#elif defined(VKB_LIGHT_CLUSTERS_NEON)
+		float32x4_t box_min_x = vdupq_n_f32(min_x[cluster]);
+		float32x4_t box_min_y = vdupq_n_f32(min_y[cluster]);
+		float32x4_t box_min_z = vdupq_n_f32(min_z[cluster]);
+		float32x4_t box_max_x = vdupq_n_f32(max_x[cluster]);
+		float32x4_t box_max_y = vdupq_n_f32(max_y[cluster]);
+		float32x4_t box_max_z = vdupq_n_f32(max_z[cluster]);
+		float32x4_t zero      = vdupq_n_f32(0.0f);
+
+		for (size_t i = 0; i < padded_count; i += 4)
+		{
+			float32x4_t cx = vld1q_f32(&slice.x[i]);
+			float32x4_t cy = vld1q_f32(&slice.y[i]);
+			float32x4_t cz = vld1q_f32(&slice.z[i]);
+
+			float32x4_t dx = vmaxq_f32(vmaxq_f32(vsubq_f32(box_min_x, cx), vsubq_f32(cx, box_max_x)), zero);
+			float32x4_t dy = vmaxq_f32(vmaxq_f32(vsubq_f32(box_min_y, cy), vsubq_f32(cy, box_max_y)), zero);
+			float32x4_t dz = vmaxq_f32(vmaxq_f32(vsubq_f32(box_min_z, cz), vsubq_f32(cz, box_max_z)), zero);
+
+			float32x4_t distance_sq = vmlaq_f32(vmlaq_f32(vmulq_f32(dx, dx), dy, dy), dz, dz);
+
+			uint32_t overlap_lanes[4];
+			vst1q_u32(overlap_lanes, vcleq_f32(distance_sq, vld1q_f32(&slice.radius_sq[i])));
+			for (size_t lane = 0; lane < 4; ++lane)
+			{
+				if (overlap_lanes[lane] != 0)
+				{
+					slice.light_indices.push_back(slice.candidates[i + lane]);
+				}
+			}
+		}
+#else
+		for (size_t i = 0; i < slice.candidates.size(); ++i)
+		{
+			float dx = std::max(std::max(min_x[cluster] - slice.x[i], slice.x[i] - max_x[cluster]), 0.0f);
+			float dy = std::max(std::max(min_y[cluster] - slice.y[i], slice.y[i] - max_y[cluster]), 0.0f);
+			float dz = std::max(std::max(min_z[cluster] - slice.z[i], slice.z[i] - max_z[cluster]), 0.0f);
+			if (dx * dx + dy * dy + dz * dz <= slice.radius_sq[i])
+			{
+				slice.light_indices.push_back(slice.candidates[i]);
+			}
+		}
+#endif
+
+		cluster_ranges[cluster] = glm::uvec2(offset, static_cast<uint32_t>(slice.light_indices.size()) - offset);
+	}
+}
+
+float LightClusters::get_slice_depth(uint32_t slice_index) const
+{
+	return near_depth * std::pow(far_depth / near_depth, static_cast<float>(slice_index) / grid_size.z);
+}
+
+const std::vector<glm::uvec2> &LightClusters::get_cluster_ranges() const
+{
+	return cluster_ranges;
+}
+
+const std::vector<uint32_t> &LightClusters::get_light_indices() const
+{
+	return light_indices;
+}
+
+const LightClusterInfo &LightClusters::get_info() const
+{
+	return info;
+}
+
+uint32_t LightClusters::get_cluster_count() const
+{
+	return grid_size.x * grid_size.y * grid_size.z;
+}
+}        // namespace rendering
+}        // namespace vkb
@@ -0,0 +1,141 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "common/glm_common.h"
+
+namespace vkb
+{
+namespace rendering
+{
+/**
+ * @brief The cluster grid parameters read by the shaders, matching LightClusterInfo in clustered_lighting.h
+ */
+struct alignas(16) LightClusterInfo
+{
+	glm::mat4  view;
+	glm::uvec4 grid_size;         // w is the number of clustered lights
+	glm::vec4  tile_scale;        // xy map a fragment coordinate to a tile, z and w map the log of a view depth to a slice
+};
+
+/**
+ * @brief Assigns lights to the clusters of a froxel grid, which divides the view frustum in screen tiles and depth
+ *        slices, so that a fragment only shades the lights overlapping its cluster.
+ *
+ * The slices are spaced exponentially between the near and far planes, and the bounds of the clusters in view space
+ * are only recomputed when the projection or the extent changes. Each frame the lights, given as bounding spheres,
+ * are tested against the clusters of the slices they overlap, four at a time with SSE or NEON, and the slices are
+ * split across the job system.
+ *
+ * The binning only depends on glm and the job system, so it can run and be measured without a GPU.
+ */
+class LightClusters
+{
+  public:
+	static constexpr glm::uvec3 DEFAULT_GRID_SIZE{16, 9, 24};
+
+  public:
+	explicit LightClusters(const glm::uvec3 &grid_size = DEFAULT_GRID_SIZE);
+
+	/**
+	 * @brief Sets the camera of the next binning
+	 * @param view The view matrix
+	 * @param projection The Vulkan style projection matrix, perspective or orthographic, with normal or reversed depth
+	 * @param extent The size of the render target in pixels
+	 */
+	void update(const glm::mat4 &view, const glm::mat4 &projection, const glm::uvec2 &extent);
+
+	/**
+	 * @brief Assigns the lights to the clusters they overlap
+	 * @param bounding_spheres The center of each light in world space, and its range, or 0 for a light of infinite range
+	 * @param allow_parallel Split large batches across the job system
+	 */
+	void bin(const std::vector<glm::vec4> &bounding_spheres, bool allow_parallel = true);
+
+	/**
+	 * @return The offset in the light indices and the number of lights of each cluster, indexed by
+	 *         x + grid_size.x * (y + grid_size.y * z)
+	 */
+	const std::vector<glm::uvec2> &get_cluster_ranges() const;
+
+	/**
+	 * @return The indices of the lights of all the clusters, in cluster order
+	 */
+	const std::vector<uint32_t> &get_light_indices() const;
+
+	const LightClusterInfo &get_info() const;
+
+	uint32_t get_cluster_count() const;
+
+  private:
+	static constexpr size_t PARALLEL_LIGHT_COUNT = 256;
+
+	/**
+	 * @brief The lights overlapping the depth range of a slice, gathered for the SIMD tests, and the lights found in
+	 *        its clusters
+	 */
+	struct Slice
+	{
+		std::vector<uint32_t> candidates;
+		std::vector<float>    x;
+		std::vector<float>    y;
+		std::vector<float>    z;
+		std::vector<float>    radius_sq;
+		std::vector<uint32_t> light_indices;
+	};
+
+  private:
+	void compute_bounds();
+
+	void bin_slice(uint32_t slice_index);
+
+	float get_slice_depth(uint32_t slice_index) const;
+
+  private:
+	glm::uvec2 extent{0, 0};
+	glm::uvec3 grid_size;
+	float      near_depth = 0.0f;
+	float      far_depth  = 0.0f;
+	glm::mat4  projection{0.0f};
+
+	LightClusterInfo info{};
+
+	// The view space bounds of the clusters
+	std::vector<float> min_x;
+	std::vector<float> min_y;
+	std::vector<float> min_z;
+	std::vector<float> max_x;
+	std::vector<float> max_y;
+	std::vector<float> max_z;
+
+	// The view space bounding spheres of the lights, and their depth ranges
+	std::vector<float> light_x;
+	std::vector<float> light_y;
+	std::vector<float> light_z;
+	std::vector<float> light_radius_sq;
+	std::vector<float> light_min_depth;
+	std::vector<float> light_max_depth;
+
+	std::vector<Slice>      slices;
+	std::vector<glm::uvec2> cluster_ranges;
+	std::vector<uint32_t>   light_indices;
+};
+}        // namespace rendering
+}        // namespace vkb
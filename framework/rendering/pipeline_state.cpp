@@ -338,6 +338,21 @@ uint32_t PipelineState::get_subpass_index() const
 	return subpass_index;
 }
 
+bool PipelineState::operator==(const PipelineState &other) const
+{
+	return pipeline_layout == other.pipeline_layout &&
+	       render_pass == other.render_pass &&
+	       specialization_constant_state.get_specialization_constant_state() == other.specialization_constant_state.get_specialization_constant_state() &&
+	       !(vertex_input_state != other.vertex_input_state) &&
+	       !(input_assembly_state != other.input_assembly_state) &&
+	       !(rasterization_state != other.rasterization_state) &&
+	       !(viewport_state != other.viewport_state) &&
+	       !(multisample_state != other.multisample_state) &&
+	       !(depth_stencil_state != other.depth_stencil_state) &&
+	       !(color_blend_state != other.color_blend_state) &&
+	       subpass_index == other.subpass_index;
+}
+
 bool PipelineState::is_dirty() const
 {
 	return dirty || specialization_constant_state.is_dirty();
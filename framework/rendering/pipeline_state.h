@@ -174,6 +174,11 @@ inline void SpecializationConstantState::set_constant<bool>(std::uint32_t consta
 class PipelineState
 {
   public:
+	/**
+	 * @brief Compares all state that is used to build a pipeline, ignoring the dirty flags
+	 */
+	bool operator==(const PipelineState &other) const;
+
 	void reset();
 
 	void set_pipeline_layout(PipelineLayout &pipeline_layout);
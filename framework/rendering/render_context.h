@@ -53,7 +53,10 @@ using RenderFrameCpp = RenderFrame<BindingType::Cpp>;
  * It requires a Device to be valid on creation, and will take control of a given Swapchain.
  *
  * For normal rendering (using a swapchain), the RenderContext can be created by passing in a
- * swapchain. A RenderFrame will then be created for each Swapchain image.
+ * swapchain. A RenderFrame will then be created for each Swapchain image, unless a number of
+ * frames in flight is set with set_frames_in_flight. The frames are then used in turn, whichever
+ * image is acquired, and the render target and present semaphore of each image are owned by the
+ * RenderContext, so the per-frame memory depends on the latency wanted rather than on the present mode.
  *
  * For offscreen rendering (no swapchain), the RenderContext can be given a valid Device, and
  * a width and height. A single RenderFrame will then be created.
@@ -65,10 +68,14 @@ class RenderContext
 	// The format to use for the RenderTargets if a swapchain isn't created
 	static inline vk::Format DEFAULT_VK_FORMAT = vk::Format::eR8G8B8A8Srgb;
 
+	// The default size of the ring buffer of each usage, doubled for storage buffers
+	static constexpr vk::DeviceSize STREAMING_BUFFER_CAPACITY = 4 * 1024 * 1024;
+
   public:
 	using QueueType     = typename std::conditional<bindingType == BindingType::Cpp, vkb::core::HPPQueue, vkb::Queue>::type;
 	using SwapchainType = typename std::conditional<bindingType == BindingType::Cpp, vkb::core::HPPSwapchain, vkb::Swapchain>::type;
 
+	using BufferUsageFlagsType               = typename std::conditional<bindingType == BindingType::Cpp, vk::BufferUsageFlags, VkBufferUsageFlags>::type;
 	using Extent2DType                       = typename std::conditional<bindingType == BindingType::Cpp, vk::Extent2D, VkExtent2D>::type;
 	using FormatType                         = typename std::conditional<bindingType == BindingType::Cpp, vk::Format, VkFormat>::type;
 	using ImageCompressionFixedRateFlagsType = typename std::conditional<bindingType == BindingType::Cpp, vk::ImageCompressionFixedRateFlagsEXT, VkImageCompressionFixedRateFlagsEXT>::type;
@@ -108,7 +115,7 @@ class RenderContext
 	RenderContext(const RenderContext &) = delete;
 	RenderContext(RenderContext &&)      = delete;
 
-	virtual ~RenderContext() = default;
+	virtual ~RenderContext();
 
 	RenderContext &operator=(const RenderContext &) = delete;
 	RenderContext &operator=(RenderContext &&)      = delete;
@@ -149,6 +156,20 @@ class RenderContext
 	 */
 	uint32_t get_active_frame_index() const;
 
+	/**
+	 * @brief An error should be raised if the frame is not active.
+	 *        A frame is active after @ref begin_frame has been called.
+	 * @return The index of the swapchain image acquired for the active frame, equal to the active frame index
+	 *         unless a number of frames in flight is set
+	 */
+	uint32_t get_active_image_index() const;
+
+	/**
+	 * @brief Returns the descriptor set cache shared by all frames of this context
+	 *        It is used by frames with the DescriptorManagementStrategy::ShareAcrossFrames strategy
+	 */
+	vkb::rendering::DescriptorSetCache &get_descriptor_set_cache();
+
 	vkb::core::Device<bindingType> &get_device();
 
 	/**
@@ -165,6 +186,14 @@ class RenderContext
 
 	std::vector<std::unique_ptr<vkb::rendering::RenderFrame<bindingType>>> &get_render_frames();
 
+	/**
+	 * @brief Returns the ring buffer of the given usage shared by all frames of this context, valid after @ref prepare
+	 *        It is used by frames with the BufferAllocationStrategy::SharedRingBuffer strategy, and its statistics
+	 *        report the high-water mark to size it for a scene with StreamingBuffer::set_capacity
+	 * @param usage One of the usages supported by RenderFrame::allocate_buffer
+	 */
+	vkb::rendering::StreamingBuffer &get_streaming_buffer(BufferUsageFlagsType usage);
+
 	Extent2DType const &get_surface_extent() const;
 
 	SwapchainType const &get_swapchain() const;
@@ -200,6 +229,13 @@ class RenderContext
 	SemaphoreType request_semaphore();
 	SemaphoreType request_semaphore_with_ownership();
 
+	/**
+	 * @brief Sets the number of frames recorded while the GPU renders the previous ones, independently of the
+	 *        number of swapchain images. Must be called before @ref prepare
+	 * @param count The number of RenderFrames to create, 0 to create one for each swapchain image
+	 */
+	void set_frames_in_flight(uint32_t count);
+
 	/**
 	 * @brief Submits the command buffer to the right queue
 	 * @param command_buffer A command buffer containing recorded commands
@@ -260,28 +296,51 @@ class RenderContext
 	virtual void wait_frame();
 
   private:
+	/**
+	 * @brief Connects a new frame to the descriptor set cache and ring buffers shared by all frames
+	 */
+	void          attach_shared_resources(vkb::rendering::RenderFrameCpp &frame);
+	/**
+	 * @brief Creates the render target and present semaphore of each swapchain image, when the frames in flight are
+	 *        decoupled from the images
+	 */
+	void          create_image_resources();
+	void          destroy_present_semaphores();
+	/**
+	 * @brief Drops the frames beyond the given count, except the active one, when the swapchain lost images
+	 *        The device must be idle
+	 */
+	void          drop_frames(size_t frame_count);
+	bool          has_frames_in_flight() const;
 	void          initialize_swapchain(vk::SurfaceKHR surface, vk::PresentModeKHR present_movde, std::vector<vk::PresentModeKHR> const &present_mode_priority_list, std::vector<vk::SurfaceFormatKHR> const &surface_format_priority_list);
 	void          submit_impl(const std::vector<std::shared_ptr<vkb::core::CommandBufferCpp>> &command_buffers);
 	vk::Semaphore submit_impl(vkb::core::HPPQueue const                                       &queue,
 	                          std::vector<std::shared_ptr<vkb::core::CommandBufferCpp>> const &command_buffers,
 	                          vk::Semaphore                                                    wait_semaphore,
-	                          vk::PipelineStageFlags                                           wait_pipeline_stage);
+	                          vk::PipelineStageFlags                                           wait_pipeline_stage,
+	                          vk::Semaphore                                                    signal_semaphore = nullptr);
 	void          submit_impl(vkb::core::HPPQueue const &queue, std::vector<std::shared_ptr<vkb::core::CommandBufferCpp>> const &command_buffers);
 	void          update_swapchain_impl(vk::Extent2D const &extent, vk::SurfaceTransformFlagBitsKHR transform);
 
   private:
 	vk::Semaphore                                                acquired_semaphore;
 	uint32_t                                                     active_frame_index        = 0;        // Current active frame index
+	uint32_t                                                     active_image_index        = 0;        // Swapchain image acquired for the active frame
 	RenderTargetCpp::CreateFunc                                  create_render_target_func = RenderTargetCpp::DEFAULT_CREATE_FUNC;
+	vkb::rendering::DescriptorSetCache                           descriptor_set_cache;        // Descriptor sets shared across frames
 	vkb::core::DeviceCpp                                        &device;
 	bool                                                         frame_active = false;        // Whether a frame is active or not
 	std::vector<std::unique_ptr<vkb::rendering::RenderFrameCpp>> frames;
-	vk::SurfaceTransformFlagBitsKHR                              pre_transform = vk::SurfaceTransformFlagBitsKHR::eIdentity;
-	bool                                                         prepared      = false;
+	uint32_t                                                     frames_in_flight = 0;        // 0 for one frame per swapchain image
+	vk::SurfaceTransformFlagBitsKHR                              pre_transform    = vk::SurfaceTransformFlagBitsKHR::eIdentity;
+	bool                                                         prepared         = false;
+	std::vector<vk::Semaphore>                                   present_semaphores;        // Per swapchain image, if the frames in flight are set
 	const vkb::core::HPPQueue                                   &queue;        // If swapchain exists, then this will be a present supported queue, else a graphics queue
 	vk::Extent2D                                                 surface_extent;
 	std::unique_ptr<vkb::core::HPPSwapchain>                     swapchain;
 	vkb::core::HPPSwapchainProperties                            swapchain_properties;
+	std::vector<std::unique_ptr<RenderTargetCpp>>                swapchain_render_targets;        // Per swapchain image, if the frames in flight are set
+	std::vector<std::unique_ptr<StreamingBuffer>>                streaming_buffers;        // Ring buffers shared across frames, per usage index
 	size_t                                                       thread_count = 1;
 	const vkb::Window                                           &window;
 };
@@ -298,6 +357,7 @@ inline RenderContextCpp::RenderContext(vkb::core::DeviceCpp                    &
                                        vk::PresentModeKHR                       present_mode,
                                        std::vector<vk::PresentModeKHR> const   &present_mode_priority_list,
                                        std::vector<vk::SurfaceFormatKHR> const &surface_format_priority_list) :
+    descriptor_set_cache(device),
     device(device),
     window(window),
     queue(device.get_queue_by_flags(vk::QueueFlagBits::eGraphics, 0)),
@@ -313,6 +373,7 @@ inline RenderContextC::RenderContext(vkb::core::DeviceC                    &devi
                                      VkPresentModeKHR                       present_mode,
                                      const std::vector<VkPresentModeKHR>   &present_mode_priority_list,
                                      const std::vector<VkSurfaceFormatKHR> &surface_format_priority_list) :
+    descriptor_set_cache(reinterpret_cast<vkb::core::DeviceCpp &>(device)),
     device(reinterpret_cast<vkb::core::DeviceCpp &>(device)),
     window(window),
     queue(reinterpret_cast<vkb::core::HPPQueue const &>(device.get_queue_by_flags(VK_QUEUE_GRAPHICS_BIT, 0))),
@@ -324,6 +385,88 @@ inline RenderContextC::RenderContext(vkb::core::DeviceC                    &devi
 	                     reinterpret_cast<std::vector<vk::SurfaceFormatKHR> const &>(surface_format_priority_list));
 }
 
+template <vkb::BindingType bindingType>
+inline RenderContext<bindingType>::~RenderContext()
+{
+	destroy_present_semaphores();
+}
+
+template <vkb::BindingType bindingType>
+inline void RenderContext<bindingType>::attach_shared_resources(vkb::rendering::RenderFrameCpp &frame)
+{
+	frame.set_descriptor_set_cache(descriptor_set_cache);
+	for (auto &streaming_buffer : streaming_buffers)
+	{
+		frame.set_streaming_buffer(*streaming_buffer);
+	}
+}
+
+template <vkb::BindingType bindingType>
+inline void RenderContext<bindingType>::create_image_resources()
+{
+	// The previous present semaphores may still be waited on
+	device.get_handle().waitIdle();
+	destroy_present_semaphores();
+	swapchain_render_targets.clear();
+
+	vk::Extent2D swapchain_extent = swapchain->get_extent();
+	vk::Extent3D extent{swapchain_extent.width, swapchain_extent.height, 1};
+
+	for (auto &image_handle : swapchain->get_images())
+	{
+		vkb::core::HPPImage swapchain_image{device, image_handle, extent, swapchain->get_format(), swapchain->get_usage()};
+		swapchain_render_targets.push_back(create_render_target_func(std::move(swapchain_image)));
+
+		// An image is only acquired again once its previous present completed, so its semaphore can be reused then,
+		// unlike the semaphores of a frame which are recycled as soon as its fences signalled
+		present_semaphores.push_back(device.get_handle().createSemaphore({}));
+	}
+
+	// The frames point to the render target of the image they acquire, and to a valid one until then
+	for (size_t i = 0; i < frames.size(); ++i)
+	{
+		frames[i]->set_render_target(*swapchain_render_targets[i % swapchain_render_targets.size()]);
+	}
+}
+
+template <vkb::BindingType bindingType>
+inline void RenderContext<bindingType>::destroy_present_semaphores()
+{
+	for (auto semaphore : present_semaphores)
+	{
+		device.get_handle().destroySemaphore(semaphore);
+	}
+	present_semaphores.clear();
+}
+
+template <vkb::BindingType bindingType>
+inline void RenderContext<bindingType>::drop_frames(size_t frame_count)
+{
+	// The active frame may still be recorded into, so it is kept until the next recreation
+	if (frame_active)
+	{
+		frame_count = std::max<size_t>(frame_count, active_frame_index + 1);
+	}
+
+	while (frame_count < frames.size())
+	{
+		// A dropped frame must not pin the retired serial of the descriptor set cache or the tail of the ring buffers
+		frames.back()->detach_shared_resources();
+		frames.pop_back();
+	}
+
+	if (frames.size() <= active_frame_index)
+	{
+		active_frame_index = 0;
+	}
+}
+
+template <vkb::BindingType bindingType>
+inline bool RenderContext<bindingType>::has_frames_in_flight() const
+{
+	return swapchain && (frames_in_flight != 0);
+}
+
 template <vkb::BindingType bindingType>
 inline void RenderContext<bindingType>::initialize_swapchain(vk::SurfaceKHR                           surface,
                                                              vk::PresentModeKHR                       present_mode,
@@ -383,6 +526,17 @@ inline void RenderContext<bindingType>::begin_frame()
 
 	assert(!frame_active && "Frame is still active, please call end_frame");
 
+	bool decoupled = has_frames_in_flight();
+	if (decoupled)
+	{
+		// The frames are used in turn, whichever image is acquired, so the next one is waited for
+		// before its semaphores are reused, and the acquire does not have to wait for a particular frame
+		active_frame_index = (active_frame_index + 1) % to_u32(frames.size());
+		frame_active       = true;
+		wait_frame();
+		frame_active = false;
+	}
+
 	auto &prev_frame = *frames[active_frame_index];
 
 	// We will use the acquired semaphore in a different frame context,
@@ -394,7 +548,7 @@ inline void RenderContext<bindingType>::begin_frame()
 		vk::Result result;
 		try
 		{
-			std::tie(result, active_frame_index) = swapchain->acquire_next_image(acquired_semaphore);
+			std::tie(result, active_image_index) = swapchain->acquire_next_image(acquired_semaphore);
 		}
 		catch (vk::OutOfDateKHRError & /*err*/)
 		{
@@ -416,7 +570,7 @@ inline void RenderContext<bindingType>::begin_frame()
 				// Need to destroy and reallocate acquired_semaphore since it may have already been signaled
 				device.get_handle().destroySemaphore(acquired_semaphore);
 				acquired_semaphore                   = prev_frame.get_semaphore_pool().request_semaphore_with_ownership();
-				std::tie(result, active_frame_index) = swapchain->acquire_next_image(acquired_semaphore);
+				std::tie(result, active_image_index) = swapchain->acquire_next_image(acquired_semaphore);
 			}
 		}
 
@@ -425,13 +579,25 @@ inline void RenderContext<bindingType>::begin_frame()
 			prev_frame.reset();
 			return;
 		}
+
+		if (decoupled)
+		{
+			prev_frame.set_render_target(*swapchain_render_targets[active_image_index]);
+		}
+		else
+		{
+			active_frame_index = active_image_index;
+		}
 	}
 
 	// Now the frame is active again
 	frame_active = true;
 
-	// Wait on all resource to be freed from the previous render to this frame
-	wait_frame();
+	// Wait on all resource to be freed from the previous render to this frame, unless it was done before the acquire
+	if (!decoupled)
+	{
+		wait_frame();
+	}
 }
 
 template <vkb::BindingType bindingType>
@@ -446,10 +612,11 @@ inline void RenderContext<bindingType>::end_frame(SemaphoreType semaphore)
 {
 	assert(frame_active && "Frame is not active, please call begin_frame");
 
+	bool surface_changed = false;
 	if (swapchain)
 	{
 		vk::SwapchainKHR   vk_swapchain = swapchain->get_handle();
-		vk::PresentInfoKHR present_info{.waitSemaphoreCount = 1, .swapchainCount = 1, .pSwapchains = &vk_swapchain, .pImageIndices = &active_frame_index};
+		vk::PresentInfoKHR present_info{.waitSemaphoreCount = 1, .swapchainCount = 1, .pSwapchains = &vk_swapchain, .pImageIndices = &active_image_index};
 		if constexpr (bindingType == BindingType::Cpp)
 		{
 			present_info.pWaitSemaphores = &semaphore;
@@ -477,10 +644,7 @@ inline void RenderContext<bindingType>::end_frame(SemaphoreType semaphore)
 			result = vk::Result::eErrorOutOfDateKHR;
 		}
 
-		if (result == vk::Result::eSuboptimalKHR || result == vk::Result::eErrorOutOfDateKHR)
-		{
-			handle_surface_changes();
-		}
+		surface_changed = (result == vk::Result::eSuboptimalKHR || result == vk::Result::eErrorOutOfDateKHR);
 	}
 
 	// Frame is not active anymore
@@ -490,6 +654,12 @@ inline void RenderContext<bindingType>::end_frame(SemaphoreType semaphore)
 		acquired_semaphore = nullptr;
 	}
 	frame_active = false;
+
+	// Handled once the frame ended, so that a recreation may drop it
+	if (surface_changed)
+	{
+		handle_surface_changes();
+	}
 }
 
 template <vkb::BindingType bindingType>
@@ -513,6 +683,19 @@ inline uint32_t RenderContext<bindingType>::get_active_frame_index() const
 	return active_frame_index;
 }
 
+template <vkb::BindingType bindingType>
+inline uint32_t RenderContext<bindingType>::get_active_image_index() const
+{
+	assert(frame_active && "Frame is not active, please call begin_frame");
+	return active_image_index;
+}
+
+template <vkb::BindingType bindingType>
+inline vkb::rendering::DescriptorSetCache &RenderContext<bindingType>::get_descriptor_set_cache()
+{
+	return descriptor_set_cache;
+}
+
 template <vkb::BindingType bindingType>
 inline vkb::core::Device<bindingType> &RenderContext<bindingType>::get_device()
 {
@@ -580,6 +763,14 @@ inline typename RenderContext<bindingType>::Extent2DType const &RenderContext<bi
 	}
 }
 
+template <vkb::BindingType bindingType>
+inline vkb::rendering::StreamingBuffer &RenderContext<bindingType>::get_streaming_buffer(BufferUsageFlagsType usage)
+{
+	size_t usage_index = vkb::rendering::get_buffer_usage_index(static_cast<vk::BufferUsageFlags>(usage));
+	assert(usage_index < streaming_buffers.size() && streaming_buffers[usage_index] && "No streaming buffer for this usage, please call prepare");
+	return *streaming_buffers[usage_index];
+}
+
 template <vkb::BindingType bindingType>
 inline typename RenderContext<bindingType>::SwapchainType const &RenderContext<bindingType>::get_swapchain() const
 {
@@ -658,17 +849,41 @@ inline void RenderContext<bindingType>::prepare(size_t thread_count, typename vk
 
 	device.get_handle().waitIdle();
 
+	if (streaming_buffers.empty())
+	{
+		// Storage buffers get a larger ring, as in the frames' buffer pools, the memory is only allocated on first use
+		for (auto usage : vkb::rendering::SUPPORTED_BUFFER_USAGES)
+		{
+			streaming_buffers.push_back(std::make_unique<vkb::rendering::StreamingBuffer>(
+			    device, usage, (usage == vk::BufferUsageFlagBits::eStorageBuffer ? 2 : 1) * STREAMING_BUFFER_CAPACITY));
+		}
+	}
+
 	if (swapchain)
 	{
 		surface_extent = swapchain->get_extent();
 
-		vk::Extent3D extent{surface_extent.width, surface_extent.height, 1};
-
-		for (auto &image_handle : swapchain->get_images())
+		if (has_frames_in_flight())
 		{
-			vkb::core::HPPImage swapchain_image{device, image_handle, extent, swapchain->get_format(), swapchain->get_usage()};
-			auto                render_target = create_render_target_func(std::move(swapchain_image));
-			frames.emplace_back(std::make_unique<vkb::rendering::RenderFrameCpp>(device, std::move(render_target), thread_count));
+			// The frames do not own a render target, they use the one of the image they acquire
+			for (uint32_t i = 0; i < frames_in_flight; ++i)
+			{
+				frames.emplace_back(std::make_unique<vkb::rendering::RenderFrameCpp>(device, std::unique_ptr<RenderTargetCpp>{}, thread_count));
+				attach_shared_resources(*frames.back());
+			}
+			create_image_resources();
+		}
+		else
+		{
+			vk::Extent3D extent{surface_extent.width, surface_extent.height, 1};
+
+			for (auto &image_handle : swapchain->get_images())
+			{
+				vkb::core::HPPImage swapchain_image{device, image_handle, extent, swapchain->get_format(), swapchain->get_usage()};
+				auto                render_target = create_render_target_func(std::move(swapchain_image));
+				frames.emplace_back(std::make_unique<vkb::rendering::RenderFrameCpp>(device, std::move(render_target), thread_count));
+				attach_shared_resources(*frames.back());
+			}
 		}
 	}
 	else
@@ -684,6 +899,7 @@ inline void RenderContext<bindingType>::prepare(size_t thread_count, typename vk
 
 		std::unique_ptr<RenderTargetCpp> render_target = create_render_target_func(std::move(color_image));
 		frames.emplace_back(std::make_unique<vkb::rendering::RenderFrameCpp>(device, std::move(render_target), thread_count));
+		attach_shared_resources(*frames.back());
 	}
 
 	this->thread_count = thread_count;
@@ -695,31 +911,49 @@ inline void RenderContext<bindingType>::recreate()
 {
 	LOGI("Recreated swapchain");
 
-	vk::Extent2D swapchain_extent = swapchain->get_extent();
-	vk::Extent3D extent{swapchain_extent.width, swapchain_extent.height, 1};
-
-	auto frame_it = frames.begin();
-
-	for (auto &image_handle : swapchain->get_images())
+	if (has_frames_in_flight())
 	{
-		vkb::core::HPPImage swapchain_image{device, image_handle, extent, swapchain->get_format(), swapchain->get_usage()};
+		// The number of frames does not depend on the number of images
+		create_image_resources();
+	}
+	else
+	{
+		vk::Extent2D swapchain_extent = swapchain->get_extent();
+		vk::Extent3D extent{swapchain_extent.width, swapchain_extent.height, 1};
 
-		auto render_target = create_render_target_func(std::move(swapchain_image));
+		auto frame_it = frames.begin();
 
-		if (frame_it != frames.end())
-		{
-			(*frame_it)->update_render_target(std::move(render_target));
-		}
-		else
+		for (auto &image_handle : swapchain->get_images())
 		{
-			// Create a new frame if the new swapchain has more images than current frames
-			frames.emplace_back(std::make_unique<vkb::rendering::RenderFrameCpp>(device, std::move(render_target), thread_count));
-		}
+			vkb::core::HPPImage swapchain_image{device, image_handle, extent, swapchain->get_format(), swapchain->get_usage()};
 
-		++frame_it;
+			auto render_target = create_render_target_func(std::move(swapchain_image));
+
+			if (frame_it != frames.end())
+			{
+				(*frame_it)->update_render_target(std::move(render_target));
+			}
+			else
+			{
+				// Create a new frame if the new swapchain has more images than current frames
+				frames.emplace_back(std::make_unique<vkb::rendering::RenderFrameCpp>(device, std::move(render_target), thread_count));
+				attach_shared_resources(*frames.back());
+			}
+
+			++frame_it;
+		}
 	}
 
 	device.get_resource_cache().clear_framebuffers();
+
+	// Cached descriptor sets may still reference the previous attachments
+	device.get_handle().waitIdle();
+	descriptor_set_cache.clear();
+
+	if (!has_frames_in_flight())
+	{
+		drop_frames(swapchain->get_images().size());
+	}
 }
 
 template <vkb::BindingType bindingType>
@@ -727,6 +961,13 @@ inline void RenderContext<bindingType>::recreate_swapchain()
 {
 	device.get_handle().waitIdle();
 	device.get_resource_cache().clear_framebuffers();
+	descriptor_set_cache.clear();
+
+	if (has_frames_in_flight())
+	{
+		create_image_resources();
+		return;
+	}
 
 	vk::Extent2D swapchain_extent = swapchain->get_extent();
 	vk::Extent3D extent{swapchain_extent.width, swapchain_extent.height, 1};
@@ -741,6 +982,8 @@ inline void RenderContext<bindingType>::recreate_swapchain()
 
 		++frame_it;
 	}
+
+	drop_frames(swapchain->get_images().size());
 }
 
 template <vkb::BindingType bindingType>
@@ -761,6 +1004,13 @@ inline typename RenderContext<bindingType>::SemaphoreType RenderContext<bindingT
 	return get_active_frame().get_semaphore_pool().request_semaphore_with_ownership();
 }
 
+template <vkb::BindingType bindingType>
+inline void RenderContext<bindingType>::set_frames_in_flight(uint32_t count)
+{
+	assert(!prepared && "The frames in flight can only be set before prepare");
+	frames_in_flight = count;
+}
+
 template <vkb::BindingType bindingType>
 inline void RenderContext<bindingType>::submit(std::shared_ptr<vkb::core::CommandBuffer<bindingType>> command_buffer)
 {
@@ -791,7 +1041,8 @@ inline void RenderContext<bindingType>::submit_impl(std::vector<std::shared_ptr<
 	if (swapchain)
 	{
 		assert(acquired_semaphore && "We do not have acquired_semaphore, it was probably consumed?\n");
-		render_semaphore = submit_impl(queue, command_buffers, acquired_semaphore, vk::PipelineStageFlagBits::eColorAttachmentOutput);
+		vk::Semaphore present_semaphore = has_frames_in_flight() ? present_semaphores[active_image_index] : nullptr;
+		render_semaphore                = submit_impl(queue, command_buffers, acquired_semaphore, vk::PipelineStageFlagBits::eColorAttachmentOutput, present_semaphore);
 	}
 	else
 	{
@@ -825,14 +1076,18 @@ template <vkb::BindingType bindingType>
 inline vk::Semaphore RenderContext<bindingType>::submit_impl(const vkb::core::HPPQueue                                       &queue,
                                                              const std::vector<std::shared_ptr<vkb::core::CommandBufferCpp>> &command_buffers,
                                                              vk::Semaphore                                                    wait_semaphore,
-                                                             vk::PipelineStageFlags                                           wait_pipeline_stage)
+                                                             vk::PipelineStageFlags                                           wait_pipeline_stage,
+                                                             vk::Semaphore                                                    signal_semaphore)
 {
 	std::vector<vk::CommandBuffer> cmd_buf_handles(command_buffers.size(), nullptr);
 	std::ranges::transform(command_buffers, cmd_buf_handles.begin(), [](auto const &cmd_buf) { return cmd_buf->get_handle(); });
 
 	vkb::rendering::RenderFrameCpp &frame = *frames[active_frame_index];
 
-	vk::Semaphore signal_semaphore = frame.get_semaphore_pool().request_semaphore();
+	if (!signal_semaphore)
+	{
+		signal_semaphore = frame.get_semaphore_pool().request_semaphore();
+	}
 
 	vk::SubmitInfo submit_info{.commandBufferCount   = to_u32(cmd_buf_handles.size()),
 	                           .pCommandBuffers      = cmd_buf_handles.data(),
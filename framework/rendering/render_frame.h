@@ -17,12 +17,17 @@
 
 #pragma once
 
+#include <array>
+#include <bit>
+
 #include "buffer_pool.h"
 #include "common/hpp_resource_caching.h"
 #include "core/command_pool.h"
 #include "core/hpp_queue.h"
 #include "core/queue.h"
 #include "hpp_semaphore_pool.h"
+#include "rendering/descriptor_set_cache.h"
+#include "rendering/streaming_buffer.h"
 
 namespace vkb
 {
@@ -31,18 +36,39 @@ namespace rendering
 enum BufferAllocationStrategy
 {
 	OneAllocationPerBuffer,
-	MultipleAllocationsPerBuffer
+	MultipleAllocationsPerBuffer,
+	SharedRingBuffer        // Use the RenderContext's StreamingBuffer of each usage, shared by all frames, falling back to the frame's pools when it is full
 };
 
 enum DescriptorManagementStrategy
 {
 	StoreInCache,
-	CreateDirectly
+	CreateDirectly,
+	ShareAcrossFrames        // Use the RenderContext's DescriptorSetCache, shared by all frames and keyed by content
 };
 
+/**
+ * @brief The buffer usages supported by RenderFrame::allocate_buffer, in increasing bit order
+ */
+inline constexpr std::array<vk::BufferUsageFlagBits, 4> SUPPORTED_BUFFER_USAGES = {
+    vk::BufferUsageFlagBits::eUniformBuffer, vk::BufferUsageFlagBits::eStorageBuffer, vk::BufferUsageFlagBits::eIndexBuffer, vk::BufferUsageFlagBits::eVertexBuffer};
+
+/**
+ * @return The index of usage in SUPPORTED_BUFFER_USAGES, or SUPPORTED_BUFFER_USAGES.size() if it is not supported
+ */
+inline size_t get_buffer_usage_index(vk::BufferUsageFlags usage)
+{
+	// The supported usages are consecutive single bits, so the index is the bit position relative to the first one
+	uint32_t bits  = static_cast<uint32_t>(usage);
+	size_t   index = std::countr_zero(bits) - std::countr_zero(static_cast<uint32_t>(SUPPORTED_BUFFER_USAGES[0]));
+	return (std::has_single_bit(bits) && index < SUPPORTED_BUFFER_USAGES.size()) ? index : SUPPORTED_BUFFER_USAGES.size();
+}
+
 /**
  * @brief RenderFrame is a container for per-frame data, including BufferPool objects,
  * synchronization primitives (semaphores, fences) and the swapchain RenderTarget.
+ * The RenderTarget is either owned by the frame, or owned by the RenderContext and shared
+ * by the frames that render to the same swapchain image.
  *
  * When creating a RenderTarget, we need to provide images that will be used as attachments
  * within a RenderPass. The RenderFrame is responsible for creating a RenderTarget using
@@ -88,6 +114,12 @@ class RenderFrame
 
 	void clear_descriptors();
 
+	/**
+	 * @brief Releases the slots of the frame in its descriptor set cache and ring buffers, before dropping the frame
+	 *        The frame must have no work in flight
+	 */
+	void detach_shared_resources();
+
 	/**
 	 * @brief Get the command pool of the active frame
 	 *        A frame should be active at the moment of requesting it
@@ -119,12 +151,32 @@ class RenderFrame
 	 */
 	void set_buffer_allocation_strategy(BufferAllocationStrategy new_strategy);
 
+	/**
+	 * @brief Sets the cache used by the DescriptorManagementStrategy::ShareAcrossFrames strategy
+	 *        The frame registers itself with the cache, so that sets it used are only recycled once its fences signalled
+	 * @param cache The cache shared by all the frames of a RenderContext
+	 */
+	void set_descriptor_set_cache(vkb::rendering::DescriptorSetCache &cache);
+
 	/**
 	 * @brief Sets a new descriptor set management strategy
 	 * @param new_strategy The new descriptor set management strategy
 	 */
 	void set_descriptor_management_strategy(DescriptorManagementStrategy new_strategy);
 
+	/**
+	 * @brief Points the frame to a render target it does not own, such as the one of the swapchain image acquired for it
+	 * @param render_target A render target outliving its use by the frame
+	 */
+	void set_render_target(vkb::rendering::RenderTarget<bindingType> &render_target);
+
+	/**
+	 * @brief Sets the ring buffer used by the BufferAllocationStrategy::SharedRingBuffer strategy for its usage
+	 *        The frame registers itself with the ring, so that the space it used is only reused once its fences signalled
+	 * @param streaming_buffer The ring buffer shared by all the frames of a RenderContext
+	 */
+	void set_streaming_buffer(vkb::rendering::StreamingBuffer &streaming_buffer);
+
 	/**
 	 * @brief Updates all the descriptor sets in the current frame at a specific thread index
 	 */
@@ -156,13 +208,21 @@ class RenderFrame
 	                                              size_t                                      thread_index = 0);
 
   private:
+	static constexpr size_t BUFFER_USAGE_COUNT = SUPPORTED_BUFFER_USAGES.size();
+
 	vkb::core::DeviceCpp                                                                             &device;
-	std::map<vk::BufferUsageFlags, std::vector<std::pair<vkb::BufferPoolCpp, vkb::BufferBlockCpp *>>> buffer_pools;
-	std::map<uint32_t, std::vector<vkb::core::CommandPoolCpp>>                                        command_pools;           // Commands pools per queue family index
-	std::vector<std::unordered_map<std::size_t, vkb::core::HPPDescriptorPool>>                        descriptor_pools;        // Descriptor pools per thread
-	std::vector<std::unordered_map<std::size_t, vkb::core::HPPDescriptorSet>>                         descriptor_sets;         // Descriptor sets per thread
+	std::array<std::vector<std::pair<vkb::BufferPoolCpp, vkb::BufferBlockCpp *>>, BUFFER_USAGE_COUNT> buffer_pools;                   // Buffer pools per usage index and thread
+	std::map<uint32_t, std::vector<vkb::core::CommandPoolCpp>>                                        command_pools;                  // Commands pools per queue family index
+	std::vector<std::unordered_map<std::size_t, vkb::core::HPPDescriptorPool>>                        descriptor_pools;               // Descriptor pools per thread
+	vkb::rendering::DescriptorSetCache                                                               *descriptor_set_cache      = nullptr;
+	size_t                                                                                            descriptor_set_cache_slot = 0;
+	std::vector<std::unordered_map<std::size_t, vkb::core::HPPDescriptorSet>>                         descriptor_sets;                // Descriptor sets per thread
 	vkb::HPPFencePool                                                                                 fence_pool;
 	vkb::HPPSemaphorePool                                                                             semaphore_pool;
+	std::array<std::vector<vkb::rendering::StreamingBuffer::Chunk>, BUFFER_USAGE_COUNT>               streaming_buffer_chunks;        // Ring buffer chunks per usage index and thread
+	std::array<size_t, BUFFER_USAGE_COUNT>                                                            streaming_buffer_slots = {};
+	std::array<vkb::rendering::StreamingBuffer *, BUFFER_USAGE_COUNT>                                 streaming_buffers      = {};
+	vkb::rendering::RenderTargetCpp                                                                  *render_target = nullptr;        // The owned render target, or one set by the RenderContext
 	std::unique_ptr<vkb::rendering::RenderTargetCpp>                                                  swapchain_render_target;
 	size_t                                                                                            thread_count;
 	BufferAllocationStrategy                                                                          buffer_allocation_strategy     = BufferAllocationStrategy::MultipleAllocationsPerBuffer;
@@ -174,33 +234,25 @@ using RenderFrameCpp = RenderFrame<vkb::BindingType::Cpp>;
 
 template <vkb::BindingType bindingType>
 inline RenderFrame<bindingType>::RenderFrame(vkb::core::Device<bindingType>                              &device_,
-                                             std::unique_ptr<vkb::rendering::RenderTarget<bindingType>> &&render_target,
+                                             std::unique_ptr<vkb::rendering::RenderTarget<bindingType>> &&render_target_,
                                              size_t                                                       thread_count) :
     device(reinterpret_cast<vkb::core::DeviceCpp &>(device_)), fence_pool{device}, semaphore_pool{device}, thread_count{thread_count}, descriptor_pools(thread_count), descriptor_sets(thread_count)
 {
 	static constexpr uint32_t BUFFER_POOL_BLOCK_SIZE = 256;        // Block size of a buffer pool in kilobytes
 
-	// A map of the supported usages to a multiplier for the BUFFER_POOL_BLOCK_SIZE
-	static const std::unordered_map<vk::BufferUsageFlags, uint32_t> supported_usage_map = {
-	    {vk::BufferUsageFlagBits::eUniformBuffer, 1},
-	    {vk::BufferUsageFlagBits::eStorageBuffer, 2},        // x2 the size of BUFFER_POOL_BLOCK_SIZE since SSBOs are normally much larger than other types of buffers
-	    {vk::BufferUsageFlagBits::eVertexBuffer, 1},
-	    {vk::BufferUsageFlagBits::eIndexBuffer, 1}};
+	// A multiplier for the BUFFER_POOL_BLOCK_SIZE per supported usage, in the order of SUPPORTED_BUFFER_USAGES
+	// Storage buffers get x2 the size of BUFFER_POOL_BLOCK_SIZE since SSBOs are normally much larger than other types of buffers
+	static constexpr std::array<uint32_t, BUFFER_USAGE_COUNT> block_size_multipliers = {1, 2, 1, 1};
 
-	update_render_target(std::move(render_target));
-	for (auto &usage_it : supported_usage_map)
+	update_render_target(std::move(render_target_));
+	for (size_t usage_index = 0; usage_index < BUFFER_USAGE_COUNT; ++usage_index)
 	{
-		auto [buffer_pools_it, inserted] = buffer_pools.emplace(usage_it.first, std::vector<std::pair<vkb::BufferPoolCpp, vkb::BufferBlockCpp *>>{});
-		if (!inserted)
-		{
-			throw std::runtime_error("Failed to insert buffer pool");
-		}
-
 		for (size_t i = 0; i < thread_count; ++i)
 		{
-			buffer_pools_it->second.push_back(
-			    std::make_pair(vkb::BufferPoolCpp{device, BUFFER_POOL_BLOCK_SIZE * 1024 * usage_it.second, usage_it.first}, nullptr));
+			buffer_pools[usage_index].push_back(std::make_pair(
+			    vkb::BufferPoolCpp{device, BUFFER_POOL_BLOCK_SIZE * 1024 * block_size_multipliers[usage_index], SUPPORTED_BUFFER_USAGES[usage_index]}, nullptr));
 		}
+		streaming_buffer_chunks[usage_index].resize(thread_count);
 	}
 }
 
@@ -225,16 +277,27 @@ template <vkb::BindingType bindingType>
 inline vkb::BufferAllocationCpp RenderFrame<bindingType>::allocate_buffer_impl(vk::BufferUsageFlags usage, vk::DeviceSize size, size_t thread_index)
 {
 	// Find a pool for this usage
-	auto buffer_pool_it = buffer_pools.find(usage);
-	if (buffer_pool_it == buffer_pools.end())
+	size_t usage_index = get_buffer_usage_index(usage);
+	if (usage_index == BUFFER_USAGE_COUNT)
 	{
 		LOGE("No buffer pool for buffer usage {} ", vk::to_string(usage));
 		return vkb::BufferAllocationCpp{};
 	}
 
-	assert(thread_index < buffer_pool_it->second.size());
-	auto &buffer_pool  = buffer_pool_it->second[thread_index].first;
-	auto &buffer_block = buffer_pool_it->second[thread_index].second;
+	if (buffer_allocation_strategy == BufferAllocationStrategy::SharedRingBuffer)
+	{
+		assert(streaming_buffers[usage_index] && "No streaming buffer has been set for this frame");
+		auto allocation = streaming_buffers[usage_index]->allocate(streaming_buffer_chunks[usage_index][thread_index], size);
+		if (!allocation.empty())
+		{
+			return allocation;
+		}
+		// The ring is full, which shows up in its overflow count, so fall back to the frame's own pools
+	}
+
+	assert(thread_index < buffer_pools[usage_index].size());
+	auto &buffer_pool  = buffer_pools[usage_index][thread_index].first;
+	auto &buffer_block = buffer_pools[usage_index][thread_index].second;
 
 	bool want_minimal_block = (buffer_allocation_strategy == BufferAllocationStrategy::OneAllocationPerBuffer);
 
@@ -265,6 +328,26 @@ inline void RenderFrame<bindingType>::clear_descriptors()
 	}
 }
 
+template <vkb::BindingType bindingType>
+inline void RenderFrame<bindingType>::detach_shared_resources()
+{
+	if (descriptor_set_cache)
+	{
+		descriptor_set_cache->unregister_frame(descriptor_set_cache_slot);
+		descriptor_set_cache = nullptr;
+	}
+
+	for (size_t usage_index = 0; usage_index < BUFFER_USAGE_COUNT; ++usage_index)
+	{
+		if (streaming_buffers[usage_index])
+		{
+			streaming_buffers[usage_index]->unregister_frame(streaming_buffer_slots[usage_index]);
+			streaming_buffers[usage_index] = nullptr;
+			std::ranges::fill(streaming_buffer_chunks[usage_index], vkb::rendering::StreamingBuffer::Chunk{});
+		}
+	}
+}
+
 template <vkb::BindingType bindingType>
 inline std::vector<vkb::core::CommandPoolCpp> &RenderFrame<bindingType>::get_command_pools(const vkb::core::HPPQueue  &queue,
                                                                                            vkb::CommandBufferResetMode reset_mode)
@@ -376,11 +459,11 @@ inline vkb::rendering::RenderTarget<bindingType> &RenderFrame<bindingType>::get_
 {
 	if constexpr (bindingType == vkb::BindingType::Cpp)
 	{
-		return *swapchain_render_target;
+		return *render_target;
 	}
 	else
 	{
-		return reinterpret_cast<vkb::rendering::RenderTargetC &>(*swapchain_render_target);
+		return reinterpret_cast<vkb::rendering::RenderTargetC &>(*render_target);
 	}
 }
 
@@ -389,11 +472,11 @@ inline vkb::rendering::RenderTarget<bindingType> const &RenderFrame<bindingType>
 {
 	if constexpr (bindingType == vkb::BindingType::Cpp)
 	{
-		return *swapchain_render_target;
+		return *render_target;
 	}
 	else
 	{
-		return reinterpret_cast<vkb::rendering::RenderTargetC const &>(*swapchain_render_target);
+		return reinterpret_cast<vkb::rendering::RenderTargetC const &>(*render_target);
 	}
 }
 
@@ -454,6 +537,13 @@ inline vk::DescriptorSet RenderFrame<bindingType>::request_descriptor_set_impl(v
                                                                                bool                                        update_after_bind,
                                                                                size_t                                      thread_index)
 {
+	if (descriptor_management_strategy == DescriptorManagementStrategy::ShareAcrossFrames)
+	{
+		// Cached sets are written in full once, so update-after-bind bindings need no deferred update
+		assert(descriptor_set_cache && "No descriptor set cache has been set for this frame");
+		return descriptor_set_cache->request_descriptor_set(descriptor_set_layout, buffer_infos, image_infos);
+	}
+
 	auto &descriptor_pool = vkb::common::request_resource(device, nullptr, descriptor_pools[thread_index], descriptor_set_layout);
 	if (descriptor_management_strategy == DescriptorManagementStrategy::StoreInCache)
 	{
@@ -508,15 +598,30 @@ inline void RenderFrame<bindingType>::reset()
 
 	for (auto &buffer_pools_per_usage : buffer_pools)
 	{
-		for (auto &buffer_pool : buffer_pools_per_usage.second)
+		for (auto &buffer_pool : buffer_pools_per_usage)
 		{
 			buffer_pool.first.reset();
 			buffer_pool.second = nullptr;
 		}
 	}
 
+	for (size_t usage_index = 0; usage_index < BUFFER_USAGE_COUNT; ++usage_index)
+	{
+		if (streaming_buffers[usage_index])
+		{
+			// The space of the chunks may be handed out again once the frame started
+			streaming_buffers[usage_index]->begin_frame(streaming_buffer_slots[usage_index]);
+			std::ranges::fill(streaming_buffer_chunks[usage_index], vkb::rendering::StreamingBuffer::Chunk{});
+		}
+	}
+
 	semaphore_pool.reset();
 
+	if (descriptor_set_cache)
+	{
+		descriptor_set_cache->begin_frame(descriptor_set_cache_slot);
+	}
+
 	if (descriptor_management_strategy == DescriptorManagementStrategy::CreateDirectly)
 	{
 		clear_descriptors();
@@ -529,12 +634,35 @@ inline void RenderFrame<bindingType>::set_buffer_allocation_strategy(BufferAlloc
 	buffer_allocation_strategy = new_strategy;
 }
 
+template <vkb::BindingType bindingType>
+inline void RenderFrame<bindingType>::set_descriptor_set_cache(vkb::rendering::DescriptorSetCache &cache)
+{
+	descriptor_set_cache      = &cache;
+	descriptor_set_cache_slot = cache.register_frame();
+}
+
 template <vkb::BindingType bindingType>
 inline void RenderFrame<bindingType>::set_descriptor_management_strategy(DescriptorManagementStrategy new_strategy)
 {
 	descriptor_management_strategy = new_strategy;
 }
 
+template <vkb::BindingType bindingType>
+inline void RenderFrame<bindingType>::set_render_target(vkb::rendering::RenderTarget<bindingType> &render_target_)
+{
+	render_target = reinterpret_cast<vkb::rendering::RenderTargetCpp *>(&render_target_);
+}
+
+template <vkb::BindingType bindingType>
+inline void RenderFrame<bindingType>::set_streaming_buffer(vkb::rendering::StreamingBuffer &streaming_buffer)
+{
+	size_t usage_index = get_buffer_usage_index(streaming_buffer.get_usage());
+	assert(usage_index < BUFFER_USAGE_COUNT && "Streaming buffer usage is not supported by RenderFrame");
+
+	streaming_buffers[usage_index]      = &streaming_buffer;
+	streaming_buffer_slots[usage_index] = streaming_buffer.register_frame();
+}
+
 template <vkb::BindingType bindingType>
 inline void RenderFrame<bindingType>::update_descriptor_sets(size_t thread_index)
 {
@@ -547,16 +675,17 @@ inline void RenderFrame<bindingType>::update_descriptor_sets(size_t thread_index
 }
 
 template <vkb::BindingType bindingType>
-inline void RenderFrame<bindingType>::update_render_target(std::unique_ptr<vkb::rendering::RenderTarget<bindingType>> &&render_target)
+inline void RenderFrame<bindingType>::update_render_target(std::unique_ptr<vkb::rendering::RenderTarget<bindingType>> &&render_target_)
 {
 	if constexpr (bindingType == vkb::BindingType::Cpp)
 	{
-		swapchain_render_target = std::move(render_target);
+		swapchain_render_target = std::move(render_target_);
 	}
 	else
 	{
-		swapchain_render_target.reset(reinterpret_cast<vkb::rendering::RenderTargetCpp *>(render_target.release()));
+		swapchain_render_target.reset(reinterpret_cast<vkb::rendering::RenderTargetCpp *>(render_target_.release()));
 	}
+	render_target = swapchain_render_target.get();
 }
 }        // namespace rendering
 }        // namespace vkb
\ No newline at end of file
@@ -177,6 +177,11 @@ void RenderPipeline<bindingType>::draw_impl(vkb::core::CommandBufferCpp     &com
                                             vkb::rendering::RenderTargetCpp &render_target,
                                             vk::SubpassContents              contents)
 {
+	for (auto &subpass : subpasses)
+	{
+		subpass->pre_render_pass(command_buffer);
+	}
+
 	for (size_t i = 0; i < subpasses.size(); ++i)
 	{
 		active_subpass_index = i;
@@ -0,0 +1,216 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "skinning_pass.h"
+
+#include <algorithm>
+
+#include "core/hpp_debug.h"
+#include "core/util/logging.hpp"
+#include "core/util/profiling.hpp"
+#include "scene_graph/components/mesh.h"
+#include "scene_graph/components/skin.h"
+#include "scene_graph/components/sub_mesh.h"
+
+namespace vkb
+{
+namespace rendering
+{
+namespace
+{
+/**
+ * @return True if the sub mesh has the attribute as packed 32-bit float vectors, as the skinning shader reads them
+ */
+bool has_packed_vec3_attribute(vkb::sg::SubMesh const &sub_mesh, std::string const &name)
+{
+	vkb::sg::VertexAttribute attribute;
+	return sub_mesh.vertex_buffers.contains(name) && sub_mesh.get_attribute(name, attribute) &&
+	       attribute.format == VK_FORMAT_R32G32B32_SFLOAT && attribute.stride == sizeof(glm::vec3) && attribute.offset == 0;
+}
+
+vkb::core::BufferCpp const &to_cpp(vkb::core::BufferC const &buffer)
+{
+	return reinterpret_cast<vkb::core::BufferCpp const &>(buffer);
+}
+}        // namespace
+
+bool SkinningPass::is_needed(vkb::scene_graph::SceneCpp &scene)
+{
+	if (!scene.has_component<vkb::sg::Mesh>())
+	{
+		return false;
+	}
+
+	auto meshes = scene.get_components<vkb::sg::Mesh>();
+	return std::ranges::any_of(meshes, [](vkb::sg::Mesh const *mesh) {
+		return std::ranges::any_of(mesh->get_submeshes(), [](vkb::sg::SubMesh const *sub_mesh) { return sub_mesh->is_deformable(); });
+	});
+}
+
+SkinningPass::SkinningPass(vkb::rendering::RenderContextCpp &render_context, vkb::scene_graph::SceneCpp &scene) :
+    render_context{render_context}, shader{"skinning/skinning.comp.spv"}
+{
+	for (auto *mesh : scene.get_components<vkb::sg::Mesh>())
+	{
+		if (mesh->get_nodes().empty())
+		{
+			continue;
+		}
+
+		auto *node = mesh->get_nodes().front();
+		auto *skin = node->has_component<vkb::sg::Skin>() ? &node->get_component<vkb::sg::Skin>() : nullptr;
+
+		for (auto *sub_mesh : mesh->get_submeshes())
+		{
+			if (!sub_mesh->is_deformable() || (sub_mesh->skin_buffer && !skin))
+			{
+				continue;
+			}
+
+			if (!has_packed_vec3_attribute(*sub_mesh, "position"))
+			{
+				LOGW("SkinningPass: skipping {}, its positions are not packed 32-bit float vectors", sub_mesh->get_name());
+				continue;
+			}
+
+			targets.push_back({.node        = node,
+			                   .mesh        = mesh,
+			                   .sub_mesh    = sub_mesh,
+			                   .skin        = sub_mesh->skin_buffer ? skin : nullptr,
+			                   .has_normals = has_packed_vec3_attribute(*sub_mesh, "normal")});
+		}
+	}
+
+	placeholder_buffer = vkb::core::BufferBuilderCpp(sizeof(glm::mat4))
+	                         .with_usage(vk::BufferUsageFlagBits::eStorageBuffer)
+	                         .with_vma_usage(VMA_MEMORY_USAGE_GPU_ONLY)
+	                         .with_debug_name("SkinningPass placeholder")
+	                         .build_unique(render_context.get_device());
+}
+
+void SkinningPass::record(vkb::core::CommandBufferCpp &command_buffer)
+{
+	if (targets.empty())
+	{
+		return;
+	}
+
+	PROFILE_SCOPE("Skinning");
+
+	vkb::core::HPPScopedDebugLabel debug_label{command_buffer, "Skinning"};
+
+	auto &device          = render_context.get_device();
+	auto &render_frame    = render_context.get_active_frame();
+	auto &shader_module   = device.get_resource_cache().request_shader_module(vk::ShaderStageFlagBits::eCompute, shader);
+	auto &pipeline_layout = device.get_resource_cache().request_pipeline_layout({&shader_module});
+
+	command_buffer.bind_pipeline_layout(pipeline_layout);
+
+	// The deformed vertices of each render frame are only overwritten once the frame that drew them has completed
+	uint32_t frame_index = render_context.get_active_frame_index();
+
+	for (auto &target : targets)
+	{
+		auto &sub_mesh = *target.sub_mesh;
+
+		if (target.positions.size() <= frame_index)
+		{
+			target.positions.resize(frame_index + 1);
+			target.normals.resize(frame_index + 1);
+		}
+		auto &positions = target.positions[frame_index];
+		if (!positions)
+		{
+			positions = create_output_buffer(target, "position", frame_index);
+		}
+		auto &normals = target.normals[frame_index];
+		if (target.has_normals && !normals)
+		{
+			normals = create_output_buffer(target, "normal", frame_index);
+		}
+
+		if (target.skin)
+		{
+			target.skin->compute_joint_matrices(target.node->get_transform().get_world_matrix(), joint_matrices);
+		}
+		else
+		{
+			joint_matrices.clear();
+		}
+
+		// The joint matrices and weights change every frame, so they are streamed from the render frame
+		auto joint_allocation = render_frame.allocate_buffer(vk::BufferUsageFlagBits::eStorageBuffer, std::max<size_t>(joint_matrices.size(), 1) * sizeof(glm::mat4));
+		if (!joint_matrices.empty())
+		{
+			joint_allocation.get_buffer().update(joint_matrices.data(), joint_matrices.size() * sizeof(glm::mat4), joint_allocation.get_offset());
+		}
+
+		auto const &morph_weights      = target.mesh->get_morph_weights();
+		uint32_t    morph_target_count = std::min(sub_mesh.morph_target_count, vkb::to_u32(morph_weights.size()));
+		auto        weight_allocation  = render_frame.allocate_buffer(vk::BufferUsageFlagBits::eStorageBuffer, std::max<size_t>(morph_target_count, 1) * sizeof(float));
+		if (0 < morph_target_count)
+		{
+			weight_allocation.get_buffer().update(morph_weights.data(), morph_target_count * sizeof(float), weight_allocation.get_offset());
+		}
+
+		auto const &source_positions = to_cpp(sub_mesh.vertex_buffers.at("position"));
+		auto const &source_normals   = target.has_normals ? to_cpp(sub_mesh.vertex_buffers.at("normal")) : *placeholder_buffer;
+		auto const &skin_buffer      = target.skin ? to_cpp(*sub_mesh.skin_buffer) : *placeholder_buffer;
+		auto const &morph_buffer     = 0 < morph_target_count ? to_cpp(*sub_mesh.morph_target_buffer) : *placeholder_buffer;
+		auto const &output_normals   = target.has_normals ? *normals : *placeholder_buffer;
+
+		command_buffer.bind_buffer(source_positions, 0, source_positions.get_size(), 0, 0, 0);
+		command_buffer.bind_buffer(source_normals, 0, source_normals.get_size(), 0, 1, 0);
+		command_buffer.bind_buffer(skin_buffer, 0, skin_buffer.get_size(), 0, 2, 0);
+		command_buffer.bind_buffer(morph_buffer, 0, morph_buffer.get_size(), 0, 3, 0);
+		command_buffer.bind_buffer(joint_allocation.get_buffer(), joint_allocation.get_offset(), joint_allocation.get_size(), 0, 4, 0);
+		command_buffer.bind_buffer(weight_allocation.get_buffer(), weight_allocation.get_offset(), weight_allocation.get_size(), 0, 5, 0);
+		command_buffer.bind_buffer(*positions, 0, positions->get_size(), 0, 6, 0);
+		command_buffer.bind_buffer(output_normals, 0, output_normals.get_size(), 0, 7, 0);
+
+		PushConstants push_constants{.vertex_count       = sub_mesh.vertices_count,
+		                             .joint_count        = vkb::to_u32(joint_matrices.size()),
+		                             .morph_target_count = morph_target_count,
+		                             .has_normals        = target.has_normals};
+		command_buffer.push_constants(push_constants);
+		command_buffer.dispatch((push_constants.vertex_count + GROUP_SIZE - 1) / GROUP_SIZE, 1, 1);
+
+		vkb::common::HPPBufferMemoryBarrier barrier{.src_stage_mask  = vk::PipelineStageFlagBits::eComputeShader,
+		                                            .dst_stage_mask  = vk::PipelineStageFlagBits::eVertexInput,
+		                                            .src_access_mask = vk::AccessFlagBits::eShaderWrite,
+		                                            .dst_access_mask = vk::AccessFlagBits::eVertexAttributeRead};
+		command_buffer.buffer_memory_barrier(*positions, 0, VK_WHOLE_SIZE, barrier);
+		if (target.has_normals)
+		{
+			command_buffer.buffer_memory_barrier(*normals, 0, VK_WHOLE_SIZE, barrier);
+		}
+
+		sub_mesh.set_vertex_buffer_override("position", &reinterpret_cast<vkb::core::BufferC const &>(*positions));
+		sub_mesh.set_vertex_buffer_override("normal", target.has_normals ? &reinterpret_cast<vkb::core::BufferC const &>(*normals) : nullptr);
+	}
+}
+
+std::unique_ptr<vkb::core::BufferCpp> SkinningPass::create_output_buffer(Target const &target, char const *attribute, uint32_t frame_index)
+{
+	return vkb::core::BufferBuilderCpp(std::max<size_t>(target.sub_mesh->vertices_count, 1) * sizeof(glm::vec3))
+	    .with_usage(vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eStorageBuffer)
+	    .with_vma_usage(VMA_MEMORY_USAGE_GPU_ONLY)
+	    .with_debug_name(fmt::format("{}: skinned {}, frame #{}", target.sub_mesh->get_name(), attribute, frame_index))
+	    .build_unique(render_context.get_device());
+}
+}        // namespace rendering
+}        // namespace vkb
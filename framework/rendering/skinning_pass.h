@@ -0,0 +1,108 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "common/glm_common.h"
+#include "core/buffer.h"
+#include "core/command_buffer.h"
+#include "core/hpp_shader_module.h"
+#include "rendering/render_context.h"
+#include "scene_graph/scene.h"
+
+namespace vkb
+{
+namespace sg
+{
+class Mesh;
+class Skin;
+class SubMesh;
+}        // namespace sg
+
+namespace rendering
+{
+/**
+ * @brief Deforms the skinned and morphed sub meshes of a Scene with a compute shader, before they are drawn
+ *
+ * Each frame, the morph target weights of a sub mesh are applied to its positions and normals, which are then
+ * skinned by the joint matrices of its node. The results are written to vertex buffers owned by the current render
+ * frame, and set as the vertex buffer overrides of the sub mesh, so any subpass drawing with
+ * SubMesh::find_vertex_buffer draws the deformed vertices without CPU work per vertex.
+ *
+ * The sub meshes must have 32-bit float positions and normals, as loaded by the GLTFLoader. A mesh used by several
+ * nodes is only deformed for the first of them.
+ *
+ * VulkanSample only creates the pass for samples enabling it with VulkanSample::set_skinning_enable.
+ */
+class SkinningPass
+{
+  public:
+	/**
+	 * @return True if the scene has any sub mesh to deform
+	 */
+	static bool is_needed(vkb::scene_graph::SceneCpp &scene);
+
+	SkinningPass(vkb::rendering::RenderContextCpp &render_context, vkb::scene_graph::SceneCpp &scene);
+
+	/**
+	 * @brief Records the deformation of all the sub meshes for the active frame, outside of a render pass
+	 */
+	void record(vkb::core::CommandBufferCpp &command_buffer);
+
+  private:
+	static constexpr uint32_t GROUP_SIZE = 64;
+
+	/**
+	 * @brief The push constants of the skinning shader
+	 */
+	struct PushConstants
+	{
+		uint32_t vertex_count;
+		uint32_t joint_count;
+		uint32_t morph_target_count;
+		uint32_t has_normals;
+	};
+
+	/**
+	 * @brief A sub mesh to deform, with its deformed vertices for each render frame
+	 */
+	struct Target
+	{
+		vkb::scene_graph::NodeC                           *node;
+		vkb::sg::Mesh                                     *mesh;
+		vkb::sg::SubMesh                                  *sub_mesh;
+		vkb::sg::Skin                                     *skin;        // nullptr for sub meshes with morph targets only
+		bool                                               has_normals;
+		std::vector<std::unique_ptr<vkb::core::BufferCpp>> positions;
+		std::vector<std::unique_ptr<vkb::core::BufferCpp>> normals;
+	};
+
+  private:
+	std::unique_ptr<vkb::core::BufferCpp> create_output_buffer(Target const &target, char const *attribute, uint32_t frame_index);
+
+  private:
+	std::vector<glm::mat4>                joint_matrices;
+	std::unique_ptr<vkb::core::BufferCpp> placeholder_buffer;        // Bound to the inputs a sub mesh does not have
+	vkb::rendering::RenderContextCpp     &render_context;
+	vkb::core::HPPShaderSource            shader;
+	std::vector<Target>                   targets;
+};
+}        // namespace rendering
+}        // namespace vkb
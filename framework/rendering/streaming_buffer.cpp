@@ -0,0 +1,165 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "streaming_buffer.h"
+
+#include <bit>
+
+namespace vkb
+{
+namespace rendering
+{
+namespace
+{
+vk::DeviceSize determine_alignment(vk::BufferUsageFlags usage, vk::PhysicalDeviceLimits const &limits)
+{
+	if (usage == vk::BufferUsageFlagBits::eUniformBuffer)
+	{
+		return limits.minUniformBufferOffsetAlignment;
+	}
+	else if (usage == vk::BufferUsageFlagBits::eStorageBuffer)
+	{
+		return limits.minStorageBufferOffsetAlignment;
+	}
+	else if (usage == vk::BufferUsageFlagBits::eIndexBuffer || usage == vk::BufferUsageFlagBits::eVertexBuffer)
+	{
+		return 16;
+	}
+	else
+	{
+		throw std::runtime_error("Usage not supported by a streaming buffer");
+	}
+}
+}        // namespace
+
+StreamingBuffer::StreamingBuffer(vkb::core::DeviceCpp &device, vk::BufferUsageFlags usage, vk::DeviceSize capacity, vk::DeviceSize chunk_size) :
+    device{device}, usage{usage}
+{
+	alignment        = std::max<vk::DeviceSize>(determine_alignment(usage, device.get_gpu().get_properties().limits), 1);
+	this->chunk_size = (std::max(chunk_size, alignment) + alignment - 1) & ~(alignment - 1);
+
+	// With a power of two capacity, the offset of a ring position in the buffer is just its lower bits
+	this->capacity = std::bit_ceil(std::max(capacity, this->chunk_size));
+}
+
+void StreamingBuffer::begin_frame(size_t frame_slot)
+{
+	std::lock_guard<std::mutex> guard{frame_mutex};
+
+	assert(frame_slot < frame_starts.size() && "Frame slot has not been registered");
+
+	vk::DeviceSize current_head = head.load(std::memory_order_acquire);
+	high_water_mark             = std::max(high_water_mark, current_head - tail.load(std::memory_order_relaxed));
+
+	// The previous frame in this slot has completed, so everything before the oldest frame still in flight is free
+	frame_starts[frame_slot] = current_head;
+
+	vk::DeviceSize oldest_start = current_head;
+	for (auto frame_start : frame_starts)
+	{
+		if (frame_start != NO_FRAME)
+		{
+			oldest_start = std::min(oldest_start, frame_start);
+		}
+	}
+	tail.store(oldest_start, std::memory_order_release);
+}
+
+StreamingBuffer::Statistics StreamingBuffer::get_statistics() const
+{
+	std::lock_guard<std::mutex> guard{frame_mutex};
+	return Statistics{capacity, high_water_mark, overflows.load(std::memory_order_relaxed)};
+}
+
+vk::BufferUsageFlags StreamingBuffer::get_usage() const
+{
+	return usage;
+}
+
+size_t StreamingBuffer::register_frame()
+{
+	std::lock_guard<std::mutex> guard{frame_mutex};
+
+	if (!free_frame_slots.empty())
+	{
+		size_t frame_slot = free_frame_slots.back();
+		free_frame_slots.pop_back();
+		return frame_slot;
+	}
+
+	frame_starts.push_back(NO_FRAME);
+	return frame_starts.size() - 1;
+}
+
+bool StreamingBuffer::reserve(Chunk &chunk, vk::DeviceSize size)
+{
+	std::call_once(buffer_created, [this]() { buffer = std::make_unique<vkb::core::BufferCpp>(device, capacity, usage, VMA_MEMORY_USAGE_CPU_TO_GPU); });
+
+	vk::DeviceSize reservation_size = std::max(chunk_size, (size + alignment - 1) & ~(alignment - 1));
+	if (capacity < reservation_size)
+	{
+		overflows.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	vk::DeviceSize current_head = head.load(std::memory_order_relaxed);
+	vk::DeviceSize start;
+	vk::DeviceSize end;
+	do
+	{
+		// A chunk never straddles the end of the ring, it skips ahead to the next wrap instead
+		start = current_head;
+		if (capacity < (start & (capacity - 1)) + reservation_size)
+		{
+			start = (start + capacity - 1) & ~(capacity - 1);
+		}
+		end = start + reservation_size;
+
+		if (capacity < end - tail.load(std::memory_order_acquire))
+		{
+			overflows.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+	} while (!head.compare_exchange_weak(current_head, end, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+	chunk.cursor = start;
+	chunk.end    = end;
+	return true;
+}
+
+void StreamingBuffer::set_capacity(vk::DeviceSize new_capacity)
+{
+	if (buffer)
+	{
+		LOGW("The capacity of a streaming buffer can not change once it is in use");
+		return;
+	}
+	capacity = std::bit_ceil(std::max(new_capacity, chunk_size));
+}
+
+void StreamingBuffer::unregister_frame(size_t frame_slot)
+{
+	std::lock_guard<std::mutex> guard{frame_mutex};
+
+	assert(frame_slot < frame_starts.size() && "Frame slot has not been registered");
+
+	// The slot no longer holds back the tail, which moves past the frame's space on the next begin_frame
+	frame_starts[frame_slot] = NO_FRAME;
+	free_frame_slots.push_back(frame_slot);
+}
+}        // namespace rendering
+}        // namespace vkb
@@ -0,0 +1,158 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "buffer_pool.h"
+
+namespace vkb
+{
+namespace rendering
+{
+/**
+ * @brief A persistently mapped ring buffer for one buffer usage, shared by all the frames of a RenderContext.
+ *
+ * Each frame and thread bump-allocates from its own chunk of the ring without any synchronization, and only
+ * reserves a new chunk, with a compare-and-swap on the ring head, when its chunk is exhausted. Positions in the
+ * ring grow monotonically, and the space used by a frame is reclaimed when that frame begins again, which happens
+ * after its fences have signalled: everything older than the oldest frame still in flight is free.
+ *
+ * The Vulkan buffer is only created on the first reservation, so unused rings cost no memory.
+ */
+class StreamingBuffer
+{
+  public:
+	/**
+	 * @brief A range of the ring owned by one frame and thread, allocations are taken from its front
+	 */
+	struct Chunk
+	{
+		vk::DeviceSize cursor = 0;
+		vk::DeviceSize end    = 0;
+	};
+
+	struct Statistics
+	{
+		vk::DeviceSize capacity        = 0;        // Size of the ring buffer
+		vk::DeviceSize high_water_mark = 0;        // Largest number of bytes in flight seen at the start of a frame
+		uint32_t       overflows       = 0;        // Number of reservations that failed because the ring was full
+	};
+
+	static constexpr vk::DeviceSize DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+  public:
+	/**
+	 * @param device A valid device
+	 * @param usage The usage of the buffer, one of the usages supported by RenderFrame::allocate_buffer
+	 * @param capacity Size of the ring, rounded up to a power of two
+	 * @param chunk_size Size of the chunks reserved by each frame and thread
+	 */
+	StreamingBuffer(vkb::core::DeviceCpp &device, vk::BufferUsageFlags usage, vk::DeviceSize capacity, vk::DeviceSize chunk_size = DEFAULT_CHUNK_SIZE);
+
+	StreamingBuffer(const StreamingBuffer &)            = delete;
+	StreamingBuffer(StreamingBuffer &&)                 = delete;
+	StreamingBuffer &operator=(const StreamingBuffer &) = delete;
+	StreamingBuffer &operator=(StreamingBuffer &&)      = delete;
+
+	/**
+	 * @brief Allocates from the given chunk, reserving a new chunk from the ring if it is exhausted
+	 * @param chunk The chunk of the calling frame and thread
+	 * @param size The number of bytes to allocate
+	 * @return The allocation, empty if the ring is full
+	 */
+	BufferAllocationCpp allocate(Chunk &chunk, vk::DeviceSize size);
+
+	/**
+	 * @brief Reclaims the space of the frame in the given slot, must be called after waiting on the frame's fences
+	 *        Chunks held by that frame must be dropped, as their space may be handed out again
+	 * @param frame_slot The slot returned by register_frame for the frame being started
+	 */
+	void begin_frame(size_t frame_slot);
+
+	Statistics get_statistics() const;
+
+	vk::BufferUsageFlags get_usage() const;
+
+	/**
+	 * @brief Registers a frame that will allocate from the ring
+	 * @return The slot to pass to begin_frame for that frame
+	 */
+	size_t register_frame();
+
+	/**
+	 * @brief Sets the size of the ring, which can only change before the buffer is first used
+	 * @param new_capacity Size of the ring, rounded up to a power of two
+	 */
+	void set_capacity(vk::DeviceSize new_capacity);
+
+	/**
+	 * @brief Releases the slot of a frame that no longer allocates from the ring, such as a frame dropped after the
+	 *        swapchain shrank. The frame must have no work in flight, its slot may be handed out to a new frame
+	 * @param frame_slot The slot returned by register_frame for that frame
+	 */
+	void unregister_frame(size_t frame_slot);
+
+  private:
+	/**
+	 * @brief Reserves a new chunk large enough for size bytes, without locking
+	 * @return False if the ring is full
+	 */
+	bool reserve(Chunk &chunk, vk::DeviceSize size);
+
+  private:
+	static constexpr vk::DeviceSize NO_FRAME = ~vk::DeviceSize{0};
+
+	vk::DeviceSize                        alignment = 0;
+	std::unique_ptr<vkb::core::BufferCpp> buffer;
+	std::once_flag                        buffer_created;
+	vk::DeviceSize                        capacity;
+	vk::DeviceSize                        chunk_size;
+	vkb::core::DeviceCpp                 &device;
+	std::vector<vk::DeviceSize>           frame_starts;        // Ring position at the start of the frame in each slot, NO_FRAME if unused
+	std::vector<size_t>                   free_frame_slots;        // Slots released by unregister_frame
+	mutable std::mutex                    frame_mutex;
+	std::atomic<vk::DeviceSize>           head{0};             // Position of the next reservation
+	vk::DeviceSize                        high_water_mark = 0;
+	std::atomic<uint32_t>                 overflows{0};
+	std::atomic<vk::DeviceSize>           tail{0};             // Position of the oldest byte that may still be in flight
+	vk::BufferUsageFlags                  usage;
+};
+
+inline BufferAllocationCpp StreamingBuffer::allocate(Chunk &chunk, vk::DeviceSize size)
+{
+	vk::DeviceSize offset = (chunk.cursor + alignment - 1) & ~(alignment - 1);
+	if (offset + size <= chunk.end) [[likely]]
+	{
+		chunk.cursor = offset + size;
+		return BufferAllocationCpp{*buffer, size, offset & (capacity - 1)};
+	}
+
+	if (!reserve(chunk, size))
+	{
+		return BufferAllocationCpp{};
+	}
+
+	// A new chunk starts aligned, and never wraps around the end of the ring
+	offset       = chunk.cursor;
+	chunk.cursor = offset + size;
+	return BufferAllocationCpp{*buffer, size, offset & (capacity - 1)};
+}
+}        // namespace rendering
+}        // namespace vkb
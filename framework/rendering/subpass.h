@@ -20,9 +20,11 @@
 
 #include "buffer_pool.h"
 #include "rendering/hpp_pipeline_state.h"
+#include "rendering/light_clusters.h"
 #include "rendering/pipeline_state.h"
 #include "rendering/render_context.h"
 #include "rendering/render_frame.h"
+#include "scene_graph/components/camera.h"
 #include "scene_graph/components/light.h"
 #include "scene_graph/node.h"
 
@@ -51,6 +53,13 @@ struct LightingState
 	std::vector<Light>            point_lights;
 	std::vector<Light>            spot_lights;
 	BufferAllocation<bindingType> light_buffer;
+
+	// With clustered lighting the point and spot lights are in storage buffers, and light_buffer only has the
+	// directional lights. These allocations are empty otherwise
+	BufferAllocation<bindingType> cluster_info_buffer;
+	BufferAllocation<bindingType> clustered_light_buffer;
+	BufferAllocation<bindingType> cluster_range_buffer;
+	BufferAllocation<bindingType> cluster_light_index_buffer;
 };
 
 using LightingStateC   = LightingState<vkb::BindingType::C>;
@@ -102,6 +111,13 @@ class Subpass
 	 */
 	virtual void prepare() = 0;
 
+	/**
+	 * @brief Records the commands the subpass needs outside of the render pass, such as the compute work producing
+	 *        its draw arguments. Called by the RenderPipeline on all its subpasses before beginning the render pass
+	 * @param command_buffer Command buffer to use to record the commands
+	 */
+	virtual void pre_render_pass(vkb::core::CommandBuffer<bindingType> &command_buffer);
+
 	/**
 	 * @brief Prepares the lighting state to have its lights
 	 *
@@ -113,6 +129,29 @@ class Subpass
 	void allocate_lights(const std::vector<sg::Light *> &scene_lights,
 	                     size_t                          max_lights_per_type);
 
+	/**
+	 * @brief Prepares the lighting state with the point and spot lights assigned to a cluster grid, so that there is
+	 *        no limit to their number. Requires clustered lighting to be enabled
+	 *
+	 * @tparam A light structure that has a 'directional_lights' array field defined.
+	 * @param scene_lights All of the light components from the scene graph
+	 * @param max_directional_lights The maximum amount of directional lights, which apply to all the clusters
+	 * @param camera The camera the clusters are built for
+	 */
+	template <typename T>
+	void allocate_clustered_lights(const std::vector<sg::Light *> &scene_lights,
+	                               size_t                          max_directional_lights,
+	                               sg::Camera const               &camera);
+
+	/**
+	 * @brief Enables the assignment of point and spot lights to a cluster grid, the subpass must then be created
+	 *        with shaders reading the lights as in clustered_lighting.h
+	 * @param grid_size The number of clusters along the width, height and depth of the view frustum
+	 */
+	void enable_clustered_lighting(const glm::uvec3 &grid_size = LightClusters::DEFAULT_GRID_SIZE);
+
+	bool is_clustered_lighting_enabled() const;
+
 	const std::vector<uint32_t>                               &get_color_resolve_attachments() const;
 	const std::string                                         &get_debug_name() const;
 	const uint32_t                                            &get_depth_stencil_resolve_attachment() const;
@@ -151,6 +190,9 @@ class Subpass
 	vkb::rendering::RenderContextCpp    &get_render_context_impl();
 	vkb::core::HPPShaderSource const    &get_vertex_shader_impl() const;
 
+  private:
+	static Light make_light(sg::Light &scene_light);
+
   private:
 	/// Default to no color resolve attachments
 	std::vector<uint32_t> color_resolve_attachments = {};
@@ -178,6 +220,13 @@ class Subpass
 	/// The structure containing all the requested render-ready lights for the scene
 	LightingStateCpp lighting_state{};
 
+	/// The cluster grid of the point and spot lights, only created if clustered lighting is enabled
+	std::unique_ptr<LightClusters> light_clusters;
+
+	// Scratch storage of allocate_clustered_lights, kept between frames
+	std::vector<glm::vec4> light_bounding_spheres;
+	std::vector<Light>     clustered_lights;
+
 	vkb::core::HPPShaderSource fragment_shader;
 
 	/// Default to no input attachments
@@ -295,6 +344,10 @@ inline const typename Subpass<bindingType>::ShaderSourceType &Subpass<bindingTyp
 	}
 }
 
+template <vkb::BindingType bindingType>
+inline void Subpass<bindingType>::pre_render_pass(vkb::core::CommandBuffer<bindingType> &command_buffer)
+{}
+
 template <vkb::BindingType bindingType>
 template <typename T>
 void Subpass<bindingType>::allocate_lights(const std::vector<sg::Light *> &scene_lights,
@@ -304,15 +357,14 @@ void Subpass<bindingType>::allocate_lights(const std::vector<sg::Light *> &scene
 	lighting_state.point_lights.clear();
 	lighting_state.spot_lights.clear();
 
+	lighting_state.cluster_info_buffer        = {};
+	lighting_state.clustered_light_buffer     = {};
+	lighting_state.cluster_range_buffer       = {};
+	lighting_state.cluster_light_index_buffer = {};
+
 	for (auto &scene_light : scene_lights)
 	{
-		const auto &properties = scene_light->get_properties();
-		auto       &transform  = scene_light->get_node()->get_transform();
-
-		Light light{{transform.get_translation(), static_cast<float>(scene_light->get_light_type())},
-		            {properties.color, properties.intensity},
-		            {transform.get_rotation() * properties.direction, properties.range},
-		            {properties.inner_cone_angle, properties.outer_cone_angle}};
+		Light light = make_light(*scene_light);
 
 		switch (scene_light->get_light_type())
 		{
@@ -369,6 +421,109 @@ void Subpass<bindingType>::allocate_lights(const std::vector<sg::Light *> &scene
 	lighting_state.light_buffer.update(light_info);
 }
 
+template <vkb::BindingType bindingType>
+template <typename T>
+void Subpass<bindingType>::allocate_clustered_lights(const std::vector<sg::Light *> &scene_lights,
+                                                     size_t                          max_directional_lights,
+                                                     sg::Camera const               &camera)
+{
+	assert(light_clusters && "Clustered lighting was not enabled");
+
+	lighting_state.directional_lights.clear();
+	lighting_state.point_lights.clear();
+	lighting_state.spot_lights.clear();
+
+	light_bounding_spheres.clear();
+	clustered_lights.clear();
+
+	for (auto &scene_light : scene_lights)
+	{
+		Light light = make_light(*scene_light);
+
+		switch (scene_light->get_light_type())
+		{
+			case sg::LightType::Directional:
+			{
+				if (lighting_state.directional_lights.size() < max_directional_lights)
+				{
+					lighting_state.directional_lights.push_back(light);
+				}
+				else
+				{
+					LOGE("Subpass::allocate_clustered_lights: exceeding max_directional_lights of {}", max_directional_lights);
+				}
+				break;
+			}
+			case sg::LightType::Point:
+			case sg::LightType::Spot:
+			{
+				// The range of a spot light also bounds its cone
+				light_bounding_spheres.push_back(glm::vec4(glm::vec3(light.position), light.direction.w));
+				clustered_lights.push_back(light);
+				break;
+			}
+			default:
+				LOGE("Subpass::allocate_clustered_lights: encountered unknown light type {}", to_string(scene_light->get_light_type()));
+				break;
+		}
+	}
+
+	auto &render_frame  = render_context.get_active_frame();
+	auto  render_extent = render_frame.get_render_target().get_extent();
+
+	light_clusters->update(camera.get_view(), vulkan_style_projection(camera.get_projection()), glm::uvec2(render_extent.width, render_extent.height));
+	light_clusters->bin(light_bounding_spheres);
+
+	T light_info;
+	std::copy(lighting_state.directional_lights.begin(), lighting_state.directional_lights.end(), light_info.directional_lights);
+
+	lighting_state.light_buffer = render_frame.allocate_buffer(vk::BufferUsageFlagBits::eUniformBuffer, sizeof(T));
+	lighting_state.light_buffer.update(light_info);
+
+	lighting_state.cluster_info_buffer = render_frame.allocate_buffer(vk::BufferUsageFlagBits::eUniformBuffer, sizeof(LightClusterInfo));
+	lighting_state.cluster_info_buffer.update(light_clusters->get_info());
+
+	// Storage buffers can not be empty, so they get at least one element
+	auto upload = [&render_frame](auto const &data) {
+		using ElementType = typename std::decay_t<decltype(data)>::value_type;
+
+		auto allocation = render_frame.allocate_buffer(vk::BufferUsageFlagBits::eStorageBuffer, std::max<size_t>(data.size(), 1) * sizeof(ElementType));
+		if (!data.empty())
+		{
+			allocation.get_buffer().update(data.data(), data.size() * sizeof(ElementType), allocation.get_offset());
+		}
+		return allocation;
+	};
+
+	lighting_state.clustered_light_buffer     = upload(clustered_lights);
+	lighting_state.cluster_range_buffer       = upload(light_clusters->get_cluster_ranges());
+	lighting_state.cluster_light_index_buffer = upload(light_clusters->get_light_indices());
+}
+
+template <vkb::BindingType bindingType>
+inline void Subpass<bindingType>::enable_clustered_lighting(const glm::uvec3 &grid_size)
+{
+	light_clusters = std::make_unique<LightClusters>(grid_size);
+}
+
+template <vkb::BindingType bindingType>
+inline bool Subpass<bindingType>::is_clustered_lighting_enabled() const
+{
+	return light_clusters != nullptr;
+}
+
+template <vkb::BindingType bindingType>
+inline Light Subpass<bindingType>::make_light(sg::Light &scene_light)
+{
+	const auto &properties = scene_light.get_properties();
+	auto       &transform  = scene_light.get_node()->get_transform();
+
+	return Light{{transform.get_translation(), static_cast<float>(scene_light.get_light_type())},
+	             {properties.color, properties.intensity},
+	             {transform.get_rotation() * properties.direction, properties.range},
+	             {properties.inner_cone_angle, properties.outer_cone_angle}};
+}
+
 template <vkb::BindingType bindingType>
 inline const std::vector<uint32_t> &Subpass<bindingType>::get_color_resolve_attachments() const
 {
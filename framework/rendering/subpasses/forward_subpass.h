@@ -21,7 +21,7 @@
 #include "buffer_pool.h"
 #include "rendering/subpasses/geometry_subpass.h"
 
-// This value is per type of light that we feed into the shader
+// This value is per type of light that we feed into the shader, with clustered lighting it only limits the directional lights
 #define MAX_FORWARD_LIGHT_COUNT 8
 
 namespace vkb
@@ -95,7 +95,14 @@ inline ForwardSubpass<bindingType>::ForwardSubpass(vkb::rendering::RenderContext
 template <vkb::BindingType bindingType>
 inline void ForwardSubpass<bindingType>::draw(vkb::core::CommandBuffer<bindingType> &command_buffer)
 {
-	this->template allocate_lights<ForwardLights>(this->get_scene().template get_components<sg::Light>(), MAX_FORWARD_LIGHT_COUNT);
+	if (this->is_clustered_lighting_enabled())
+	{
+		this->template allocate_clustered_lights<ForwardLights>(this->get_scene().template get_components<sg::Light>(), MAX_FORWARD_LIGHT_COUNT, this->get_camera());
+	}
+	else
+	{
+		this->template allocate_lights<ForwardLights>(this->get_scene().template get_components<sg::Light>(), MAX_FORWARD_LIGHT_COUNT);
+	}
 	command_buffer.bind_lighting(this->get_lighting_state(), 0, 4);
 
 	GeometrySubpass<bindingType>::draw(command_buffer);
@@ -112,6 +119,7 @@ inline void ForwardSubpass<bindingType>::prepare()
 			auto &variant     = sub_mesh->get_mut_shader_variant();
 			auto &vert_module = device.get_resource_cache().request_shader_module(vk::ShaderStageFlagBits::eVertex, this->get_vertex_shader_impl(), variant);
 			auto &frag_module = device.get_resource_cache().request_shader_module(vk::ShaderStageFlagBits::eFragment, this->get_fragment_shader_impl(), variant);
+			this->prepare_push_descriptors_impl({&vert_module, &frag_module});
 		}
 	}
 }
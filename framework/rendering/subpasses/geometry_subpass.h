@@ -19,6 +19,9 @@
 #pragma once
 
 #include "core/command_buffer.h"
+#include "core/util/profiling.hpp"
+#include "geometry/frustum_culler.h"
+#include "rendering/draw_list.h"
 #include "rendering/render_context.h"
 #include "rendering/subpass.h"
 #include "scene_graph/components/aabb.h"
@@ -119,6 +122,17 @@ class GeometrySubpass : public vkb::rendering::Subpass<bindingType>
 	 */
 	virtual void draw(vkb::core::CommandBuffer<bindingType> &command_buffer) override;
 
+	/**
+	 * @brief Enables or disables frustum culling of the scene, enabled by default
+	 */
+	void set_culling_enabled(bool enabled);
+
+	/**
+	 * @brief Sets the order opaque objects are drawn in, front-to-back by default
+	 *        Transparent objects are always drawn back-to-front, as blending requires
+	 */
+	void set_opaque_draw_order(DrawOrder order);
+
 	/**
 	 * @brief Thread index to use for allocating resources
 	 */
@@ -149,7 +163,23 @@ class GeometrySubpass : public vkb::rendering::Subpass<bindingType>
   protected:
 	std::vector<vkb::scene_graph::components::HPPMesh *> const &get_meshes_impl() const;
 
+	/**
+	 * @brief Marks the resources of set 0 of the modules as pushed, if the device enables VK_KHR_push_descriptor
+	 *        Called once from prepare(), so that the modes of a module stay the same from one draw to the next
+	 */
+	void prepare_push_descriptors_impl(const std::vector<vkb::core::HPPShaderModule *> &shader_modules);
+
   private:
+	struct DrawItem
+	{
+		vkb::scene_graph::NodeCpp                *node;
+		vkb::scene_graph::components::HPPSubMesh *sub_mesh;
+		float                                     distance;
+		vk::FrontFace                             front_face;
+	};
+
+  private:
+	void                          build_draw_lists();
 	void                          draw_impl(vkb::core::CommandBufferCpp &command_buffer);
 	void                          draw_submesh_impl(vkb::core::CommandBufferCpp              &command_buffer,
 	                                                vkb::scene_graph::components::HPPSubMesh &sub_mesh,
@@ -165,9 +195,15 @@ class GeometrySubpass : public vkb::rendering::Subpass<bindingType>
   private:
 	vkb::rendering::HPPRasterizationState                base_rasterization_state;
 	vkb::sg::Camera                                     &camera;
+	FrustumCuller                                        culler;
+	bool                                                 culling_enabled = true;
+	Frustum                                              frustum;
 	std::vector<vkb::scene_graph::components::HPPMesh *> meshes;
+	DrawOrder                                            opaque_draw_order = DrawOrder::FrontToBack;
+	DrawList<DrawItem>                                   opaque_draws;
 	vkb::scene_graph::SceneCpp                          *scene;
 	uint32_t                                             thread_index = 0;
+	DrawList<DrawItem>                                   transparent_draws;
 };
 
 using GeometrySubpassC   = GeometrySubpass<vkb::BindingType::C>;
@@ -208,40 +244,111 @@ inline void GeometrySubpass<bindingType>::draw(vkb::core::CommandBuffer<bindingT
 }
 
 template <vkb::BindingType bindingType>
-inline void GeometrySubpass<bindingType>::draw_impl(vkb::core::CommandBufferCpp &command_buffer)
+inline void GeometrySubpass<bindingType>::build_draw_lists()
 {
-	std::multimap<float, std::pair<vkb::scene_graph::NodeCpp *, vkb::scene_graph::components::HPPSubMesh *>> opaque_nodes;
-	std::multimap<float, std::pair<vkb::scene_graph::NodeCpp *, vkb::scene_graph::components::HPPSubMesh *>> transparent_nodes;
+	PROFILE_SCOPE("Build Draw Lists");
+
+	opaque_draws.clear();
+	transparent_draws.clear();
 
-	get_sorted_nodes_impl(opaque_nodes, transparent_nodes);
+	auto camera_position = glm::vec3(camera.get_node()->get_transform().get_world_matrix()[3]);
 
-	// Draw opaque objects in front-to-back order
+	// Gather the world space bounds of all the mesh instances, so they are culled in one batch
+	culler.clear();
+	for (auto &mesh : meshes)
+	{
+		auto const &bounds = mesh->get_bounds();
+		for (auto &node : mesh->get_nodes())
+		{
+			culler.add(bounds.get_min(), bounds.get_max(), node->get_transform().get_world_matrix());
+		}
+	}
+
+	if (culling_enabled)
+	{
+		frustum.update(vkb::rendering::vulkan_style_projection(camera.get_projection()) * camera.get_view());
+		culler.cull(frustum);
+	}
+
+	size_t instance_index = 0;
+	for (auto &mesh : meshes)
+	{
+		for (auto &node : mesh->get_nodes())
+		{
+			size_t index = instance_index++;
+			if (culling_enabled && !culler.is_visible(index))
+			{
+				continue;
+			}
+
+			auto &transform = node->get_transform();
+
+			// For an affine transform, the center of the transformed bounds is the transformed center of the bounds
+			float distance = glm::length(camera_position - culler.get_center(index));
+
+			// Invert the front face if the mesh was flipped
+			const auto   &scale      = transform.get_scale();
+			bool          flipped    = scale.x * scale.y * scale.z < 0;
+			vk::FrontFace front_face = flipped ? vk::FrontFace::eClockwise : vk::FrontFace::eCounterClockwise;
+
+			for (auto &sub_mesh : mesh->get_submeshes())
+			{
+				auto const *material = sub_mesh->get_material();
+
+				auto material_id = reinterpret_cast<uintptr_t>(material);
+				auto mesh_id     = reinterpret_cast<uintptr_t>(mesh);
+
+				// The shader variant, culling and front face select the pipeline of the draw
+				uint64_t state_id = reinterpret_cast<vkb::ShaderVariant const &>(sub_mesh->get_shader_variant()).get_id();
+				state_id          = (state_id << 2) | (material->is_double_sided() ? 2 : 0) | (flipped ? 1 : 0);
+
+				if (material->get_alpha_mode() == sg::AlphaMode::Blend)
+				{
+					transparent_draws.add(make_draw_sort_key(DrawOrder::BackToFront, distance, state_id, material_id, mesh_id),
+					                      DrawItem{node, sub_mesh, distance, front_face});
+				}
+				else
+				{
+					opaque_draws.add(make_draw_sort_key(opaque_draw_order, distance, state_id, material_id, mesh_id),
+					                 DrawItem{node, sub_mesh, distance, front_face});
+				}
+			}
+		}
+	}
+
+	opaque_draws.sort();
+	transparent_draws.sort();
+}
+
+template <vkb::BindingType bindingType>
+inline void GeometrySubpass<bindingType>::draw_impl(vkb::core::CommandBufferCpp &command_buffer)
+{
+	build_draw_lists();
+
+	// Draw opaque objects in the selected order
 	{
 		vkb::core::HPPScopedDebugLabel opaque_debug_label{command_buffer, "Opaque objects"};
 
-		for (auto node_it = opaque_nodes.begin(); node_it != opaque_nodes.end(); node_it++)
+		for (size_t i = 0; i < opaque_draws.size(); ++i)
 		{
+			auto const &draw = opaque_draws[i];
+
 			if constexpr (bindingType == vkb::BindingType::Cpp)
 			{
-				update_uniform(command_buffer, *node_it->second.first, thread_index);
+				update_uniform(command_buffer, *draw.node, thread_index);
 			}
 			else
 			{
 				update_uniform(reinterpret_cast<vkb::core::CommandBufferC &>(command_buffer),
-				               reinterpret_cast<vkb::scene_graph::NodeC &>(*node_it->second.first),
+				               reinterpret_cast<vkb::scene_graph::NodeC &>(*draw.node),
 				               thread_index);
 			}
 
-			// Invert the front face if the mesh was flipped
-			const auto   &scale      = node_it->second.first->get_transform().get_scale();
-			bool          flipped    = scale.x * scale.y * scale.z < 0;
-			vk::FrontFace front_face = flipped ? vk::FrontFace::eClockwise : vk::FrontFace::eCounterClockwise;
-
-			draw_submesh_impl(command_buffer, *node_it->second.second, front_face);
+			draw_submesh_impl(command_buffer, *draw.sub_mesh, draw.front_face);
 		}
 	}
 
-	if (!transparent_nodes.empty())
+	if (!transparent_draws.empty())
 	{
 		// Enable alpha blending
 		vkb::rendering::HPPColorBlendAttachmentState color_blend_attachment{.blend_enable           = true,
@@ -259,19 +366,21 @@ inline void GeometrySubpass<bindingType>::draw_impl(vkb::core::CommandBufferCpp
 		{
 			vkb::core::HPPScopedDebugLabel transparent_debug_label{command_buffer, "Transparent objects"};
 
-			for (auto node_it = transparent_nodes.rbegin(); node_it != transparent_nodes.rend(); node_it++)
+			for (size_t i = 0; i < transparent_draws.size(); ++i)
 			{
+				auto const &draw = transparent_draws[i];
+
 				if constexpr (bindingType == vkb::BindingType::Cpp)
 				{
-					update_uniform(command_buffer, *node_it->second.first, thread_index);
+					update_uniform(command_buffer, *draw.node, thread_index);
 				}
 				else
 				{
 					update_uniform(reinterpret_cast<vkb::core::CommandBufferC &>(command_buffer),
-					               reinterpret_cast<vkb::scene_graph::NodeC &>(*node_it->second.first),
+					               reinterpret_cast<vkb::scene_graph::NodeC &>(*draw.node),
 					               thread_index);
 				}
-				draw_submesh_impl(command_buffer, *node_it->second.second);
+				draw_submesh_impl(command_buffer, *draw.sub_mesh);
 			}
 		}
 	}
@@ -289,10 +398,23 @@ inline void GeometrySubpass<bindingType>::prepare()
 			auto &variant     = sub_mesh->get_shader_variant();
 			auto &vert_module = resource_cache.request_shader_module(vk::ShaderStageFlagBits::eVertex, this->get_vertex_shader_impl(), variant);
 			auto &frag_module = resource_cache.request_shader_module(vk::ShaderStageFlagBits::eFragment, this->get_fragment_shader_impl(), variant);
+			prepare_push_descriptors_impl({&vert_module, &frag_module});
 		}
 	}
 }
 
+template <vkb::BindingType bindingType>
+inline void GeometrySubpass<bindingType>::set_culling_enabled(bool enabled)
+{
+	culling_enabled = enabled;
+}
+
+template <vkb::BindingType bindingType>
+inline void GeometrySubpass<bindingType>::set_opaque_draw_order(DrawOrder order)
+{
+	opaque_draw_order = order;
+}
+
 template <vkb::BindingType bindingType>
 inline void GeometrySubpass<bindingType>::set_thread_index(uint32_t index)
 {
@@ -401,33 +523,15 @@ inline void GeometrySubpass<bindingType>::get_sorted_nodes_impl(
     std::multimap<float, std::pair<vkb::scene_graph::NodeCpp *, vkb::scene_graph::components::HPPSubMesh *>> &opaque_nodes,
     std::multimap<float, std::pair<vkb::scene_graph::NodeCpp *, vkb::scene_graph::components::HPPSubMesh *>> &transparent_nodes)
 {
-	auto camera_transform = camera.get_node()->get_transform().get_world_matrix();
+	build_draw_lists();
 
-	for (auto &mesh : meshes)
+	for (size_t i = 0; i < opaque_draws.size(); ++i)
 	{
-		for (auto &node : mesh->get_nodes())
-		{
-			auto node_transform = node->get_transform().get_world_matrix();
-
-			const sg::AABB &mesh_bounds = mesh->get_bounds();
-
-			sg::AABB world_bounds{mesh_bounds.get_min(), mesh_bounds.get_max()};
-			world_bounds.transform(node_transform);
-
-			float distance = glm::length(glm::vec3(camera_transform[3]) - world_bounds.get_center());
-
-			for (auto &sub_mesh : mesh->get_submeshes())
-			{
-				if (sub_mesh->get_material()->get_alpha_mode() == sg::AlphaMode::Blend)
-				{
-					transparent_nodes.emplace(distance, std::make_pair(node, sub_mesh));
-				}
-				else
-				{
-					opaque_nodes.emplace(distance, std::make_pair(node, sub_mesh));
-				}
-			}
-		}
+		opaque_nodes.emplace(opaque_draws[i].distance, std::make_pair(opaque_draws[i].node, opaque_draws[i].sub_mesh));
+	}
+	for (size_t i = 0; i < transparent_draws.size(); ++i)
+	{
+		transparent_nodes.emplace(transparent_draws[i].distance, std::make_pair(transparent_draws[i].node, transparent_draws[i].sub_mesh));
 	}
 }
 
@@ -490,6 +594,50 @@ inline std::vector<vkb::scene_graph::components::HPPMesh *> const &GeometrySubpa
 	return meshes;
 }
 
+template <vkb::BindingType bindingType>
+inline void GeometrySubpass<bindingType>::prepare_push_descriptors_impl(const std::vector<vkb::core::HPPShaderModule *> &shader_modules)
+{
+	if (!this->get_render_context_impl().get_device().is_extension_enabled(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME))
+	{
+		return;
+	}
+
+	// Set 0 holds the uniforms and textures of each draw, so pushing it saves allocating and writing a descriptor set
+	// per draw. A push set cannot hold dynamic or update-after-bind resources, and a set with a resource in the
+	// resource mode map is left to the modes the map sets on each draw
+	auto is_set_0_resource = [](const vkb::core::HPPShaderResource &resource) {
+		return resource.set == 0 &&
+		       resource.type != vkb::core::HPPShaderResourceType::Input &&
+		       resource.type != vkb::core::HPPShaderResourceType::Output &&
+		       resource.type != vkb::core::HPPShaderResourceType::PushConstant &&
+		       resource.type != vkb::core::HPPShaderResourceType::SpecializationConstant;
+	};
+
+	auto const &resource_mode_map = this->get_resource_mode_map();
+
+	bool pushable = std::ranges::none_of(shader_modules, [&](const vkb::core::HPPShaderModule *shader_module) {
+		return std::ranges::any_of(shader_module->get_resources(), [&](const vkb::core::HPPShaderResource &resource) {
+			return is_set_0_resource(resource) &&
+			       (resource.mode == vkb::core::HPPShaderResourceMode::Dynamic || resource.mode == vkb::core::HPPShaderResourceMode::UpdateAfterBind ||
+			        resource_mode_map.contains(resource.name));
+		});
+	});
+
+	if (pushable)
+	{
+		for (auto *shader_module : shader_modules)
+		{
+			for (auto &resource : shader_module->get_resources())
+			{
+				if (is_set_0_resource(resource))
+				{
+					shader_module->set_resource_mode(resource.name, ShaderResourceMode::Push);
+				}
+			}
+		}
+	}
+}
+
 template <vkb::BindingType bindingType>
 inline void GeometrySubpass<bindingType>::draw_submesh_impl(vkb::core::CommandBufferCpp              &command_buffer,
                                                             vkb::scene_graph::components::HPPSubMesh &sub_mesh,
@@ -0,0 +1,593 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <unordered_map>
+
+#include "core/command_buffer.h"
+#include "geometry/frustum.h"
+#include "rendering/subpasses/forward_subpass.h"
+#include "scene_graph/components/hpp_mesh.h"
+#include "scene_graph/components/pbr_material.h"
+#include "scene_graph/components/sub_mesh.h"
+#include "scene_graph/scene.h"
+
+namespace vkb
+{
+namespace rendering
+{
+namespace subpasses
+{
+/**
+ * @brief This subpass renders a Scene with a fixed number of indirect draw calls
+ *
+ * On prepare, the vertices and indices of all the sub meshes are packed into shared buffers, and every instance of a
+ * sub mesh gets a draw with its geometry range, bounding sphere and material index. The draws are grouped into
+ * buckets of identical pipeline state. Each frame a compute pass culls the draws against the camera frustum and
+ * writes their indirect commands, and each bucket is then drawn with a single draw_indexed_indirect, so the CPU cost
+ * of recording does not depend on the number of objects.
+ *
+ * The vertex shader reads the transform and material of a draw with the instance index, which requires the
+ * drawIndirectFirstInstance feature. Without the multiDrawIndirect feature each draw is recorded separately.
+ *
+ * Materials are shaded with their factors only, and the sub meshes must have host visible vertex and index buffers,
+ * as loaded by the GLTFLoader. Transparent draws are blended in bucket order, without sorting by distance.
+ *
+ * With clustered lighting enabled, the fragment shader must read the point and spot lights from the cluster grid, as
+ * clustered_lighting/indirect_geometry.frag does.
+ */
+template <vkb::BindingType bindingType>
+class IndirectGeometrySubpass : public vkb::rendering::Subpass<bindingType>
+{
+  public:
+	using ShaderSourceType = typename std::conditional<bindingType == vkb::BindingType::Cpp, vkb::core::HPPShaderSource, vkb::ShaderSource>::type;
+
+  public:
+	/**
+	 * @brief Constructs a subpass drawing a scene with indirect draws
+	 * @param render_context Render context
+	 * @param vertex_shader Vertex shader source, reading the transforms and draws storage buffers
+	 * @param fragment_shader Fragment shader source, reading the materials storage buffer
+	 * @param scene Scene to render on this subpass
+	 * @param camera Camera used to look at the scene
+	 */
+	IndirectGeometrySubpass(vkb::rendering::RenderContext<bindingType> &render_context,
+	                        ShaderSourceType                          &&vertex_shader,
+	                        ShaderSourceType                          &&fragment_shader,
+	                        vkb::scene_graph::Scene<bindingType>       &scene,
+	                        sg::Camera                                 &camera);
+
+	virtual ~IndirectGeometrySubpass() = default;
+
+	// from vkb::rendering::Subpass
+	void draw(vkb::core::CommandBuffer<bindingType> &command_buffer) override;
+	void pre_render_pass(vkb::core::CommandBuffer<bindingType> &command_buffer) override;
+	void prepare() override;
+
+	/**
+	 * @return The number of draws, one per instance of a sub mesh
+	 */
+	uint32_t get_draw_count() const;
+
+	/**
+	 * @return The number of indirect draw calls recorded per frame, one per pipeline state
+	 */
+	uint32_t get_draw_call_count() const;
+
+  private:
+	static constexpr uint32_t CULLING_GROUP_SIZE = 64;
+
+	/**
+	 * @brief The per draw data read by the culling pass and the vertex shader, matching DrawData in the shaders
+	 */
+	struct DrawData
+	{
+		glm::vec4 bounding_sphere;        // Center and radius in model space
+		uint32_t  index_count;
+		uint32_t  first_index;
+		int32_t   vertex_offset;
+		uint32_t  material_index;
+	};
+
+	/**
+	 * @brief The per material data read by the fragment shader, matching MaterialData in the shader
+	 */
+	struct MaterialData
+	{
+		glm::vec4 base_color_factor;
+		float     metallic_factor;
+		float     roughness_factor;
+		float     alpha_cutoff;
+		uint32_t  alpha_mask;
+	};
+
+	struct FrustumPushConstants
+	{
+		std::array<glm::vec4, 6> planes;
+		uint32_t                 draw_count;
+	};
+
+	/**
+	 * @brief A range of draws sharing the same pipeline state
+	 */
+	struct PipelineBucket
+	{
+		uint32_t      first_draw;
+		uint32_t      draw_count;
+		bool          blend;
+		bool          double_sided;
+		vk::FrontFace front_face;
+	};
+
+  private:
+	template <typename T>
+	static bool copy_attribute(vkb::sg::SubMesh &sub_mesh, std::string const &name, vk::Format format, std::vector<T> &destination);
+	template <typename T>
+	static std::unique_ptr<vkb::core::BufferCpp>
+	    create_buffer(vkb::core::DeviceCpp &device, std::vector<T> const &data, vk::BufferUsageFlags usage, std::string const &name);
+
+	void draw_impl(vkb::core::CommandBufferCpp &command_buffer);
+	void pre_render_pass_impl(vkb::core::CommandBufferCpp &command_buffer);
+
+  private:
+	std::vector<PipelineBucket>                        buckets;
+	sg::Camera                                        &camera;
+	vkb::core::HPPShaderSource                         culling_shader;
+	std::unique_ptr<vkb::core::BufferCpp>              draw_buffer;
+	std::vector<vkb::scene_graph::NodeCpp *>           draw_nodes;        // The node of each draw, providing its transform
+	std::vector<std::unique_ptr<vkb::core::BufferCpp>> indirect_buffers;        // The indirect commands of each render frame
+	std::unique_ptr<vkb::core::BufferCpp>              index_buffer;
+	std::unique_ptr<vkb::core::BufferCpp>              material_buffer;
+	bool                                               multi_draw_indirect = false;
+	std::unique_ptr<vkb::core::BufferCpp>              normal_buffer;
+	std::unique_ptr<vkb::core::BufferCpp>              position_buffer;
+	vkb::scene_graph::SceneCpp                        *scene;
+	std::unique_ptr<vkb::core::BufferCpp>              texcoord_buffer;
+	vkb::BufferAllocationCpp                           transform_allocation;
+	std::vector<glm::mat4>                             transforms;
+};
+
+using IndirectGeometrySubpassC   = IndirectGeometrySubpass<vkb::BindingType::C>;
+using IndirectGeometrySubpassCpp = IndirectGeometrySubpass<vkb::BindingType::Cpp>;
+
+// Member function definitions
+
+template <vkb::BindingType bindingType>
+inline IndirectGeometrySubpass<bindingType>::IndirectGeometrySubpass(vkb::rendering::RenderContext<bindingType> &render_context,
+                                                                     ShaderSourceType                          &&vertex_source,
+                                                                     ShaderSourceType                          &&fragment_source,
+                                                                     vkb::scene_graph::Scene<bindingType>       &scene_,
+                                                                     sg::Camera                                 &camera) :
+    Subpass<bindingType>{render_context, std::move(vertex_source), std::move(fragment_source)}, camera{camera}, culling_shader{"indirect_geometry/build_draws.comp.spv"}
+{
+	if constexpr (bindingType == vkb::BindingType::Cpp)
+	{
+		scene = &scene_;
+	}
+	else
+	{
+		scene = reinterpret_cast<vkb::scene_graph::SceneCpp *>(&scene_);
+	}
+}
+
+template <vkb::BindingType bindingType>
+inline void IndirectGeometrySubpass<bindingType>::draw(vkb::core::CommandBuffer<bindingType> &command_buffer)
+{
+	if (this->is_clustered_lighting_enabled())
+	{
+		this->template allocate_clustered_lights<ForwardLights>(scene->get_components<sg::Light>(), MAX_FORWARD_LIGHT_COUNT, camera);
+	}
+	else
+	{
+		this->template allocate_lights<ForwardLights>(scene->get_components<sg::Light>(), MAX_FORWARD_LIGHT_COUNT);
+	}
+
+	if constexpr (bindingType == vkb::BindingType::Cpp)
+	{
+		draw_impl(command_buffer);
+	}
+	else
+	{
+		draw_impl(reinterpret_cast<vkb::core::CommandBufferCpp &>(command_buffer));
+	}
+}
+
+template <vkb::BindingType bindingType>
+inline void IndirectGeometrySubpass<bindingType>::pre_render_pass(vkb::core::CommandBuffer<bindingType> &command_buffer)
+{
+	if constexpr (bindingType == vkb::BindingType::Cpp)
+	{
+		pre_render_pass_impl(command_buffer);
+	}
+	else
+	{
+		pre_render_pass_impl(reinterpret_cast<vkb::core::CommandBufferCpp &>(command_buffer));
+	}
+}
+
+template <vkb::BindingType bindingType>
+inline void IndirectGeometrySubpass<bindingType>::prepare()
+{
+	auto &device = this->get_render_context_impl().get_device();
+
+	auto const &features = device.get_gpu().get_requested_features();
+	if (!features.drawIndirectFirstInstance)
+	{
+		throw std::runtime_error("IndirectGeometrySubpass requires the drawIndirectFirstInstance feature");
+	}
+	multi_draw_indirect = features.multiDrawIndirect;
+
+	std::vector<glm::vec3>    positions;
+	std::vector<glm::vec3>    normals;
+	std::vector<glm::vec2>    texcoords;
+	std::vector<uint32_t>     indices;
+	std::vector<MaterialData> materials;
+
+	std::unordered_map<vkb::sg::Material const *, uint32_t> material_indices;
+
+	// The draws are gathered with the key of their pipeline bucket, and then grouped by it
+	struct PendingDraw
+	{
+		uint32_t                   bucket_key;
+		DrawData                   data;
+		vkb::scene_graph::NodeCpp *node;
+	};
+	std::vector<PendingDraw> pending_draws;
+
+	for (auto *mesh : scene->get_components<vkb::scene_graph::components::HPPMesh>())
+	{
+		auto const &bounds          = mesh->get_bounds();
+		glm::vec4   bounding_sphere = glm::vec4(bounds.get_center(), 0.5f * glm::length(bounds.get_scale()));
+
+		for (auto *hpp_sub_mesh : mesh->get_submeshes())
+		{
+			auto &sub_mesh = reinterpret_cast<vkb::sg::SubMesh &>(*hpp_sub_mesh);
+
+			uint32_t first_vertex = to_u32(positions.size());
+			if (!copy_attribute(sub_mesh, "position", vk::Format::eR32G32B32Sfloat, positions))
+			{
+				LOGW("IndirectGeometrySubpass: skipping {}, its positions are not readable 32-bit float vectors", sub_mesh.get_name());
+				continue;
+			}
+			copy_attribute(sub_mesh, "normal", vk::Format::eR32G32B32Sfloat, normals);
+			copy_attribute(sub_mesh, "texcoord_0", vk::Format::eR32G32Sfloat, texcoords);
+
+			// The indices stay relative to the sub mesh, the vertex offset of the draw moves them to its vertices
+			uint32_t first_index = to_u32(indices.size());
+			if (sub_mesh.index_buffer && 0 < sub_mesh.vertex_indices)
+			{
+				uint8_t const *data = sub_mesh.index_buffer->map() + sub_mesh.index_offset;
+				for (uint32_t i = 0; i < sub_mesh.vertex_indices; ++i)
+				{
+					if (sub_mesh.index_type == VK_INDEX_TYPE_UINT16)
+					{
+						uint16_t index;
+						std::memcpy(&index, data + i * sizeof(uint16_t), sizeof(uint16_t));
+						indices.push_back(index);
+					}
+					else
+					{
+						uint32_t index;
+						std::memcpy(&index, data + i * sizeof(uint32_t), sizeof(uint32_t));
+						indices.push_back(index);
+					}
+				}
+				sub_mesh.index_buffer->unmap();
+			}
+			else
+			{
+				for (uint32_t i = 0; i < sub_mesh.vertices_count; ++i)
+				{
+					indices.push_back(i);
+				}
+			}
+
+			auto const *material = sub_mesh.get_material();
+
+			auto material_it = material_indices.find(material);
+			if (material_it == material_indices.end())
+			{
+				auto const *pbr_material = dynamic_cast<sg::PBRMaterial const *>(material);
+
+				MaterialData material_data{};
+				material_data.base_color_factor = pbr_material ? pbr_material->base_color_factor : glm::vec4(1.0f);
+				material_data.metallic_factor   = pbr_material ? pbr_material->metallic_factor : 0.0f;
+				material_data.roughness_factor  = pbr_material ? pbr_material->roughness_factor : 1.0f;
+				material_data.alpha_cutoff      = material->alpha_cutoff;
+				material_data.alpha_mask        = material->alpha_mode == sg::AlphaMode::Mask ? 1 : 0;
+
+				material_it = material_indices.emplace(material, to_u32(materials.size())).first;
+				materials.push_back(material_data);
+			}
+
+			DrawData draw_data{.bounding_sphere = bounding_sphere,
+			                   .index_count     = to_u32(indices.size()) - first_index,
+			                   .first_index     = first_index,
+			                   .vertex_offset   = static_cast<int32_t>(first_vertex),
+			                   .material_index  = material_it->second};
+
+			for (auto *node : mesh->get_nodes())
+			{
+				// Invert the front face if the node is flipped, which is assumed not to change after preparing
+				const auto &scale   = node->get_transform().get_scale();
+				bool        flipped = scale.x * scale.y * scale.z < 0;
+
+				uint32_t bucket_key = (material->alpha_mode == sg::AlphaMode::Blend ? 4 : 0) | (material->double_sided ? 2 : 0) | (flipped ? 1 : 0);
+				pending_draws.push_back({bucket_key, draw_data, node});
+			}
+		}
+	}
+
+	// Opaque buckets come first, so blended draws are drawn on top of them
+	std::stable_sort(pending_draws.begin(), pending_draws.end(), [](PendingDraw const &a, PendingDraw const &b) { return a.bucket_key < b.bucket_key; });
+
+	std::vector<DrawData> draws;
+	draws.reserve(pending_draws.size());
+	draw_nodes.clear();
+	buckets.clear();
+	for (auto const &pending_draw : pending_draws)
+	{
+		if (buckets.empty() || pending_draws[buckets.back().first_draw].bucket_key != pending_draw.bucket_key)
+		{
+			buckets.push_back({.first_draw   = to_u32(draws.size()),
+			                   .draw_count   = 0,
+			                   .blend        = (pending_draw.bucket_key & 4) != 0,
+			                   .double_sided = (pending_draw.bucket_key & 2) != 0,
+			                   .front_face   = (pending_draw.bucket_key & 1) ? vk::FrontFace::eClockwise : vk::FrontFace::eCounterClockwise});
+		}
+		++buckets.back().draw_count;
+
+		draws.push_back(pending_draw.data);
+		draw_nodes.push_back(pending_draw.node);
+	}
+
+	position_buffer = create_buffer(device, positions, vk::BufferUsageFlagBits::eVertexBuffer, "IndirectGeometrySubpass positions");
+	normal_buffer   = create_buffer(device, normals, vk::BufferUsageFlagBits::eVertexBuffer, "IndirectGeometrySubpass normals");
+	texcoord_buffer = create_buffer(device, texcoords, vk::BufferUsageFlagBits::eVertexBuffer, "IndirectGeometrySubpass texcoords");
+	index_buffer    = create_buffer(device, indices, vk::BufferUsageFlagBits::eIndexBuffer, "IndirectGeometrySubpass indices");
+	draw_buffer     = create_buffer(device, draws, vk::BufferUsageFlagBits::eStorageBuffer, "IndirectGeometrySubpass draws");
+	material_buffer = create_buffer(device, materials, vk::BufferUsageFlagBits::eStorageBuffer, "IndirectGeometrySubpass materials");
+
+	// Build the shader modules upfront
+	auto &resource_cache = device.get_resource_cache();
+	resource_cache.request_shader_module(vk::ShaderStageFlagBits::eVertex, this->get_vertex_shader_impl());
+	resource_cache.request_shader_module(vk::ShaderStageFlagBits::eFragment, this->get_fragment_shader_impl());
+	resource_cache.request_shader_module(vk::ShaderStageFlagBits::eCompute, culling_shader);
+}
+
+template <vkb::BindingType bindingType>
+inline uint32_t IndirectGeometrySubpass<bindingType>::get_draw_count() const
+{
+	return to_u32(draw_nodes.size());
+}
+
+template <vkb::BindingType bindingType>
+inline uint32_t IndirectGeometrySubpass<bindingType>::get_draw_call_count() const
+{
+	if (multi_draw_indirect)
+	{
+		return to_u32(buckets.size());
+	}
+	return get_draw_count();
+}
+
+template <vkb::BindingType bindingType>
+template <typename T>
+inline bool IndirectGeometrySubpass<bindingType>::copy_attribute(vkb::sg::SubMesh &sub_mesh, std::string const &name, vk::Format format, std::vector<T> &destination)
+{
+	// An attribute the sub mesh does not have is left zeroed, so that all the attribute buffers share the vertex indices
+	size_t first_vertex = destination.size();
+	destination.resize(first_vertex + sub_mesh.vertices_count, T{0.0f});
+
+	vkb::sg::VertexAttribute attribute;
+	auto                     buffer_it = sub_mesh.vertex_buffers.find(name);
+	if (buffer_it == sub_mesh.vertex_buffers.end() || !sub_mesh.get_attribute(name, attribute) || attribute.format != static_cast<VkFormat>(format))
+	{
+		return false;
+	}
+
+	uint8_t const *data = buffer_it->second.map() + attribute.offset;
+	for (uint32_t i = 0; i < sub_mesh.vertices_count; ++i)
+	{
+		std::memcpy(&destination[first_vertex + i], data + i * attribute.stride, sizeof(T));
+	}
+	buffer_it->second.unmap();
+
+	return true;
+}
+
+template <vkb::BindingType bindingType>
+template <typename T>
+inline std::unique_ptr<vkb::core::BufferCpp> IndirectGeometrySubpass<bindingType>::create_buffer(vkb::core::DeviceCpp  &device,
+                                                                                                 std::vector<T> const  &data,
+                                                                                                 vk::BufferUsageFlags   usage,
+                                                                                                 std::string const     &name)
+{
+	// Buffers can not be empty, an empty scene still gets valid bindings
+	vk::DeviceSize size = std::max(data.size(), size_t{1}) * sizeof(T);
+
+	auto buffer = vkb::core::BufferBuilderCpp(size)
+	                  .with_usage(usage)
+	                  .with_vma_usage(VMA_MEMORY_USAGE_CPU_TO_GPU)
+	                  .with_vma_flags(VMA_ALLOCATION_CREATE_MAPPED_BIT | VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT)
+	                  .with_debug_name(name)
+	                  .build_unique(device);
+	if (!data.empty())
+	{
+		buffer->update(data);
+	}
+	return buffer;
+}
+
+template <vkb::BindingType bindingType>
+inline void IndirectGeometrySubpass<bindingType>::draw_impl(vkb::core::CommandBufferCpp &command_buffer)
+{
+	if (draw_nodes.empty())
+	{
+		return;
+	}
+	assert(!transform_allocation.empty() && "The indirect draws are built in pre_render_pass, which must be recorded before draw");
+
+	auto &render_context = this->get_render_context_impl();
+	auto &render_frame   = render_context.get_active_frame();
+
+	GlobalUniform global_uniform;
+	global_uniform.model            = glm::mat4(1.0f);
+	global_uniform.camera_view_proj = camera.get_pre_rotation() * vkb::rendering::vulkan_style_projection(camera.get_projection()) * camera.get_view();
+	global_uniform.camera_position  = glm::vec3(glm::inverse(camera.get_view())[3]);
+
+	auto global_allocation = render_frame.allocate_buffer(vk::BufferUsageFlagBits::eUniformBuffer, sizeof(GlobalUniform));
+	global_allocation.update(global_uniform);
+
+	auto &resource_cache     = command_buffer.get_device().get_resource_cache();
+	auto &vert_shader_module = resource_cache.request_shader_module(vk::ShaderStageFlagBits::eVertex, this->get_vertex_shader_impl());
+	auto &frag_shader_module = resource_cache.request_shader_module(vk::ShaderStageFlagBits::eFragment, this->get_fragment_shader_impl());
+	auto &pipeline_layout    = resource_cache.request_pipeline_layout({&vert_shader_module, &frag_shader_module});
+
+	command_buffer.bind_pipeline_layout(pipeline_layout);
+
+	command_buffer.bind_buffer(*material_buffer, 0, material_buffer->get_size(), 0, 0, 0);
+	command_buffer.bind_buffer(global_allocation.get_buffer(), global_allocation.get_offset(), global_allocation.get_size(), 0, 1, 0);
+	command_buffer.bind_buffer(transform_allocation.get_buffer(), transform_allocation.get_offset(), transform_allocation.get_size(), 0, 2, 0);
+	command_buffer.bind_buffer(*draw_buffer, 0, draw_buffer->get_size(), 0, 3, 0);
+	command_buffer.bind_lighting(this->get_lighting_state_impl(), 0, 4);
+
+	// The attributes of all the draws are in one buffer each, in the locations of the base shaders
+	HPPVertexInputState vertex_input_state;
+	vertex_input_state.bindings   = {{.binding = 0, .stride = sizeof(glm::vec3)},
+	                                 {.binding = 1, .stride = sizeof(glm::vec2)},
+	                                 {.binding = 2, .stride = sizeof(glm::vec3)}};
+	vertex_input_state.attributes = {{.location = 0, .binding = 0, .format = vk::Format::eR32G32B32Sfloat},
+	                                 {.location = 1, .binding = 1, .format = vk::Format::eR32G32Sfloat},
+	                                 {.location = 2, .binding = 2, .format = vk::Format::eR32G32B32Sfloat}};
+	command_buffer.set_vertex_input_state(vertex_input_state);
+
+	command_buffer.bind_vertex_buffers(0, {std::cref(*position_buffer), std::cref(*texcoord_buffer), std::cref(*normal_buffer)}, {0, 0, 0});
+	command_buffer.bind_index_buffer(*index_buffer, 0, vk::IndexType::eUint32);
+
+	vkb::rendering::HPPMultisampleState multisample_state{.rasterization_samples = this->get_sample_count_impl()};
+	command_buffer.set_multisample_state(multisample_state);
+	command_buffer.set_depth_stencil_state(this->get_depth_stencil_state_impl());
+
+	auto const &indirect_buffer = *indirect_buffers[render_context.get_active_frame_index()];
+	uint32_t    stride          = sizeof(vk::DrawIndexedIndirectCommand);
+
+	for (auto const &bucket : buckets)
+	{
+		vkb::rendering::HPPColorBlendAttachmentState color_blend_attachment{};
+		if (bucket.blend)
+		{
+			color_blend_attachment = {.blend_enable           = true,
+			                          .src_color_blend_factor = vk::BlendFactor::eSrcAlpha,
+			                          .dst_color_blend_factor = vk::BlendFactor::eOneMinusSrcAlpha,
+			                          .src_alpha_blend_factor = vk::BlendFactor::eOneMinusSrcAlpha};
+		}
+		vkb::rendering::HPPColorBlendState color_blend_state{};
+		color_blend_state.attachments.assign(this->get_output_attachments().size(), color_blend_attachment);
+		command_buffer.set_color_blend_state(color_blend_state);
+
+		vkb::rendering::HPPRasterizationState rasterization_state{};
+		rasterization_state.front_face = bucket.front_face;
+		if (bucket.double_sided)
+		{
+			rasterization_state.cull_mode = vk::CullModeFlagBits::eNone;
+		}
+		command_buffer.set_rasterization_state(rasterization_state);
+
+		vk::DeviceSize offset = vk::DeviceSize{bucket.first_draw} * stride;
+		if (multi_draw_indirect)
+		{
+			command_buffer.draw_indexed_indirect(indirect_buffer, offset, bucket.draw_count, stride);
+		}
+		else
+		{
+			for (uint32_t i = 0; i < bucket.draw_count; ++i)
+			{
+				command_buffer.draw_indexed_indirect(indirect_buffer, offset + vk::DeviceSize{i} * stride, 1, stride);
+			}
+		}
+	}
+}
+
+template <vkb::BindingType bindingType>
+inline void IndirectGeometrySubpass<bindingType>::pre_render_pass_impl(vkb::core::CommandBufferCpp &command_buffer)
+{
+	if (draw_nodes.empty())
+	{
+		return;
+	}
+
+	auto &render_context = this->get_render_context_impl();
+	auto &device         = render_context.get_device();
+
+	// Each render frame has its own commands, so they are not written while a previous frame still reads them
+	uint32_t frame_index = render_context.get_active_frame_index();
+	if (indirect_buffers.size() <= frame_index)
+	{
+		indirect_buffers.resize(frame_index + 1);
+	}
+	auto &indirect_buffer = indirect_buffers[frame_index];
+	if (!indirect_buffer)
+	{
+		indirect_buffer = vkb::core::BufferBuilderCpp(draw_nodes.size() * sizeof(vk::DrawIndexedIndirectCommand))
+		                      .with_usage(vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eIndirectBuffer)
+		                      .with_vma_usage(VMA_MEMORY_USAGE_GPU_ONLY)
+		                      .with_debug_name(fmt::format("IndirectGeometrySubpass commands, frame #{}", frame_index))
+		                      .build_unique(device);
+	}
+
+	// The transforms are read by the culling pass and by the vertex shader
+	transforms.resize(draw_nodes.size());
+	for (size_t i = 0; i < draw_nodes.size(); ++i)
+	{
+		transforms[i] = draw_nodes[i]->get_transform().get_world_matrix();
+	}
+	transform_allocation = render_context.get_active_frame().allocate_buffer(vk::BufferUsageFlagBits::eStorageBuffer, transforms.size() * sizeof(glm::mat4));
+	transform_allocation.get_buffer().update(transforms.data(), transforms.size() * sizeof(glm::mat4), transform_allocation.get_offset());
+
+	Frustum frustum;
+	frustum.update(vkb::rendering::vulkan_style_projection(camera.get_projection()) * camera.get_view());
+
+	FrustumPushConstants push_constants{.planes = frustum.get_planes(), .draw_count = to_u32(draw_nodes.size())};
+
+	vkb::core::HPPScopedDebugLabel debug_label{command_buffer, "Build indirect draws"};
+
+	auto &culling_module  = device.get_resource_cache().request_shader_module(vk::ShaderStageFlagBits::eCompute, culling_shader);
+	auto &pipeline_layout = device.get_resource_cache().request_pipeline_layout({&culling_module});
+
+	command_buffer.bind_pipeline_layout(pipeline_layout);
+	command_buffer.bind_buffer(*draw_buffer, 0, draw_buffer->get_size(), 0, 0, 0);
+	command_buffer.bind_buffer(transform_allocation.get_buffer(), transform_allocation.get_offset(), transform_allocation.get_size(), 0, 1, 0);
+	command_buffer.bind_buffer(*indirect_buffer, 0, indirect_buffer->get_size(), 0, 2, 0);
+	command_buffer.push_constants(push_constants);
+	command_buffer.dispatch((push_constants.draw_count + CULLING_GROUP_SIZE - 1) / CULLING_GROUP_SIZE, 1, 1);
+
+	command_buffer.buffer_memory_barrier(*indirect_buffer,
+	                                     0,
+	                                     VK_WHOLE_SIZE,
+	                                     {.src_stage_mask  = vk::PipelineStageFlagBits::eComputeShader,
+	                                      .dst_stage_mask  = vk::PipelineStageFlagBits::eDrawIndirect,
+	                                      .src_access_mask = vk::AccessFlagBits::eShaderWrite,
+	                                      .dst_access_mask = vk::AccessFlagBits::eIndirectCommandRead});
+}
+}        // namespace subpasses
+}        // namespace rendering
+}        // namespace vkb
@@ -42,7 +42,14 @@ void LightingSubpass::prepare()
 
 void LightingSubpass::draw(vkb::core::CommandBufferC &command_buffer)
 {
-	allocate_lights<DeferredLights>(scene.get_components<sg::Light>(), MAX_DEFERRED_LIGHT_COUNT);
+	if (is_clustered_lighting_enabled())
+	{
+		allocate_clustered_lights<DeferredLights>(scene.get_components<sg::Light>(), MAX_DEFERRED_LIGHT_COUNT, camera);
+	}
+	else
+	{
+		allocate_lights<DeferredLights>(scene.get_components<sg::Light>(), MAX_DEFERRED_LIGHT_COUNT);
+	}
 	command_buffer.bind_lighting(get_lighting_state(), 0, 4);
 
 	// Get shaders from cache
@@ -22,7 +22,7 @@
 #include "rendering/subpass.h"
 #include "scene_graph/scene.h"
 
-// This value is per type of light that we feed into the shader
+// This value is per type of light that we feed into the shader, with clustered lighting it only limits the directional lights
 #define MAX_DEFERRED_LIGHT_COUNT 48
 
 namespace vkb
@@ -1,4 +1,4 @@
-/* Copyright (c) 2019-2024, Arm Limited and Contributors
+/* Copyright (c) 2019-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -17,124 +17,176 @@
 
 #include "resource_binding_state.h"
 
+#include <bit>
+
 namespace vkb
 {
 void ResourceBindingState::reset()
 {
-	clear_dirty();
+	for (uint32_t sets = bound_sets; sets != 0; sets &= sets - 1)
+	{
+		resource_sets[std::countr_zero(sets)].reset();
+	}
 
-	resource_sets.clear();
+	bound_sets = 0;
+	dirty_sets = 0;
 }
 
-bool ResourceBindingState::is_dirty()
+bool ResourceBindingState::is_dirty() const
 {
-	return dirty;
+	return dirty_sets != 0;
 }
 
 void ResourceBindingState::clear_dirty()
 {
-	dirty = false;
+	for (uint32_t sets = dirty_sets; sets != 0; sets &= sets - 1)
+	{
+		resource_sets[std::countr_zero(sets)].clear_dirty();
+	}
+
+	dirty_sets = 0;
 }
 
 void ResourceBindingState::clear_dirty(uint32_t set)
 {
+	assert(set < MAX_SETS);
+
 	resource_sets[set].clear_dirty();
+
+	dirty_sets &= ~(1u << set);
 }
 
 void ResourceBindingState::bind_buffer(const vkb::core::BufferC &buffer, VkDeviceSize offset, VkDeviceSize range, uint32_t set, uint32_t binding, uint32_t array_element)
 {
-	resource_sets[set].bind_buffer(buffer, offset, range, binding, array_element);
-
-	dirty = true;
+	get_bound_set(set).bind_buffer(buffer, offset, range, binding, array_element);
 }
 
 void ResourceBindingState::bind_image(const core::ImageView &image_view, const core::Sampler &sampler, uint32_t set, uint32_t binding, uint32_t array_element)
 {
-	resource_sets[set].bind_image(image_view, sampler, binding, array_element);
-
-	dirty = true;
+	get_bound_set(set).bind_image(image_view, sampler, binding, array_element);
 }
 
 void ResourceBindingState::bind_image(const core::ImageView &image_view, uint32_t set, uint32_t binding, uint32_t array_element)
 {
-	resource_sets[set].bind_image(image_view, binding, array_element);
-
-	dirty = true;
+	get_bound_set(set).bind_image(image_view, binding, array_element);
 }
 
 void ResourceBindingState::bind_input(const core::ImageView &image_view, uint32_t set, uint32_t binding, uint32_t array_element)
 {
-	resource_sets[set].bind_input(image_view, binding, array_element);
+	get_bound_set(set).bind_input(image_view, binding, array_element);
+}
 
-	dirty = true;
+uint32_t ResourceBindingState::get_bound_sets() const
+{
+	return bound_sets;
 }
 
-const std::unordered_map<uint32_t, ResourceSet> &ResourceBindingState::get_resource_sets()
+uint32_t ResourceBindingState::get_dirty_sets() const
 {
-	return resource_sets;
+	return dirty_sets;
 }
 
-void ResourceSet::reset()
+const ResourceSet &ResourceBindingState::get_resource_set(uint32_t set) const
+{
+	assert(set < MAX_SETS);
+	return resource_sets[set];
+}
+
+ResourceSet &ResourceBindingState::get_bound_set(uint32_t set)
 {
-	clear_dirty();
+	if (set >= MAX_SETS)
+	{
+		throw std::runtime_error{fmt::format("Descriptor set {} exceeds the maximum of {} resource sets", set, MAX_SETS)};
+	}
 
-	resource_bindings.clear();
+	bound_sets |= 1u << set;
+	dirty_sets |= 1u << set;
+
+	return resource_sets[set];
 }
 
-bool ResourceSet::is_dirty() const
+void ResourceSet::reset()
 {
-	return dirty;
+	// Clearing keeps the capacity of the array elements for the next bindings
+	for (uint32_t bindings = bound_bindings; bindings != 0; bindings &= bindings - 1)
+	{
+		resource_bindings[std::countr_zero(bindings)].clear();
+	}
+
+	bound_bindings = 0;
+	dirty_bindings = 0;
 }
 
-void ResourceSet::clear_dirty()
+bool ResourceSet::is_dirty() const
 {
-	dirty = false;
+	return dirty_bindings != 0;
 }
 
-void ResourceSet::clear_dirty(uint32_t binding, uint32_t array_element)
+void ResourceSet::clear_dirty()
 {
-	resource_bindings[binding][array_element].dirty = false;
+	dirty_bindings = 0;
 }
 
 void ResourceSet::bind_buffer(const vkb::core::BufferC &buffer, VkDeviceSize offset, VkDeviceSize range, uint32_t binding, uint32_t array_element)
 {
-	resource_bindings[binding][array_element].dirty  = true;
-	resource_bindings[binding][array_element].buffer = &buffer;
-	resource_bindings[binding][array_element].offset = offset;
-	resource_bindings[binding][array_element].range  = range;
-
-	dirty = true;
+	auto &resource_info  = get_resource_info(binding, array_element);
+	resource_info.buffer = &buffer;
+	resource_info.offset = offset;
+	resource_info.range  = range;
 }
 
 void ResourceSet::bind_image(const core::ImageView &image_view, const core::Sampler &sampler, uint32_t binding, uint32_t array_element)
 {
-	resource_bindings[binding][array_element].dirty      = true;
-	resource_bindings[binding][array_element].image_view = &image_view;
-	resource_bindings[binding][array_element].sampler    = &sampler;
-
-	dirty = true;
+	auto &resource_info      = get_resource_info(binding, array_element);
+	resource_info.image_view = &image_view;
+	resource_info.sampler    = &sampler;
 }
 
 void ResourceSet::bind_image(const core::ImageView &image_view, uint32_t binding, uint32_t array_element)
 {
-	resource_bindings[binding][array_element].dirty      = true;
-	resource_bindings[binding][array_element].image_view = &image_view;
-	resource_bindings[binding][array_element].sampler    = nullptr;
-
-	dirty = true;
+	auto &resource_info      = get_resource_info(binding, array_element);
+	resource_info.image_view = &image_view;
+	resource_info.sampler    = nullptr;
 }
 
 void ResourceSet::bind_input(const core::ImageView &image_view, const uint32_t binding, const uint32_t array_element)
 {
-	resource_bindings[binding][array_element].dirty      = true;
-	resource_bindings[binding][array_element].image_view = &image_view;
+	auto &resource_info      = get_resource_info(binding, array_element);
+	resource_info.image_view = &image_view;
+}
+
+uint32_t ResourceSet::get_bound_bindings() const
+{
+	return bound_bindings;
+}
 
-	dirty = true;
+uint32_t ResourceSet::get_dirty_bindings() const
+{
+	return dirty_bindings;
 }
 
-const BindingMap<ResourceInfo> &ResourceSet::get_resource_bindings() const
+const std::vector<ResourceInfo> &ResourceSet::get_binding_resources(uint32_t binding) const
 {
-	return resource_bindings;
+	assert(binding < MAX_BINDINGS);
+	return resource_bindings[binding];
 }
 
+ResourceInfo &ResourceSet::get_resource_info(uint32_t binding, uint32_t array_element)
+{
+	if (binding >= MAX_BINDINGS)
+	{
+		throw std::runtime_error{fmt::format("Binding {} exceeds the maximum of {} bindings per resource set", binding, MAX_BINDINGS)};
+	}
+
+	auto &binding_resources = resource_bindings[binding];
+	if (binding_resources.size() <= array_element)
+	{
+		binding_resources.resize(array_element + 1);
+	}
+
+	bound_bindings |= 1u << binding;
+	dirty_bindings |= 1u << binding;
+
+	return binding_resources[array_element];
+}
 }        // namespace vkb
@@ -1,4 +1,4 @@
-/* Copyright (c) 2019-2025, Arm Limited and Contributors
+/* Copyright (c) 2019-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <array>
+
 #include "common/vk_common.h"
 #include "core/buffer.h"
 
@@ -36,11 +38,10 @@ class Sampler;
  * @brief A resource info is a struct containing the actual resource data.
  *
  * This will be referenced by a buffer info or image info descriptor inside a descriptor set.
+ * An array element that was never bound has neither a buffer nor an image view.
  */
 struct ResourceInfo
 {
-	bool dirty{false};
-
 	const vkb::core::BufferC *buffer{nullptr};
 
 	VkDeviceSize offset{0};
@@ -56,19 +57,20 @@ struct ResourceInfo
  * @brief A resource set is a set of bindings containing resources that were bound
  *        by a command buffer.
  *
- * The ResourceSet has a one to one mapping with a DescriptorSet.
+ * The ResourceSet has a one to one mapping with a DescriptorSet. Bindings are indexed directly, with one bit per
+ * binding in the bound and dirty masks, and the storage of their array elements is kept across resets.
  */
 class ResourceSet
 {
   public:
+	static constexpr uint32_t MAX_BINDINGS = 32;
+
 	void reset();
 
 	bool is_dirty() const;
 
 	void clear_dirty();
 
-	void clear_dirty(uint32_t binding, uint32_t array_element);
-
 	void bind_buffer(const vkb::core::BufferC &buffer, VkDeviceSize offset, VkDeviceSize range, uint32_t binding, uint32_t array_element);
 
 	void bind_image(const core::ImageView &image_view, const core::Sampler &sampler, uint32_t binding, uint32_t array_element);
@@ -77,12 +79,30 @@ class ResourceSet
 
 	void bind_input(const core::ImageView &image_view, uint32_t binding, uint32_t array_element);
 
-	const BindingMap<ResourceInfo> &get_resource_bindings() const;
+	/**
+	 * @return A mask with a bit set for each binding that has resources bound
+	 */
+	uint32_t get_bound_bindings() const;
+
+	/**
+	 * @return A mask with a bit set for each binding changed since the dirty flags were last cleared
+	 */
+	uint32_t get_dirty_bindings() const;
+
+	/**
+	 * @return The resources of a binding, indexed by array element
+	 */
+	const std::vector<ResourceInfo> &get_binding_resources(uint32_t binding) const;
+
+  private:
+	ResourceInfo &get_resource_info(uint32_t binding, uint32_t array_element);
 
   private:
-	bool dirty{false};
+	uint32_t bound_bindings{0};
 
-	BindingMap<ResourceInfo> resource_bindings;
+	uint32_t dirty_bindings{0};
+
+	std::array<std::vector<ResourceInfo>, MAX_BINDINGS> resource_bindings;
 };
 
 /**
@@ -94,9 +114,11 @@ class ResourceSet
 class ResourceBindingState
 {
   public:
+	static constexpr uint32_t MAX_SETS = 8;
+
 	void reset();
 
-	bool is_dirty();
+	bool is_dirty() const;
 
 	void clear_dirty();
 
@@ -110,11 +132,26 @@ class ResourceBindingState
 
 	void bind_input(const core::ImageView &image_view, uint32_t set, uint32_t binding, uint32_t array_element);
 
-	const std::unordered_map<uint32_t, ResourceSet> &get_resource_sets();
+	/**
+	 * @return A mask with a bit set for each set that has resources bound
+	 */
+	uint32_t get_bound_sets() const;
+
+	/**
+	 * @return A mask with a bit set for each set changed since its dirty flags were last cleared
+	 */
+	uint32_t get_dirty_sets() const;
+
+	const ResourceSet &get_resource_set(uint32_t set) const;
+
+  private:
+	ResourceSet &get_bound_set(uint32_t set);
 
   private:
-	bool dirty{false};
+	uint32_t bound_sets{0};
+
+	uint32_t dirty_sets{0};
 
-	std::unordered_map<uint32_t, ResourceSet> resource_sets;
+	std::array<ResourceSet, MAX_SETS> resource_sets;
 };
 }        // namespace vkb
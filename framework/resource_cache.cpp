@@ -17,6 +17,8 @@
 
 #include "resource_cache.h"
 
+#include <cstring>
+
 #include "common/resource_caching.h"
 #include "core/device.h"
 
@@ -24,10 +26,71 @@ namespace vkb
 {
 namespace
 {
+constexpr uint32_t resource_cache_file_magic{0x43524B56};        // "VKRC"
+
+// Increment whenever the layout of the header or of the ResourceRecord stream changes
+constexpr uint32_t resource_cache_file_version{1};
+
+/**
+ * @brief Header of a resource cache file, followed by the ResourceRecord stream
+ */
+struct ResourceCacheFileHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t vendor_id;
+	uint32_t device_id;
+	uint32_t driver_version;
+	uint8_t  pipeline_cache_uuid[VK_UUID_SIZE];
+	uint64_t resource_count;
+	uint64_t payload_size;
+	uint64_t payload_hash;
+};
+
+uint64_t hash_payload(const uint8_t *data, size_t size)
+{
+	// FNV-1a, stable across runs and platforms
+	uint64_t hash = 0xcbf29ce484222325ull;
+	for (size_t i = 0; i < size; ++i)
+	{
+		hash = (hash ^ data[i]) * 0x100000001b3ull;
+	}
+	return hash;
+}
+
+ResourceCacheFileHeader make_header(const vkb::core::DeviceC &device)
+{
+	auto &properties = device.get_gpu().get_properties();
+
+	ResourceCacheFileHeader header{};
+	header.magic          = resource_cache_file_magic;
+	header.version        = resource_cache_file_version;
+	header.vendor_id      = properties.vendorID;
+	header.device_id      = properties.deviceID;
+	header.driver_version = properties.driverVersion;
+	std::memcpy(header.pipeline_cache_uuid, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+	return header;
+}
+
 template <class T, class... A>
-T &request_resource(vkb::core::DeviceC &device, ResourceRecord &recorder, std::mutex &resource_mutex, std::unordered_map<std::size_t, T> &resources, A &...args)
+T &request_resource(vkb::core::DeviceC &device, ResourceRecord &recorder, std::shared_mutex &resource_mutex, std::unordered_map<std::size_t, T> &resources, A &...args)
 {
-	std::lock_guard<std::mutex> guard(resource_mutex);
+	std::size_t hash{0U};
+	hash_param(hash, args...);
+
+	{
+		// Cache hits only take a shared lock, so threads looking up existing resources never wait on each other
+		std::shared_lock<std::shared_mutex> guard(resource_mutex);
+
+		if (auto resource = find_resource(resources, hash, args...))
+		{
+			return *resource;
+		}
+	}
+
+	// On a miss another thread may have created the resource in the meantime, so look it up again under the exclusive lock
+	std::lock_guard<std::shared_mutex> guard(resource_mutex);
 
 	auto &res = request_resource(device, &recorder, resources, args...);
 
@@ -42,9 +105,8 @@ ResourceCache::ResourceCache(vkb::core::DeviceC &device) :
 
 void ResourceCache::warmup(const std::vector<uint8_t> &data)
 {
-	recorder.set_data(data);
-
-	replayer.play(*this, recorder);
+	// Replayed resources are recorded again as they are created, so the recorder only ever holds valid entries
+	replayer.play(*this, data);
 }
 
 std::vector<uint8_t> ResourceCache::serialize()
@@ -52,6 +114,74 @@ std::vector<uint8_t> ResourceCache::serialize()
 	return recorder.get_data();
 }
 
+ResourceReplayStats ResourceCache::load(const vkb::filesystem::Path &path)
+{
+	auto fs = vkb::filesystem::get();
+
+	if (!fs->is_file(path))
+	{
+		LOGI("No resource cache found at {}", path.string());
+		return {};
+	}
+
+	auto data = fs->read_file_binary(path);
+
+	ResourceCacheFileHeader header{};
+	if (data.size() < sizeof(header))
+	{
+		LOGW("Resource cache {} is truncated, ignoring it", path.string());
+		return {};
+	}
+	std::memcpy(&header, data.data(), sizeof(header));
+
+	if (header.magic != resource_cache_file_magic || header.version != resource_cache_file_version)
+	{
+		LOGW("Resource cache {} has an unsupported format, ignoring it", path.string());
+		return {};
+	}
+
+	ResourceReplayStats stats{};
+	stats.rejected = to_u32(header.resource_count);
+
+	auto expected = make_header(device);
+	if (header.vendor_id != expected.vendor_id || header.device_id != expected.device_id || header.driver_version != expected.driver_version ||
+	    std::memcmp(header.pipeline_cache_uuid, expected.pipeline_cache_uuid, VK_UUID_SIZE) != 0)
+	{
+		LOGW("Resource cache {} was written for a different device or driver, rejected {} entries", path.string(), stats.rejected);
+		return stats;
+	}
+
+	const uint8_t *payload = data.data() + sizeof(header);
+	if (header.payload_size != data.size() - sizeof(header) || header.payload_hash != hash_payload(payload, data.size() - sizeof(header)))
+	{
+		LOGW("Resource cache {} is corrupted, rejected {} entries", path.string(), stats.rejected);
+		return stats;
+	}
+
+	warmup(std::vector<uint8_t>{payload, payload + header.payload_size});
+
+	stats = replayer.get_stats();
+	LOGI("Resource cache {}: {} entries reused, {} rejected", path.string(), stats.reused, stats.rejected);
+
+	return stats;
+}
+
+void ResourceCache::save(const vkb::filesystem::Path &path)
+{
+	auto payload = recorder.get_data();
+
+	auto header           = make_header(device);
+	header.resource_count = recorder.get_resource_count();
+	header.payload_size   = payload.size();
+	header.payload_hash   = hash_payload(payload.data(), payload.size());
+
+	std::vector<uint8_t> data(sizeof(header) + payload.size());
+	std::memcpy(data.data(), &header, sizeof(header));
+	std::ranges::copy(payload, data.begin() + sizeof(header));
+
+	vkb::filesystem::get()->write_file(path, data);
+}
+
 void ResourceCache::set_pipeline_cache(VkPipelineCache new_pipeline_cache)
 {
 	pipeline_cache = new_pipeline_cache;
@@ -175,20 +305,26 @@ void ResourceCache::update_descriptor_sets(const std::vector<core::ImageView> &o
 		                       0, nullptr);
 	}
 
-	// Delete old entries (moved out descriptor sets)
-	for (auto &match : matches)
+	// Move the updated sets out of the cache, along with the sets probed past them: a lookup stops at the first free
+	// key, so these could no longer be found once the updated sets are erased
+	std::vector<DescriptorSet> moved_sets;
+	for (auto match : matches)
 	{
-		// Move out of the map
-		auto it             = state.descriptor_sets.find(match);
-		auto descriptor_set = std::move(it->second);
-		state.descriptor_sets.erase(match);
+		for (auto it = state.descriptor_sets.find(match); it != state.descriptor_sets.end(); it = state.descriptor_sets.find(++match))
+		{
+			moved_sets.push_back(std::move(it->second));
+			state.descriptor_sets.erase(it);
+		}
+	}
 
-		// Generate new key
+	// Cache them again under the hash request_descriptor_set computes from their parameters. A set equal to one already
+	// cached is kept after it in the probe sequence, since command buffers may still refer to it
+	for (auto &descriptor_set : moved_sets)
+	{
 		size_t new_key = 0U;
-		hash_param(new_key, descriptor_set.get_layout(), descriptor_set.get_buffer_infos(), descriptor_set.get_image_infos());
+		hash_param(new_key, descriptor_set.get_layout(), descriptor_set.get_descriptor_pool(), descriptor_set.get_buffer_infos(), descriptor_set.get_image_infos());
 
-		// Add (key, resource) to the cache
-		state.descriptor_sets.emplace(new_key, std::move(descriptor_set));
+		insert_resource(state.descriptor_sets, new_key, std::move(descriptor_set));
 	}
 }
 
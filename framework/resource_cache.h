@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -27,6 +28,7 @@
 #include "core/descriptor_set_layout.h"
 #include "core/framebuffer.h"
 #include "core/pipeline.h"
+#include "filesystem/filesystem.hpp"
 #include "resource_record.h"
 #include "resource_replay.h"
 
@@ -95,6 +97,21 @@ class ResourceCache
 
 	std::vector<uint8_t> serialize();
 
+	/**
+	 * @brief Warms up the cache from a file previously written by save()
+	 *        The file is rejected as a whole if it was written for a different device, driver or file format version,
+	 *        and single records are rejected if the shader they were built from changed since.
+	 * @param path The path of the cache file
+	 * @return The number of resources that were reused and rejected
+	 */
+	ResourceReplayStats load(const vkb::filesystem::Path &path);
+
+	/**
+	 * @brief Writes all resources recorded so far to a versioned cache file, tagged with the current device and driver
+	 * @param path The path of the cache file
+	 */
+	void save(const vkb::filesystem::Path &path);
+
 	void set_pipeline_cache(VkPipelineCache pipeline_cache);
 
 	ShaderModule &request_shader_module(VkShaderStageFlagBits stage, const ShaderSource &glsl_source, const ShaderVariant &shader_variant = {});
@@ -144,20 +161,20 @@ class ResourceCache
 
 	ResourceCacheState state;
 
-	std::mutex descriptor_set_mutex;
+	std::shared_mutex descriptor_set_mutex;
 
-	std::mutex pipeline_layout_mutex;
+	std::shared_mutex pipeline_layout_mutex;
 
-	std::mutex shader_module_mutex;
+	std::shared_mutex shader_module_mutex;
 
-	std::mutex descriptor_set_layout_mutex;
+	std::shared_mutex descriptor_set_layout_mutex;
 
-	std::mutex graphics_pipeline_mutex;
+	std::shared_mutex graphics_pipeline_mutex;
 
-	std::mutex render_pass_mutex;
+	std::shared_mutex render_pass_mutex;
 
-	std::mutex compute_pipeline_mutex;
+	std::shared_mutex compute_pipeline_mutex;
 
-	std::mutex framebuffer_mutex;
+	std::shared_mutex framebuffer_mutex;
 };
 }        // namespace vkb
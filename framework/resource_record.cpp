@@ -55,11 +55,26 @@ const std::ostringstream &ResourceRecord::get_stream()
 	return stream;
 }
 
+size_t ResourceRecord::get_resource_count() const
+{
+	return shader_module_indices.size() + pipeline_layout_indices.size() + render_pass_indices.size() + graphics_pipeline_indices.size();
+}
+
 size_t ResourceRecord::register_shader_module(VkShaderStageFlagBits stage, const ShaderSource &glsl_source, const std::string &entry_point, const ShaderVariant &shader_variant)
 {
 	shader_module_indices.push_back(shader_module_indices.size());
 
-	write(stream, ResourceType::ShaderModule, stage, glsl_source.get_source(), entry_point);
+	// Runtime array sizes are written in a stable order so that identical variants produce identical records
+	std::map<std::string, size_t> runtime_array_sizes{shader_variant.get_runtime_array_sizes().begin(),
+	                                                  shader_variant.get_runtime_array_sizes().end()};
+
+	write(stream,
+	      ResourceType::ShaderModule,
+	      stage,
+	      glsl_source.get_filename(),
+	      glsl_source.get_id(),
+	      entry_point,
+	      runtime_array_sizes);
 
 	return shader_module_indices.back();
 }
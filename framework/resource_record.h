@@ -55,6 +55,11 @@ class ResourceRecord
 
 	const std::ostringstream &get_stream();
 
+	/**
+	 * @brief Returns the number of resources registered in the stream
+	 */
+	size_t get_resource_count() const;
+
 	size_t register_shader_module(VkShaderStageFlagBits stage,
 	                              const ShaderSource   &glsl_source,
 	                              const std::string    &entry_point,
@@ -48,9 +48,15 @@ ResourceReplay::ResourceReplay()
 	stream_resources[ResourceType::GraphicsPipeline] = std::bind(&ResourceReplay::create_graphics_pipeline, this, std::placeholders::_1, std::placeholders::_2);
 }
 
-void ResourceReplay::play(ResourceCache &resource_cache, ResourceRecord &recorder)
+void ResourceReplay::play(ResourceCache &resource_cache, const std::vector<uint8_t> &data)
 {
-	std::istringstream stream{recorder.get_stream().str()};
+	std::istringstream stream{std::string{data.begin(), data.end()}};
+
+	shader_modules.clear();
+	pipeline_layouts.clear();
+	render_passes.clear();
+	graphics_pipelines.clear();
+	stats = {};
 
 	while (true)
 	{
@@ -75,28 +81,62 @@ void ResourceReplay::play(ResourceCache &resource_cache, ResourceRecord &recorde
 		else
 		{
 			LOGE("Replay command not supported.");
+			break;
+		}
+
+		if (stream.fail())
+		{
+			LOGE("Replay stream is truncated.");
+			break;
 		}
 	}
 }
 
+const ResourceReplayStats &ResourceReplay::get_stats() const
+{
+	return stats;
+}
+
 void ResourceReplay::create_shader_module(ResourceCache &resource_cache, std::istringstream &stream)
 {
-	VkShaderStageFlagBits stage{};
-	std::string           glsl_source;
-	std::string           entry_point;
+	VkShaderStageFlagBits         stage{};
+	std::string                   filename;
+	size_t                        source_id{};
+	std::string                   entry_point;
+	std::map<std::string, size_t> runtime_array_sizes;
 
 	read(stream,
 	     stage,
-	     glsl_source,
-	     entry_point);
+	     filename,
+	     source_id,
+	     entry_point,
+	     runtime_array_sizes);
+
+	// Skip the module if its source is gone or has changed since it was recorded
+	std::unique_ptr<ShaderSource> shader_source;
+	try
+	{
+		shader_source = std::make_unique<ShaderSource>(filename);
+	}
+	catch (const std::exception &e)
+	{
+		LOGW("Replay could not read shader \"{}\": {}", filename, e.what());
+	}
+
+	if (!shader_source || shader_source->get_id() != source_id)
+	{
+		shader_modules.push_back(nullptr);
+		stats.rejected++;
+		return;
+	}
 
-	ShaderSource shader_source{};
-	shader_source.set_source(std::move(glsl_source));
 	ShaderVariant shader_variant;
+	shader_variant.set_runtime_array_sizes({runtime_array_sizes.begin(), runtime_array_sizes.end()});
 
-	auto &shader_module = resource_cache.request_shader_module(stage, shader_source, shader_variant);
+	auto &shader_module = resource_cache.request_shader_module(stage, *shader_source, shader_variant);
 
 	shader_modules.push_back(&shader_module);
+	stats.reused++;
 }
 
 void ResourceReplay::create_pipeline_layout(ResourceCache &resource_cache, std::istringstream &stream)
@@ -111,13 +151,20 @@ void ResourceReplay::create_pipeline_layout(ResourceCache &resource_cache, std::
 	               shader_indices.end(),
 	               shader_stages.begin(),
 	               [&](size_t shader_index) {
-		               assert(shader_index < shader_modules.size());
-		               return shader_modules[shader_index];
+		               return shader_index < shader_modules.size() ? shader_modules[shader_index] : nullptr;
 	               });
 
+	if (std::ranges::find(shader_stages, nullptr) != shader_stages.end())
+	{
+		pipeline_layouts.push_back(nullptr);
+		stats.rejected++;
+		return;
+	}
+
 	auto &pipeline_layout = resource_cache.request_pipeline_layout(shader_stages);
 
 	pipeline_layouts.push_back(&pipeline_layout);
+	stats.reused++;
 }
 
 void ResourceReplay::create_render_pass(ResourceCache &resource_cache, std::istringstream &stream)
@@ -135,6 +182,7 @@ void ResourceReplay::create_render_pass(ResourceCache &resource_cache, std::istr
 	auto &render_pass = resource_cache.request_render_pass(attachments, load_store_infos, subpasses);
 
 	render_passes.push_back(&render_pass);
+	stats.reused++;
 }
 
 void ResourceReplay::create_graphics_pipeline(ResourceCache &resource_cache, std::istringstream &stream)
@@ -178,10 +226,17 @@ void ResourceReplay::create_graphics_pipeline(ResourceCache &resource_cache, std
 	     color_blend_state.logic_op_enable,
 	     color_blend_state.attachments);
 
+	// Skip the pipeline if any of its dependencies were rejected
+	if (pipeline_layout_index >= pipeline_layouts.size() || !pipeline_layouts[pipeline_layout_index] ||
+	    render_pass_index >= render_passes.size())
+	{
+		graphics_pipelines.push_back(nullptr);
+		stats.rejected++;
+		return;
+	}
+
 	PipelineState pipeline_state{};
-	assert(pipeline_layout_index < pipeline_layouts.size());
 	pipeline_state.set_pipeline_layout(*pipeline_layouts[pipeline_layout_index]);
-	assert(render_pass_index < render_passes.size());
 	pipeline_state.set_render_pass(*render_passes[render_pass_index]);
 
 	for (auto &item : specialization_constant_state)
@@ -201,5 +256,6 @@ void ResourceReplay::create_graphics_pipeline(ResourceCache &resource_cache, std
 	auto &graphics_pipeline = resource_cache.request_graphics_pipeline(pipeline_state);
 
 	graphics_pipelines.push_back(&graphics_pipeline);
+	stats.reused++;
 }
 }        // namespace vkb
@@ -25,6 +25,18 @@ namespace vkb
 {
 class ResourceCache;
 
+/**
+ * @brief Number of recorded resources recreated or skipped by a replay
+ */
+struct ResourceReplayStats
+{
+	/// Resources that were recreated from the stream
+	uint32_t reused{0};
+
+	/// Resources that were skipped because their sources changed or a dependency was skipped
+	uint32_t rejected{0};
+};
+
 /**
  * @brief Reads Vulkan objects from a memory stream and creates them in the resource cache.
  */
@@ -33,7 +45,9 @@ class ResourceReplay
   public:
 	ResourceReplay();
 
-	void play(ResourceCache &resource_cache, ResourceRecord &recorder);
+	void play(ResourceCache &resource_cache, const std::vector<uint8_t> &data);
+
+	const ResourceReplayStats &get_stats() const;
 
   protected:
 	void create_shader_module(ResourceCache &resource_cache, std::istringstream &stream);
@@ -56,5 +70,7 @@ class ResourceReplay
 	std::vector<const RenderPass *> render_passes;
 
 	std::vector<const GraphicsPipeline *> graphics_pipelines;
+
+	ResourceReplayStats stats;
 };
 }        // namespace vkb
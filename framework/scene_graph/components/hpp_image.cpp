@@ -19,10 +19,10 @@
 
 #include "common/hpp_utils.h"
 #include "filesystem/legacy.h"
+#include "scene_graph/components/image.h"
 #include "scene_graph/components/image/astc.h"
 #include "scene_graph/components/image/ktx.h"
 #include "scene_graph/components/image/stb.h"
-#include <stb_image_resize.h>
 #include <vulkan/vulkan.hpp>
 #include <vulkan/vulkan_format_traits.hpp>
 
@@ -51,7 +51,8 @@ std::unique_ptr<vkb::scene_graph::components::HPPImage> HPPImage::load(const std
 {
 	std::unique_ptr<vkb::scene_graph::components::HPPImage> image{nullptr};
 
-	auto data = fs::read_asset(uri);
+	auto file = fs::map_asset(uri);
+	auto data = file.span();
 
 	// Get extension
 	auto extension = get_extension(uri);
@@ -229,40 +230,13 @@ void HPPImage::generate_mipmaps()
 		return;        // Do not generate again
 	}
 
-	auto extent      = get_extent();
-	auto next_width  = std::max<uint32_t>(1u, extent.width / 2);
-	auto next_height = std::max<uint32_t>(1u, extent.height / 2);
-	auto channels    = 4;
-	auto next_size   = next_width * next_height * channels;
+	// Share the box filter of vkb::sg::Image, which handles sRGB and half float formats
+	std::vector<vkb::sg::Mipmap> chain{{mipmaps[0].level, mipmaps[0].offset, static_cast<VkExtent3D>(mipmaps[0].extent)}};
+	vkb::sg::generate_mip_chain(static_cast<VkFormat>(format), data, chain);
 
-	while (true)
+	for (auto it = chain.begin() + 1; it != chain.end(); ++it)
 	{
-		// Make space for next mipmap
-		auto old_size = to_u32(data.size());
-		data.resize(old_size + next_size);
-
-		auto &prev_mipmap = mipmaps.back();
-		// Update mipmaps
-		vkb::scene_graph::components::HPPMipmap next_mipmap{};
-		next_mipmap.level  = prev_mipmap.level + 1;
-		next_mipmap.offset = old_size;
-		next_mipmap.extent = vk::Extent3D{next_width, next_height, 1u};
-
-		// Fill next mipmap memory
-		stbir_resize_uint8(data.data() + prev_mipmap.offset, prev_mipmap.extent.width, prev_mipmap.extent.height, 0,
-		                   data.data() + next_mipmap.offset, next_mipmap.extent.width, next_mipmap.extent.height, 0, channels);
-
-		mipmaps.emplace_back(std::move(next_mipmap));
-
-		// Next mipmap values
-		next_width  = std::max<uint32_t>(1u, next_width / 2);
-		next_height = std::max<uint32_t>(1u, next_height / 2);
-		next_size   = next_width * next_height * channels;
-
-		if (next_width == 1 && next_height == 1)
-		{
-			break;
-		}
+		mipmaps.push_back({it->level, it->offset, vk::Extent3D{it->extent}});
 	}
 }
 
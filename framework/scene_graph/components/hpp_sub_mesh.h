@@ -46,6 +46,7 @@ class HPPSubMesh : private vkb::sg::SubMesh
 	using vkb::sg::SubMesh::get_index_offset;
 	using vkb::sg::SubMesh::get_vertex_indices;
 	using vkb::sg::SubMesh::get_vertices_count;
+	using vkb::sg::SubMesh::is_deformable;
 
 	bool get_attribute(const std::string &name, HPPVertexAttribute &attribute) const
 	{
@@ -84,8 +85,7 @@ class HPPSubMesh : private vkb::sg::SubMesh
 
 	vkb::core::BufferCpp const *find_vertex_buffer(std::string const &name) const
 	{
-		auto it = vkb::sg::SubMesh::vertex_buffers.find(name);
-		return it != vkb::sg::SubMesh::vertex_buffers.end() ? reinterpret_cast<vkb::core::BufferCpp const *>(&it->second) : nullptr;
+		return reinterpret_cast<vkb::core::BufferCpp const *>(vkb::sg::SubMesh::find_vertex_buffer(name));
 	}
 };
 }        // namespace components
@@ -1,4 +1,4 @@
-/* Copyright (c) 2018-2025, Arm Limited and Contributors
+/* Copyright (c) 2018-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -17,20 +17,32 @@
 
 #include "image.h"
 
+#include <array>
+#include <cmath>
 #include <cstddef>
+#include <cstring>
 #include <mutex>
 
 #include "common/error.h"
 
-#define STB_IMAGE_RESIZE_IMPLEMENTATION
-#include <stb_image_resize.h>
+#include <glm/gtc/packing.hpp>
 
+#include "common/job_system.h"
 #include "common/utils.h"
+#include "core/util/profiling.hpp"
 #include "filesystem/legacy.h"
 #include "scene_graph/components/image/astc.h"
 #include "scene_graph/components/image/ktx.h"
 #include "scene_graph/components/image/stb.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	include <emmintrin.h>
+#	define VKB_MIPMAP_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#	include <arm_neon.h>
+#	define VKB_MIPMAP_NEON
+#endif
+
 namespace vkb
 {
 namespace sg
@@ -241,72 +253,246 @@ Mipmap &Image::get_mipmap(const size_t index)
 	return mipmaps[index];
 }
 
-// Note that this function returns the required size for ALL mip levels, *including* the base level.
-uint32_t get_required_mipmaps_size(const VkExtent3D &extent)
+namespace
 {
-	constexpr uint32_t channels = 4;
-	auto               width    = std::max<uint32_t>(1, extent.width);
-	auto               height   = std::max<uint32_t>(1, extent.height);
-	auto               size     = width * height * channels;
-	auto               result   = size;
-	while (size != channels)
+// Destination rows are split in jobs of about this many texels
+constexpr size_t MIPMAP_TEXELS_PER_JOB = 16384;
+
+// Resolution of the table converting linear values back to sRGB, which is precise to one step of 8-bit sRGB
+constexpr uint32_t SRGB_ENCODE_TABLE_SIZE = 4096;
+
+enum class MipmapFilter
+{
+	Unorm8,
+	Srgb8,
+	Float16
+};
+
+MipmapFilter get_mipmap_filter(VkFormat format)
+{
+	switch (format)
 	{
-		width  = std::max<uint32_t>(1u, width >> 1);
-		height = std::max<uint32_t>(1u, height >> 1);
-		size   = width * height * channels;
-		result += size;
+		case VK_FORMAT_R8G8B8A8_SRGB:
+		case VK_FORMAT_B8G8R8A8_SRGB:
+		case VK_FORMAT_A8B8G8R8_SRGB_PACK32:
+			return MipmapFilter::Srgb8;
+		case VK_FORMAT_R16G16B16A16_SFLOAT:
+			return MipmapFilter::Float16;
+		default:
+			// Any other format is treated as four 8-bit channels
+			return MipmapFilter::Unorm8;
 	}
-	return result;
 }
 
-void Image::generate_mipmaps()
+struct SrgbTables
 {
-	assert(mipmaps.size() == 1 && "Mipmaps already generated");
+	std::array<float, 256>                      decode;
+	std::array<uint8_t, SRGB_ENCODE_TABLE_SIZE> encode;
+};
 
-	if (mipmaps.size() > 1)
+const SrgbTables &get_srgb_tables()
+{
+	static const SrgbTables tables = [] {
+		SrgbTables tables;
+		for (uint32_t i = 0; i < tables.decode.size(); ++i)
+		{
+			float value      = i / 255.0f;
+			tables.decode[i] = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+		}
+		for (uint32_t i = 0; i < tables.encode.size(); ++i)
+		{
+			float value      = i / static_cast<float>(SRGB_ENCODE_TABLE_SIZE - 1);
+			float encoded    = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+			tables.encode[i] = static_cast<uint8_t>(encoded * 255.0f + 0.5f);
+		}
+		return tables;
+	}();
+	return tables;
+}
+
+/**
+ * @brief Averages 2x2 texels of the source into one texel of the destination, for a range of destination rows.
+ *        The last column or row of a source with an odd size is clamped to.
+ */
+void downsample_unorm8(const uint8_t *src, const VkExtent3D &src_extent, uint8_t *dst, const VkExtent3D &dst_extent, size_t first_row, size_t last_row)
+{
+	for (size_t y = first_row; y < last_row; ++y)
 	{
-		return;        // Do not generate again
+		const uint8_t *row0 = src + 4 * size_t{src_extent.width} * std::min<size_t>(2 * y, src_extent.height - 1);
+		const uint8_t *row1 = src + 4 * size_t{src_extent.width} * std::min<size_t>(2 * y + 1, src_extent.height - 1);
+		uint8_t       *out  = dst + 4 * size_t{dst_extent.width} * y;
+
+		size_t x = 0;
+#if defined(VKB_MIPMAP_SSE2)
+		// Two destination texels per iteration, from four texels of each source row
+		if (1 < src_extent.width)
+		{
+			__m128i zero = _mm_setzero_si128();
+			__m128i two  = _mm_set1_epi16(2);
+			for (; x + 2 <= dst_extent.width && 2 * x + 4 <= src_extent.width; x += 2)
+			{
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + 8 * x));
+				__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + 8 * x));
+
+				// Vertical sums of the texel pairs, one destination texel per half
+				__m128i low  = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+				__m128i high = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+
+				// Horizontal sums of the texel pairs, then rounded average
+				__m128i sums = _mm_add_epi16(_mm_unpacklo_epi64(low, high), _mm_unpackhi_epi64(low, high));
+				sums         = _mm_srli_epi16(_mm_add_epi16(sums, two), 2);
+
+				_mm_storel_epi64(reinterpret_cast<__m128i *>(out + 4 * x), _mm_packus_epi16(sums, zero));
+			}
+		}
+#elif defined(VKB_MIPMAP_NEON)
+		// Two destination texels per iteration, from four texels of each source row
+		if (1 < src_extent.width)
+		{
+			for (; x + 2 <= dst_extent.width && 2 * x + 4 <= src_extent.width; x += 2)
+			{
+				uint8x16_t a = vld1q_u8(row0 + 8 * x);
+				uint8x16_t b = vld1q_u8(row1 + 8 * x);
+
+				// Vertical sums of the texel pairs, one destination texel per half
+				uint16x8_t low  = vaddl_u8(vget_low_u8(a), vget_low_u8(b));
+				uint16x8_t high = vaddl_u8(vget_high_u8(a), vget_high_u8(b));
+
+				// Horizontal sums of the texel pairs, then rounded average
+				uint16x8_t sums = vcombine_u16(vadd_u16(vget_low_u16(low), vget_high_u16(low)), vadd_u16(vget_low_u16(high), vget_high_u16(high)));
+
+				vst1_u8(out + 4 * x, vrshrn_n_u16(sums, 2));
+			}
+		}
+#endif
+		for (; x < dst_extent.width; ++x)
+		{
+			size_t x0 = 4 * std::min<size_t>(2 * x, src_extent.width - 1);
+			size_t x1 = 4 * std::min<size_t>(2 * x + 1, src_extent.width - 1);
+			for (size_t c = 0; c < 4; ++c)
+			{
+				out[4 * x + c] = static_cast<uint8_t>((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+			}
+		}
 	}
+}
 
-	auto extent      = get_extent();
-	auto next_width  = std::max<uint32_t>(1u, extent.width / 2);
-	auto next_height = std::max<uint32_t>(1u, extent.height / 2);
-	auto channels    = 4;
-	auto next_size   = next_width * next_height * channels;
+/**
+ * @brief Averages 2x2 texels in linear space, the alpha channel is not sRGB encoded
+ */
+void downsample_srgb8(const uint8_t *src, const VkExtent3D &src_extent, uint8_t *dst, const VkExtent3D &dst_extent, size_t first_row, size_t last_row)
+{
+	auto const &tables = get_srgb_tables();
 
-	// Allocate for all the mips at once.  The function returns the total size needed for the
-	// existing base mip as well as all the mips that will be generated.
-	data.reserve(get_required_mipmaps_size(extent));
+	for (size_t y = first_row; y < last_row; ++y)
+	{
+		const uint8_t *row0 = src + 4 * size_t{src_extent.width} * std::min<size_t>(2 * y, src_extent.height - 1);
+		const uint8_t *row1 = src + 4 * size_t{src_extent.width} * std::min<size_t>(2 * y + 1, src_extent.height - 1);
+		uint8_t       *out  = dst + 4 * size_t{dst_extent.width} * y;
 
-	while (true)
+		for (size_t x = 0; x < dst_extent.width; ++x)
+		{
+			size_t x0 = 4 * std::min<size_t>(2 * x, src_extent.width - 1);
+			size_t x1 = 4 * std::min<size_t>(2 * x + 1, src_extent.width - 1);
+			for (size_t c = 0; c < 3; ++c)
+			{
+				float linear   = 0.25f * (tables.decode[row0[x0 + c]] + tables.decode[row0[x1 + c]] + tables.decode[row1[x0 + c]] + tables.decode[row1[x1 + c]]);
+				out[4 * x + c] = tables.encode[static_cast<size_t>(linear * (SRGB_ENCODE_TABLE_SIZE - 1) + 0.5f)];
+			}
+			out[4 * x + 3] = static_cast<uint8_t>((row0[x0 + 3] + row0[x1 + 3] + row1[x0 + 3] + row1[x1 + 3] + 2) >> 2);
+		}
+	}
+}
+
+void downsample_float16(const uint8_t *src, const VkExtent3D &src_extent, uint8_t *dst, const VkExtent3D &dst_extent, size_t first_row, size_t last_row)
+{
+	auto load = [](const uint8_t *texel) {
+		uint64_t packed;
+		std::memcpy(&packed, texel, sizeof(packed));
+		return glm::unpackHalf4x16(packed);
+	};
+
+	for (size_t y = first_row; y < last_row; ++y)
+	{
+		const uint8_t *row0 = src + 8 * size_t{src_extent.width} * std::min<size_t>(2 * y, src_extent.height - 1);
+		const uint8_t *row1 = src + 8 * size_t{src_extent.width} * std::min<size_t>(2 * y + 1, src_extent.height - 1);
+		uint8_t       *out  = dst + 8 * size_t{dst_extent.width} * y;
+
+		for (size_t x = 0; x < dst_extent.width; ++x)
+		{
+			size_t    x0      = 8 * std::min<size_t>(2 * x, src_extent.width - 1);
+			size_t    x1      = 8 * std::min<size_t>(2 * x + 1, src_extent.width - 1);
+			glm::vec4 average = 0.25f * (load(row0 + x0) + load(row0 + x1) + load(row1 + x0) + load(row1 + x1));
+			uint64_t  packed  = glm::packHalf4x16(average);
+			std::memcpy(out + 8 * x, &packed, sizeof(packed));
+		}
+	}
+}
+}        // namespace
+
+void generate_mip_chain(VkFormat format, std::vector<uint8_t> &data, std::vector<Mipmap> &mipmaps)
+{
+	PROFILE_SCOPE("Generate Mipmaps");
+
+	assert(!mipmaps.empty());
+
+	auto     filter     = get_mipmap_filter(format);
+	uint32_t texel_size = filter == MipmapFilter::Float16 ? 8 : 4;
+
+	// Lay out the whole chain first, so that the data is allocated once
+	auto extent = mipmaps.back().extent;
+	auto offset = to_u32(data.size());
+	while (1 < extent.width || 1 < extent.height)
 	{
-		// Make space for next mipmap
-		auto old_size = to_u32(data.size());
-		data.resize(old_size + next_size);
+		extent = {std::max<uint32_t>(1u, extent.width / 2), std::max<uint32_t>(1u, extent.height / 2), 1u};
 
-		auto &prev_mipmap = mipmaps.back();
-		// Update mipmaps
 		Mipmap next_mipmap{};
-		next_mipmap.level  = prev_mipmap.level + 1;
-		next_mipmap.offset = old_size;
-		next_mipmap.extent = {next_width, next_height, 1u};
+		next_mipmap.level  = mipmaps.back().level + 1;
+		next_mipmap.offset = offset;
+		next_mipmap.extent = extent;
+		mipmaps.push_back(next_mipmap);
 
-		// Fill next mipmap memory
-		stbir_resize_uint8(data.data() + prev_mipmap.offset, prev_mipmap.extent.width, prev_mipmap.extent.height, 0,
-		                   data.data() + next_mipmap.offset, next_mipmap.extent.width, next_mipmap.extent.height, 0, channels);
+		offset += extent.width * extent.height * texel_size;
+	}
+	data.resize(offset);
 
-		mipmaps.emplace_back(std::move(next_mipmap));
+	// Each level is read by the next one, so only the rows of a level are downsampled in parallel
+	auto &job_system = JobSystem::get();
+	for (size_t level = 1; level < mipmaps.size(); ++level)
+	{
+		auto const &src_mipmap = mipmaps[level - 1];
+		auto const &dst_mipmap = mipmaps[level];
+		auto        grain_size = std::max<size_t>(1, MIPMAP_TEXELS_PER_JOB / dst_mipmap.extent.width);
+
+		job_system.parallel_for(dst_mipmap.extent.height, grain_size, [&](size_t first_row, size_t last_row) {
+			const uint8_t *src = data.data() + src_mipmap.offset;
+			uint8_t       *dst = data.data() + dst_mipmap.offset;
+			switch (filter)
+			{
+				case MipmapFilter::Srgb8:
+					downsample_srgb8(src, src_mipmap.extent, dst, dst_mipmap.extent, first_row, last_row);
+					break;
+				case MipmapFilter::Float16:
+					downsample_float16(src, src_mipmap.extent, dst, dst_mipmap.extent, first_row, last_row);
+					break;
+				default:
+					downsample_unorm8(src, src_mipmap.extent, dst, dst_mipmap.extent, first_row, last_row);
+					break;
+			}
+		});
+	}
+}
 
-		// Next mipmap values
-		next_width  = std::max<uint32_t>(1u, next_width / 2);
-		next_height = std::max<uint32_t>(1u, next_height / 2);
-		next_size   = next_width * next_height * channels;
+void Image::generate_mipmaps()
+{
+	assert(mipmaps.size() == 1 && "Mipmaps already generated");
 
-		if (next_width == 1 && next_height == 1)
-		{
-			break;
-		}
+	if (mipmaps.size() > 1)
+	{
+		return;        // Do not generate again
 	}
+
+	generate_mip_chain(format, data, mipmaps);
 }
 
 std::vector<Mipmap> &Image::get_mut_mipmaps()
@@ -379,7 +565,9 @@ std::unique_ptr<Image> Image::load(const std::string &name, const std::string &u
 {
 	std::unique_ptr<Image> image{nullptr};
 
-	auto data = fs::read_asset(uri);
+	// The loaders only read the file contents, so they can decode it in place instead of from a copy
+	auto file = fs::map_asset(uri);
+	auto data = file.span();
 
 	// Get extension
 	auto extension = get_extension(uri);
@@ -53,6 +53,15 @@ struct Mipmap
 	VkExtent3D extent = {0, 0, 0};
 };
 
+/**
+ * @brief Appends the mip levels below the last one of a chain, down to 1x1, averaging 2x2 texels per level
+ *        sRGB formats are averaged in linear space, other formats are read as four 8-bit or 16-bit float channels
+ * @param format Vulkan format of the texels
+ * @param data Texel data of the chain, which is grown to hold the new levels
+ * @param mipmaps Levels of the chain, the last of which is downsampled
+ */
+void generate_mip_chain(VkFormat format, std::vector<uint8_t> &data, std::vector<Mipmap> &mipmaps);
+
 class Image : public Component
 {
   public:
@@ -1,4 +1,4 @@
-/* Copyright (c) 2019-2025, Arm Limited and Contributors
+/* Copyright (c) 2019-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -17,10 +17,13 @@
 
 #include "scene_graph/components/image/astc.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <mutex>
+#include <unordered_map>
 
 #include "common/error.h"
+#include "common/job_system.h"
 #include "core/util/profiling.hpp"
 
 #include "common/glm_common.h"
@@ -37,6 +40,7 @@
 
 constexpr uint32_t ASTC_CACHE_HEADER_SIZE = 64;
 constexpr uint32_t ASTC_CACHE_SEED        = 1619;
+constexpr uint32_t ASTC_BLOCK_SIZE        = 16;
 
 namespace vkb
 {
@@ -45,6 +49,141 @@ namespace sg
 
 using Path = std::filesystem::path;
 
+namespace
+{
+/**
+ * @brief Keeps the astcenc decode contexts for reuse, as allocating one builds large lookup tables
+ *
+ * A context decodes a single image at a time, so the pool hands out one context per concurrent decode and grows to
+ * the number of images decoded at the same time for a given block size and profile. All contexts have a slot for
+ * every thread of the job system.
+ */
+class DecodeContextPool
+{
+  public:
+	static DecodeContextPool &get()
+	{
+		static DecodeContextPool pool;
+		return pool;
+	}
+
+	~DecodeContextPool()
+	{
+		for (auto &[key, contexts] : free_contexts)
+		{
+			for (auto *context : contexts)
+			{
+				astcenc_context_free(context);
+			}
+		}
+	}
+
+	astcenc_context *acquire(BlockDim blockdim, astcenc_profile profile, uint32_t thread_count)
+	{
+		{
+			std::lock_guard<std::mutex> guard{mutex};
+
+			auto &contexts = free_contexts[get_key(blockdim, profile)];
+			if (!contexts.empty())
+			{
+				auto *context = contexts.back();
+				contexts.pop_back();
+				return context;
+			}
+		}
+
+		astcenc_config astc_config;
+		auto           astc_result = astcenc_config_init(profile, blockdim.x, blockdim.y, blockdim.z, ASTCENC_PRE_FAST, ASTCENC_FLG_DECOMPRESS_ONLY, &astc_config);
+		if (astc_result != ASTCENC_SUCCESS)
+		{
+			throw std::runtime_error{"Error initializing astc"};
+		}
+
+		astcenc_context *context = nullptr;
+		astc_result              = astcenc_context_alloc(&astc_config, thread_count, &context);
+		if (astc_result != ASTCENC_SUCCESS)
+		{
+			throw std::runtime_error{"Error allocating astc context"};
+		}
+
+		return context;
+	}
+
+	void release(BlockDim blockdim, astcenc_profile profile, astcenc_context *context)
+	{
+		astcenc_decompress_reset(context);
+
+		std::lock_guard<std::mutex> guard{mutex};
+		free_contexts[get_key(blockdim, profile)].push_back(context);
+	}
+
+  private:
+	static uint32_t get_key(BlockDim blockdim, astcenc_profile profile)
+	{
+		return blockdim.x | (blockdim.y << 8) | (blockdim.z << 16) | (static_cast<uint32_t>(profile) << 24);
+	}
+
+	std::mutex                                                   mutex;
+	std::unordered_map<uint32_t, std::vector<astcenc_context *>> free_contexts;
+};
+
+/**
+ * @brief Decodes ASTC data to RGBA8 texels, split across the threads of the job system
+ * @param decoded_data Destination of the texels, with room for the whole extent
+ */
+void decode_astc(BlockDim blockdim, astcenc_profile profile, VkExtent3D extent, const uint8_t *compressed_data, size_t compressed_size, uint8_t *decoded_data)
+{
+	if (extent.width == 0 || extent.height == 0 || extent.depth == 0)
+	{
+		throw std::runtime_error{"Error reading astc: invalid size"};
+	}
+
+	auto &job_system   = JobSystem::get();
+	auto  thread_count = job_system.get_thread_count();
+	auto &pool         = DecodeContextPool::get();
+	auto *astc_context = pool.acquire(blockdim, profile, thread_count);
+
+	astcenc_swizzle swizzle = {ASTCENC_SWZ_R, ASTCENC_SWZ_G, ASTCENC_SWZ_B, ASTCENC_SWZ_A};
+
+	astcenc_image decoded{};
+	decoded.dim_x     = extent.width;
+	decoded.dim_y     = extent.height;
+	decoded.dim_z     = extent.depth;
+	decoded.data_type = ASTCENC_TYPE_U8;
+
+	// astcenc writes the texels straight to the destination
+	void *data_ptr = static_cast<void *>(decoded_data);
+	decoded.data   = &data_ptr;
+
+	// Every thread slot of the context takes part, the slots that start late find the blocks already decoded
+	std::atomic<bool> failed{false};
+	job_system.parallel_for(thread_count, 1, [&](size_t begin, size_t end) {
+		for (size_t thread_index = begin; thread_index < end; ++thread_index)
+		{
+			if (astcenc_decompress_image(astc_context, compressed_data, compressed_size, &decoded, &swizzle, to_u32(thread_index)) != ASTCENC_SUCCESS)
+			{
+				failed = true;
+			}
+		}
+	});
+
+	pool.release(blockdim, profile, astc_context);
+
+	if (failed)
+	{
+		throw std::runtime_error("Error decoding astc");
+	}
+}
+
+size_t get_compressed_size(BlockDim blockdim, const VkExtent3D &extent)
+{
+	auto blocks_x = (extent.width + blockdim.x - 1) / blockdim.x;
+	auto blocks_y = (extent.height + blockdim.y - 1) / blockdim.y;
+	auto blocks_z = (extent.depth + blockdim.z - 1) / blockdim.z;
+	return size_t{blocks_x} * blocks_y * blocks_z * ASTC_BLOCK_SIZE;
+}
+}        // namespace
+
 BlockDim to_blockdim(const VkFormat format)
 {
 	switch (format)
@@ -154,58 +293,15 @@ void Astc::decode(BlockDim blockdim, VkExtent3D extent, const uint8_t *compresse
 {
 	PROFILE_SCOPE("Decode ASTC Image");
 
-	// Actual decoding
-	astcenc_swizzle swizzle = {ASTCENC_SWZ_R, ASTCENC_SWZ_G, ASTCENC_SWZ_B, ASTCENC_SWZ_A};
-	// Configure the compressor run
-	astcenc_config astc_config;
-	auto           atscresult = astcenc_config_init(
-        ASTCENC_PRF_LDR_SRGB,
-        blockdim.x,
-        blockdim.y,
-        blockdim.z,
-        ASTCENC_PRE_FAST,
-        ASTCENC_FLG_DECOMPRESS_ONLY,
-        &astc_config);
-
-	if (atscresult != ASTCENC_SUCCESS)
-	{
-		throw std::runtime_error{"Error initializing astc"};
-	}
-
-	if (extent.width == 0 || extent.height == 0 || extent.depth == 0)
-	{
-		throw std::runtime_error{"Error reading astc: invalid size"};
-	}
-
-	// Allocate working state given config and thread_count
-	astcenc_context *astc_context;
-	astcenc_context_alloc(&astc_config, 1, &astc_context);
+	auto &decoded_data = get_mut_data();
+	decoded_data.resize(size_t{extent.width} * extent.height * extent.depth * 4);
 
-	astcenc_image decoded{};
-	decoded.dim_x     = extent.width;
-	decoded.dim_y     = extent.height;
-	decoded.dim_z     = extent.depth;
-	decoded.data_type = ASTCENC_TYPE_U8;
-
-	// allocate storage for the decoded image
-	// The astcenc_decompress_image function will write directly to the image data vector
-	auto  uncompressed_size = decoded.dim_x * decoded.dim_y * decoded.dim_z * 4;
-	auto &decoded_data      = get_mut_data();
-	decoded_data.resize(uncompressed_size);
-	void *data_ptr = static_cast<void *>(decoded_data.data());
-	decoded.data   = &data_ptr;
-
-	atscresult = astcenc_decompress_image(astc_context, compressed_data, compressed_size, &decoded, &swizzle, 0);
-	if (atscresult != ASTCENC_SUCCESS)
-	{
-		throw std::runtime_error("Error decoding astc");
-	}
-	astcenc_context_free(astc_context);
+	decode_astc(blockdim, ASTCENC_PRF_LDR_SRGB, extent, compressed_data, compressed_size, decoded_data.data());
 
 	set_format(VK_FORMAT_R8G8B8A8_SRGB);
-	set_width(decoded.dim_x);
-	set_height(decoded.dim_y);
-	set_depth(decoded.dim_z);
+	set_width(extent.width);
+	set_height(extent.height);
+	set_depth(extent.depth);
 }
 
 Astc::Astc(const Image &image) :
@@ -220,10 +316,28 @@ Astc::Astc(const Image &image) :
 
 	constexpr bool       use_cache                                 = true;
 	constexpr uint32_t   bytes_per_pixel                           = 4;
-	constexpr const char file_cache_header[ASTC_CACHE_HEADER_SIZE] = "ASTCConvertedDataV01";
+	constexpr const char file_cache_header[ASTC_CACHE_HEADER_SIZE] = "ASTCConvertedDataV02";
 	const auto           profile                                   = to_profile(image.get_format());
+	const auto           blockdim                                  = to_blockdim(image.get_format());
+
+	// The decoded mips are laid out in level order, so they are sorted as the mip #0 is the last one in KTX2s
+	std::vector<const Mipmap *> source_mipmaps;
+	for (auto &mip : image.get_mipmaps())
+	{
+		source_mipmaps.push_back(&mip);
+	}
+	std::ranges::sort(source_mipmaps, [](const Mipmap *lhs, const Mipmap *rhs) { return lhs->level < rhs->level; });
+	assert(source_mipmaps.front()->level == 0 && "Mip #0 not found");
 
-	auto can_load_from_file = [this, profile, fs, file_cache_header, bytes_per_pixel, use_cache](const Path &path, std::vector<uint8_t> &dst_data, uint32_t width, uint32_t height, uint32_t depth) {
+	std::vector<Mipmap> decoded_mipmaps;
+	uint32_t            decoded_size = 0;
+	for (auto *source_mip : source_mipmaps)
+	{
+		decoded_mipmaps.push_back({source_mip->level, decoded_size, source_mip->extent});
+		decoded_size += source_mip->extent.width * source_mip->extent.height * source_mip->extent.depth * bytes_per_pixel;
+	}
+
+	auto can_load_from_file = [this, fs, file_cache_header, use_cache, &decoded_mipmaps, decoded_size](const Path &path, std::vector<uint8_t> &dst_data) {
 		if (!use_cache)
 		{
 			LOGD("Device does not support ASTC format and cache is disabled. ASTC image {} will be decoded.", get_name())
@@ -255,28 +369,24 @@ Astc::Astc(const Image &image) :
 				return false;
 			}
 
-			uint32_t file_width, file_height, file_depth;
+			const auto &extent = decoded_mipmaps.front().extent;
+
+			uint32_t file_width, file_height, file_depth, file_mip_count;
 			copy_from_file(&file_width, &offset, sizeof(std::uint32_t));
 			copy_from_file(&file_height, &offset, sizeof(std::uint32_t));
 			copy_from_file(&file_depth, &offset, sizeof(std::uint32_t));
+			copy_from_file(&file_mip_count, &offset, sizeof(std::uint32_t));
 
-			if (file_width != width || width == 0 ||
-			    file_height != height || height == 0 ||
-			    file_depth != depth || depth == 0)
+			if (file_width != extent.width || extent.width == 0 ||
+			    file_height != extent.height || extent.height == 0 ||
+			    file_depth != extent.depth || extent.depth == 0 ||
+			    file_mip_count != decoded_mipmaps.size())
 			{
 				return false;
 			}
-			else
-			{
-				set_width(width);
-				set_height(height);
-				set_depth(depth);
-				set_format(profile == ASTCENC_PRF_LDR_SRGB ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM);
-			}
 
-			auto image_size = width * height * depth * bytes_per_pixel;
-			dst_data.resize(image_size);
-			copy_from_file(dst_data.data(), &offset, image_size);
+			dst_data.resize(decoded_size);
+			copy_from_file(dst_data.data(), &offset, decoded_size);
 
 			return true;
 		}
@@ -288,7 +398,7 @@ Astc::Astc(const Image &image) :
 		}
 	};
 
-	auto save_to_file = [fs, file_cache_header, bytes_per_pixel, use_cache](const Path &path, uint8_t *dst_data, uint32_t width, uint32_t height, uint32_t depth) {
+	auto save_to_file = [fs, file_cache_header, use_cache, &decoded_mipmaps](const Path &path, const std::vector<uint8_t> &dst_data) {
 		if (!use_cache)
 		{
 			return;
@@ -297,20 +407,22 @@ Astc::Astc(const Image &image) :
 		{
 			LOGI("Saving ASTC cache data to file: {}", path.string());
 
-			auto image_size = width * height * depth * bytes_per_pixel;
+			const auto &extent    = decoded_mipmaps.front().extent;
+			uint32_t    mip_count = to_u32(decoded_mipmaps.size());
 
 			std::vector<uint8_t> astc_file_content;
-			astc_file_content.reserve(sizeof(file_cache_header) + (3 * sizeof(std::uint32_t)) + image_size);
+			astc_file_content.reserve(sizeof(file_cache_header) + (4 * sizeof(std::uint32_t)) + dst_data.size());
 
 			auto append_to_file = [](std::vector<uint8_t> &dst_file, const std::uint8_t *content, size_t content_size) {
 				dst_file.insert(dst_file.end(), content, content + content_size);
 			};
 
 			append_to_file(astc_file_content, (uint8_t *) &file_cache_header, sizeof(file_cache_header));
-			append_to_file(astc_file_content, (uint8_t *) &width, sizeof(uint32_t));
-			append_to_file(astc_file_content, (uint8_t *) &height, sizeof(uint32_t));
-			append_to_file(astc_file_content, (uint8_t *) &depth, sizeof(uint32_t));
-			append_to_file(astc_file_content, (uint8_t *) dst_data, image_size);
+			append_to_file(astc_file_content, (uint8_t *) &extent.width, sizeof(uint32_t));
+			append_to_file(astc_file_content, (uint8_t *) &extent.height, sizeof(uint32_t));
+			append_to_file(astc_file_content, (uint8_t *) &extent.depth, sizeof(uint32_t));
+			append_to_file(astc_file_content, (uint8_t *) &mip_count, sizeof(uint32_t));
+			append_to_file(astc_file_content, dst_data.data(), dst_data.size());
 
 			fs->write_file(path, astc_file_content);
 		}
@@ -320,31 +432,39 @@ Astc::Astc(const Image &image) :
 		}
 	};
 
-	// Locate mip #0 in the KTX. This is the first one in the data array for KTX1s, but the last one in KTX2s!
-	auto mip_it = std::ranges::find_if(image.get_mipmaps(),
-	                                   [](auto &mip) { return mip.level == 0; });
-	assert(mip_it != image.get_mipmaps().end() && "Mip #0 not found");
-
 	const std::string path = fmt::format("{}/{}.bin", ASTC_CACHE_DIRECTORY, uint64_t(key));
 
-	if (!can_load_from_file(path, get_mut_data(), mip_it->extent.width, mip_it->extent.height, mip_it->extent.depth))
+	auto &decoded_data = get_mut_data();
+	if (!can_load_from_file(path, decoded_data))
 	{
-		// When decoding ASTC on CPU (as it is the case in here), we don't decode all mips in the mip chain.
-		// Instead, we just decode mip #0 and re-generate the other LODs later (via image->generate_mipmaps()).
-		const auto     blockdim = to_blockdim(image.get_format());
-		const auto    &extent   = mip_it->extent;
-		auto           size     = extent.width * extent.height * extent.depth * 4;
-		const uint8_t *data_ptr = image.get_data().data() + mip_it->offset;
+		PROFILE_SCOPE("Decode ASTC Image");
 
-		decode(blockdim, mip_it->extent, data_ptr, size);
+		// All the mips of the source are decoded, each one split across the threads, straight to their place in the data.
+		// An image that only has mip #0 gets the other LODs re-generated later (via image->generate_mipmaps()).
+		decoded_data.resize(decoded_size);
+		JobSystem::get().parallel_for(source_mipmaps.size(), 1, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i)
+			{
+				auto &source_mip = *source_mipmaps[i];
+				decode_astc(blockdim,
+				            profile,
+				            source_mip.extent,
+				            image.get_data().data() + source_mip.offset,
+				            get_compressed_size(blockdim, source_mip.extent),
+				            decoded_data.data() + decoded_mipmaps[i].offset);
+			}
+		});
 
-		save_to_file(path, get_mut_data().data(), mip_it->extent.width, mip_it->extent.height, mip_it->extent.depth);
+		save_to_file(path, decoded_data);
 	}
 
+	set_format(profile == ASTCENC_PRF_LDR_SRGB ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM);
+	get_mut_mipmaps() = std::move(decoded_mipmaps);
+
 	update_hash(image.get_data_hash());
 }
 
-Astc::Astc(const std::string &name, const std::vector<uint8_t> &data) :
+Astc::Astc(const std::string &name, std::span<const uint8_t> data) :
     Image{name}
 {
 	init();
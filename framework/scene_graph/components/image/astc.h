@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <span>
+
 #include "common/vk_common.h"
 #include "scene_graph/components/image.h"
 
@@ -45,7 +47,7 @@ class Astc : public Image
 	 * @param name Name of the component
 	 * @param data ASTC data with header
 	 */
-	Astc(const std::string &name, const std::vector<uint8_t> &data);
+	Astc(const std::string &name, std::span<const uint8_t> data);
 
 	virtual ~Astc() = default;
 
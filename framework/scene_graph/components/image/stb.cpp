@@ -24,7 +24,7 @@ namespace vkb
 {
 namespace sg
 {
-Stb::Stb(const std::string &name, const std::vector<uint8_t> &data, ContentType content_type) :
+Stb::Stb(const std::string &name, std::span<const uint8_t> data, ContentType content_type) :
     Image{name}
 {
 	int width;
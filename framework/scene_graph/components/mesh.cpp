@@ -1,4 +1,4 @@
-/* Copyright (c) 2018-2025, Arm Limited and Contributors
+/* Copyright (c) 2018-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -59,5 +59,15 @@ const std::vector<vkb::scene_graph::NodeC *> &Mesh::get_nodes() const
 {
 	return nodes;
 }
+
+void Mesh::set_morph_weights(const float *weights, size_t count)
+{
+	morph_weights.assign(weights, weights + count);
+}
+
+const std::vector<float> &Mesh::get_morph_weights() const
+{
+	return morph_weights;
+}
 }        // namespace sg
 }        // namespace vkb
@@ -1,4 +1,4 @@
-/* Copyright (c) 2018-2025, Arm Limited and Contributors
+/* Copyright (c) 2018-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -53,12 +53,21 @@ class Mesh : public Component
 
 	const std::vector<vkb::scene_graph::NodeC *> &get_nodes() const;
 
+	/**
+	 * @brief Sets the weights of the morph targets of the sub meshes, from the defaults of the mesh or an animation
+	 */
+	void set_morph_weights(const float *weights, size_t count);
+
+	const std::vector<float> &get_morph_weights() const;
+
   private:
 	AABB bounds;
 
 	std::vector<SubMesh *> submeshes;
 
 	std::vector<vkb::scene_graph::NodeC *> nodes;
+
+	std::vector<float> morph_weights;
 };
 }        // namespace sg
 }        // namespace vkb
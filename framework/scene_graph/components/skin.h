@@ -0,0 +1,71 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include "common/glm_common.h"
+#include "scene_graph/component.h"
+#include "scene_graph/node.h"
+
+namespace vkb
+{
+namespace sg
+{
+/**
+ * @brief The joints of a skinned mesh, with the inverse bind matrix of each joint
+ *
+ * A skin is set on the nodes of the meshes it deforms. The joints are nodes of the scene, usually animated.
+ */
+class Skin : public Component
+{
+  public:
+	Skin(const std::string &name);
+
+	virtual ~Skin() = default;
+
+	virtual std::type_index get_type() override;
+
+	/**
+	 * @brief Adds a joint
+	 * @param joint The node of the joint
+	 * @param inverse_bind_matrix The matrix moving a vertex from the space of the mesh to the space of the joint in bind pose
+	 */
+	void add_joint(vkb::scene_graph::NodeC &joint, const glm::mat4 &inverse_bind_matrix);
+
+	const std::vector<vkb::scene_graph::NodeC *> &get_joints() const;
+
+	const std::vector<glm::mat4> &get_inverse_bind_matrices() const;
+
+	/**
+	 * @brief Computes the joint matrices, which move a vertex from bind pose to the current pose in the space of the
+	 *        skinned mesh, so that the world matrix of the node of the mesh still applies to the skinned vertices
+	 * @param mesh_world_matrix The world matrix of the node of the skinned mesh
+	 * @param[out] joint_matrices One matrix per joint
+	 */
+	void compute_joint_matrices(const glm::mat4 &mesh_world_matrix, std::vector<glm::mat4> &joint_matrices) const;
+
+  private:
+	std::vector<vkb::scene_graph::NodeC *> joints;
+
+	std::vector<glm::mat4> inverse_bind_matrices;
+};
+}        // namespace sg
+}        // namespace vkb
@@ -53,6 +53,35 @@ uint32_t SubMesh::get_vertices_count() const
 	return vertices_count;
 }
 
+bool SubMesh::is_deformable() const
+{
+	return skin_buffer || 0 < morph_target_count;
+}
+
+const vkb::core::BufferC *SubMesh::find_vertex_buffer(const std::string &name) const
+{
+	auto override_it = vertex_buffer_overrides.find(name);
+	if (override_it != vertex_buffer_overrides.end())
+	{
+		return override_it->second;
+	}
+
+	auto buffer_it = vertex_buffers.find(name);
+	return buffer_it != vertex_buffers.end() ? &buffer_it->second : nullptr;
+}
+
+void SubMesh::set_vertex_buffer_override(const std::string &name, const vkb::core::BufferC *buffer)
+{
+	if (buffer)
+	{
+		vertex_buffer_overrides[name] = buffer;
+	}
+	else
+	{
+		vertex_buffer_overrides.erase(name);
+	}
+}
+
 std::type_index SubMesh::get_type()
 {
 	return typeid(SubMesh);
@@ -23,6 +23,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "common/glm_common.h"
 #include "common/vk_common.h"
 #include "core/buffer.h"
 #include "core/shader_module.h"
@@ -43,6 +44,26 @@ struct VertexAttribute
 	std::uint32_t offset = 0;
 };
 
+/**
+ * @brief Joint indices and weights of a vertex of a skinned sub mesh, as read by the skinning pass
+ */
+struct SkinVertex
+{
+	glm::uvec4 joints;
+
+	glm::vec4 weights;
+};
+
+/**
+ * @brief Position and normal offsets of a vertex in a morph target, as read by the skinning pass
+ */
+struct MorphTargetVertex
+{
+	glm::vec4 position;
+
+	glm::vec4 normal;
+};
+
 class SubMesh : public Component
 {
   public:
@@ -71,6 +92,33 @@ class SubMesh : public Component
 
 	std::unique_ptr<vkb::core::BufferC> index_buffer;
 
+	/// Joint indices and weights of the vertices of a skinned sub mesh, a SkinVertex each
+	std::unique_ptr<vkb::core::BufferC> skin_buffer;
+
+	/// Offsets of the vertices in each morph target, a MorphTargetVertex each, ordered by target then vertex
+	std::unique_ptr<vkb::core::BufferC> morph_target_buffer;
+
+	std::uint32_t morph_target_count = 0;
+
+	/**
+	 * @return True if the sub mesh is skinned or has morph targets, and so needs to be deformed before it is drawn
+	 */
+	bool is_deformable() const;
+
+	/**
+	 * @brief Finds the vertex buffer to draw an attribute with, which is the override of the attribute if it has one
+	 * @return The buffer, or nullptr if the sub mesh has no such attribute
+	 */
+	const vkb::core::BufferC *find_vertex_buffer(const std::string &name) const;
+
+	/**
+	 * @brief Replaces the vertex buffer of an attribute when drawing, such as with the output of the skinning pass
+	 *        The buffer must have the same format and stride as the attribute
+	 * @param name The name of the attribute
+	 * @param buffer The buffer to draw the attribute with, or nullptr to draw with the vertex buffer of the attribute again
+	 */
+	void set_vertex_buffer_override(const std::string &name, const vkb::core::BufferC *buffer);
+
 	void set_attribute(const std::string &name, const VertexAttribute &attribute);
 
 	bool get_attribute(const std::string &name, VertexAttribute &attribute) const;
@@ -86,6 +134,8 @@ class SubMesh : public Component
   private:
 	std::unordered_map<std::string, VertexAttribute> vertex_attributes;
 
+	std::unordered_map<std::string, const vkb::core::BufferC *> vertex_buffer_overrides;
+
 	const Material *material{nullptr};
 
 	ShaderVariant shader_variant;
@@ -1,4 +1,4 @@
-/* Copyright (c) 2018-2025, Arm Limited and Contributors
+/* Copyright (c) 2018-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -21,6 +21,7 @@
 #include <glm/gtx/matrix_decompose.hpp>
 
 #include "scene_graph/node.h"
+#include "scene_graph/transform_hierarchy.h"
 
 namespace vkb
 {
@@ -62,6 +63,15 @@ void Transform::set_scale(const glm::vec3 &new_scale)
 	invalidate_world_matrix();
 }
 
+void Transform::set_translation_rotation_scale(const glm::vec3 &new_translation, const glm::quat &new_rotation, const glm::vec3 &new_scale)
+{
+	translation = new_translation;
+	rotation    = new_rotation;
+	scale       = new_scale;
+
+	invalidate_world_matrix();
+}
+
 const glm::vec3 &Transform::get_translation() const
 {
 	return translation;
@@ -95,6 +105,11 @@ glm::mat4 Transform::get_matrix() const
 
 glm::mat4 Transform::get_world_matrix()
 {
+	if (hierarchy)
+	{
+		return hierarchy->get_world_matrix(hierarchy_index);
+	}
+
 	update_world_transform();
 
 	return world_matrix;
@@ -102,9 +117,31 @@ glm::mat4 Transform::get_world_matrix()
 
 void Transform::invalidate_world_matrix()
 {
+	if (hierarchy)
+	{
+		hierarchy->mark_dirty(hierarchy_index);
+	}
+	else
+	{
+		update_world_matrix = true;
+	}
+}
+
+void Transform::set_hierarchy(vkb::scene_graph::TransformHierarchy *new_hierarchy, uint32_t index)
+{
+	hierarchy           = new_hierarchy;
+	hierarchy_index     = index;
 	update_world_matrix = true;
 }
 
+void Transform::invalidate_hierarchy()
+{
+	if (hierarchy)
+	{
+		hierarchy->invalidate();
+	}
+}
+
 void Transform::update_world_transform()
 {
 	if (!update_world_matrix)
@@ -118,8 +155,7 @@ void Transform::update_world_transform()
 
 	if (parent)
 	{
-		auto &transform = parent->get_component<Transform>();
-		world_matrix    = transform.get_world_matrix() * world_matrix;
+		world_matrix = parent->get_transform().get_world_matrix() * world_matrix;
 	}
 
 	update_world_matrix = false;
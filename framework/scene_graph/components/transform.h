@@ -1,4 +1,4 @@
-/* Copyright (c) 2018-2025, Arm Limited and Contributors
+/* Copyright (c) 2018-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -36,6 +36,7 @@ namespace scene_graph
 template <vkb::BindingType bindingType>
 class Node;
 using NodeC = Node<vkb::BindingType::C>;
+class TransformHierarchy;
 }        // namespace scene_graph
 
 namespace sg
@@ -57,6 +58,11 @@ class Transform : public Component
 
 	void set_scale(const glm::vec3 &scale);
 
+	/**
+	 * @brief Sets the translation, rotation and scale together, invalidating the world matrix only once
+	 */
+	void set_translation_rotation_scale(const glm::vec3 &translation, const glm::quat &rotation, const glm::vec3 &scale);
+
 	const glm::vec3 &get_translation() const;
 
 	const glm::quat &get_rotation() const;
@@ -76,9 +82,26 @@ class Transform : public Component
 	 */
 	void invalidate_world_matrix();
 
+	/**
+	 * @brief Attaches the transform to a flattened hierarchy, which then owns its world matrix
+	 * @param hierarchy The hierarchy, or nullptr to go back to computing the world matrix from the parent nodes
+	 * @param index The index of the node in the hierarchy
+	 */
+	void set_hierarchy(vkb::scene_graph::TransformHierarchy *hierarchy, uint32_t index);
+
+	/**
+	 * @brief Invalidates the flattened hierarchy the transform is attached to, if any, after the structure of its
+	 *        node tree changed
+	 */
+	void invalidate_hierarchy();
+
   private:
 	vkb::scene_graph::NodeC &node;
 
+	vkb::scene_graph::TransformHierarchy *hierarchy = nullptr;
+
+	uint32_t hierarchy_index = 0;
+
 	glm::vec3 translation = glm::vec3(0.0, 0.0, 0.0);
 
 	glm::quat rotation = glm::quat(1.0, 0.0, 0.0, 0.0);
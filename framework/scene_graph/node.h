@@ -171,6 +171,8 @@ inline void Node<bindingType>::set_parent(Node<bindingType> &p)
 		parent = reinterpret_cast<NodeCpp *>(&p);
 	}
 
+	// The flattened order of the nodes no longer matches the tree
+	transform.invalidate_hierarchy();
 	transform.invalidate_world_matrix();
 }
 }        // namespace scene_graph
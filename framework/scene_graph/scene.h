@@ -23,9 +23,11 @@
 #include "scene_graph/components/hpp_mesh.h"
 #include "scene_graph/components/light.h"
 #include "scene_graph/components/pbr_material.h"
+#include "scene_graph/components/skin.h"
 #include "scene_graph/components/sub_mesh.h"
 #include "scene_graph/node.h"
 #include "scene_graph/scripts/animation.h"
+#include "scene_graph/transform_hierarchy.h"
 
 namespace vkb
 {
@@ -45,6 +47,7 @@ class Scene
 	void add_component(std::unique_ptr<vkb::sg::Component> &&component);
 	void add_component(std::unique_ptr<vkb::sg::Component> &&component, vkb::scene_graph::Node<bindingType> &node);
 	void add_node(std::unique_ptr<vkb::scene_graph::Node<bindingType>> &&node);
+	void build_transform_hierarchy();
 	template <class T>
 	void                                 clear_components();
 	vkb::scene_graph::Node<bindingType> *find_node(std::string const &name);
@@ -52,6 +55,7 @@ class Scene
 	std::vector<T *>                     get_components() const;
 	std::string const                   &get_name() const;
 	vkb::scene_graph::Node<bindingType> &get_root_node();
+	TransformHierarchy                  *get_transform_hierarchy();
 	template <class T>
 	bool has_component() const;
 	template <class T>
@@ -71,6 +75,7 @@ class Scene
 	std::string                                                                           name;
 	std::vector<std::unique_ptr<vkb::scene_graph::NodeCpp>>                               nodes;        // List of all the nodes
 	vkb::scene_graph::NodeCpp                                                            *root = nullptr;
+	std::unique_ptr<TransformHierarchy>                                                   transform_hierarchy;
 };
 
 using SceneC   = Scene<vkb::BindingType::C>;
@@ -125,6 +130,16 @@ inline void Scene<bindingType>::add_node(std::unique_ptr<vkb::scene_graph::Node<
 	}
 }
 
+template <vkb::BindingType bindingType>
+inline void Scene<bindingType>::build_transform_hierarchy()
+{
+	assert(root);
+
+	// The previous hierarchy has to detach from the transforms before the new one attaches to them
+	transform_hierarchy.reset();
+	transform_hierarchy = std::make_unique<TransformHierarchy>(*root);
+}
+
 template <vkb::BindingType bindingType>
 template <class T>
 inline void Scene<bindingType>::clear_components()
@@ -207,6 +222,12 @@ inline vkb::scene_graph::Node<bindingType> &Scene<bindingType>::get_root_node()
 	}
 }
 
+template <vkb::BindingType bindingType>
+inline TransformHierarchy *Scene<bindingType>::get_transform_hierarchy()
+{
+	return transform_hierarchy.get();
+}
+
 template <vkb::BindingType bindingType>
 template <class T>
 inline bool Scene<bindingType>::has_component() const
@@ -228,6 +249,7 @@ inline std::type_index Scene<bindingType>::get_type_index() const
 	              std::is_same<T, vkb::sg::Mesh>::value ||
 	              std::is_same<T, vkb::sg::PBRMaterial>::value ||
 	              std::is_same<T, vkb::sg::Script>::value ||
+	              std::is_same<T, vkb::sg::Skin>::value ||
 	              std::is_same<T, vkb::sg::SubMesh>::value ||
 	              std::is_same<T, vkb::sg::Texture>::value);
 
@@ -1,4 +1,4 @@
-/* Copyright (c) 2020-2025, Arm Limited and Contributors
+/* Copyright (c) 2020-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -17,152 +17,293 @@
 
 #include "animation.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include "common/helpers.h"
+#include "common/job_system.h"
+#include "core/util/logging.hpp"
+#include "core/util/profiling.hpp"
+#include "scene_graph/components/mesh.h"
 #include "scene_graph/node.h"
 
 namespace vkb
 {
 namespace sg
 {
+namespace
+{
+// Number of keyframes a cursor is moved forward one at a time before falling back to a binary search
+constexpr uint32_t CURSOR_MAX_STEPS = 4;
+
+glm::quat to_quat(const glm::vec4 &value)
+{
+	glm::quat q;
+	q.x = value.x;
+	q.y = value.y;
+	q.z = value.z;
+	q.w = value.w;
+	return q;
+}
+
+glm::vec4 to_vec4(const glm::quat &q)
+{
+	return glm::vec4(q.x, q.y, q.z, q.w);
+}
+}        // namespace
+
 Animation::Animation(const std::string &name) :
     Script{name}
 {
 }
 
 Animation::Animation(const Animation &other) :
-    channels{other.channels}
+    channels{other.channels},
+    key_times{other.key_times},
+    values_x{other.values_x},
+    values_y{other.values_y},
+    values_z{other.values_z},
+    values_w{other.values_w},
+    sampled_values{other.sampled_values},
+    current_time{other.current_time},
+    start_time{other.start_time},
+    end_time{other.end_time}
 {
 }
 
 void Animation::add_channel(vkb::scene_graph::NodeC &node, const AnimationTarget &target, const AnimationSampler &sampler)
 {
-	channels.push_back({node, target, sampler});
+	uint32_t key_count      = to_u32(sampler.inputs.size());
+	uint32_t values_per_key = sampler.type == AnimationType::CubicSpline ? 3 : 1;
+
+	// Morph target weights have one scalar output per target and keyframe, the other targets one vector per keyframe
+	uint32_t value_count = 1;
+	if (target == Weights && 0 < key_count)
+	{
+		value_count = to_u32(sampler.outputs.size() / (static_cast<size_t>(key_count) * values_per_key));
+	}
+
+	size_t total_value_count = static_cast<size_t>(key_count) * values_per_key * value_count;
+	if (key_count == 0 || value_count == 0 || sampler.outputs.size() < total_value_count)
+	{
+		LOGW("Animation channel of node `{}` has no keyframes or too few values, ignoring it", node.get_name());
+		return;
+	}
+
+	channels.push_back({&node, target, sampler.type, to_u32(key_times.size()), key_count, to_u32(values_x.size()), value_count, to_u32(sampled_values.size()), 0});
+
+	key_times.insert(key_times.end(), sampler.inputs.begin(), sampler.inputs.end());
+	sampled_values.resize(sampled_values.size() + value_count);
+
+	for (size_t i = 0; i < total_value_count; ++i)
+	{
+		values_x.push_back(sampler.outputs[i].x);
+		values_y.push_back(sampler.outputs[i].y);
+		values_z.push_back(sampler.outputs[i].z);
+		values_w.push_back(sampler.outputs[i].w);
+	}
 }
 
 void Animation::update(float delta_time)
 {
+	if (channels.empty())
+	{
+		return;
+	}
+
+	PROFILE_SCOPE("Update Animation");
+
 	current_time += delta_time;
-	if (current_time > end_time)
+	if (0.0f < end_time && current_time > end_time)
 	{
-		current_time -= end_time;
+		current_time = std::fmod(current_time, end_time);
 	}
 
-	for (auto &channel : channels)
+	if (channel_order.size() != channels.size())
 	{
-		for (size_t i = 0; i < channel.sampler.inputs.size() - 1; ++i)
+		channel_order.resize(channels.size());
+		for (uint32_t i = 0; i < channel_order.size(); ++i)
 		{
-			if ((current_time >= channel.sampler.inputs[i]) && (current_time <= channel.sampler.inputs[i + 1]))
-			{
-				float time = (current_time - channel.sampler.inputs[i]) / (channel.sampler.inputs[i + 1] - channel.sampler.inputs[i]);
+			channel_order[i] = i;
+		}
+		std::ranges::stable_sort(channel_order, std::less{}, [this](uint32_t index) { return channels[index].node; });
 
-				auto &transform = channel.node.get_transform();
+		valid_values.resize(channels.size());
+	}
 
-				if (channel.sampler.type == AnimationType::Linear)
-				{
-					switch (channel.target)
-					{
-						case Translation:
-						{
-							transform.set_translation(glm::vec3(glm::mix(channel.sampler.outputs[i],
-							                                             channel.sampler.outputs[i + 1],
-							                                             time)));
-							break;
-						}
-						case Rotation:
-						{
-							glm::quat q1;
-							q1.x = channel.sampler.outputs[i].x;
-							q1.y = channel.sampler.outputs[i].y;
-							q1.z = channel.sampler.outputs[i].z;
-							q1.w = channel.sampler.outputs[i].w;
-
-							glm::quat q2;
-							q2.x = channel.sampler.outputs[i + 1].x;
-							q2.y = channel.sampler.outputs[i + 1].y;
-							q2.z = channel.sampler.outputs[i + 1].z;
-							q2.w = channel.sampler.outputs[i + 1].w;
-
-							transform.set_rotation(glm::normalize(glm::slerp(q1, q2, time)));
-							break;
-						}
+	JobSystem::get().parallel_for(channels.size(), PARALLEL_GRAIN_SIZE, [this](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i)
+		{
+			valid_values[i] = evaluate(channels[i], &sampled_values[channels[i].first_sample]);
+		}
+	});
 
-						case Scale:
-						{
-							transform.set_scale(glm::vec3(glm::mix(channel.sampler.outputs[i],
-							                                       channel.sampler.outputs[i + 1],
-							                                       time)));
-						}
-					}
+	// All the channels of a node are combined into a single update of its transform
+	for (size_t i = 0; i < channel_order.size();)
+	{
+		auto *node      = channels[channel_order[i]].node;
+		auto &transform = node->get_transform();
+
+		glm::vec3 translation = transform.get_translation();
+		glm::quat rotation    = transform.get_rotation();
+		glm::vec3 scale       = transform.get_scale();
+		bool      changed     = false;
+
+		for (; i < channel_order.size() && channels[channel_order[i]].node == node; ++i)
+		{
+			uint32_t index = channel_order[i];
+			if (!valid_values[index])
+			{
+				continue;
+			}
+
+			auto &channel = channels[index];
+			auto &value   = sampled_values[channel.first_sample];
+			switch (channel.target)
+			{
+				case Translation:
+				{
+					translation = glm::vec3(value);
+					break;
+				}
+				case Rotation:
+				{
+					rotation = glm::normalize(to_quat(value));
+					break;
+				}
+				case Scale:
+				{
+					scale = glm::vec3(value);
+					break;
 				}
-				else if (channel.sampler.type == AnimationType::Step)
+				case Weights:
 				{
-					switch (channel.target)
+					if (node->has_component<Mesh>())
 					{
-						case Translation:
-						{
-							transform.set_translation(glm::vec3(channel.sampler.outputs[i]));
-							break;
-						}
-						case Rotation:
+						morph_weights.resize(channel.value_count);
+						for (uint32_t j = 0; j < channel.value_count; ++j)
 						{
-							glm::quat q1;
-							q1.x = channel.sampler.outputs[i].x;
-							q1.y = channel.sampler.outputs[i].y;
-							q1.z = channel.sampler.outputs[i].z;
-							q1.w = channel.sampler.outputs[i].w;
-
-							transform.set_rotation(glm::normalize(q1));
-							break;
-						}
-
-						case Scale:
-						{
-							transform.set_scale(glm::vec3(channel.sampler.outputs[i]));
+							morph_weights[j] = sampled_values[channel.first_sample + j].x;
 						}
+						node->get_component<Mesh>().set_morph_weights(morph_weights.data(), morph_weights.size());
 					}
+					continue;
 				}
-				else if (channel.sampler.type == AnimationType::CubicSpline)
-				{
-					float delta = channel.sampler.inputs[i + 1] - channel.sampler.inputs[i];
+			}
+			changed = true;
+		}
 
-					glm::vec4 p0 = channel.sampler.outputs[i * 3 + 1];              // Starting point
-					glm::vec4 p1 = channel.sampler.outputs[(i + 1) * 3 + 1];        // Ending point
+		if (changed)
+		{
+			transform.set_translation_rotation_scale(translation, rotation, scale);
+		}
+	}
+}
 
-					glm::vec4 m0 = delta * channel.sampler.outputs[i * 3 + 2];              // Delta time * out tangent
-					glm::vec4 m1 = delta * channel.sampler.outputs[(i + 1) * 3 + 0];        // Delta time * in tangent of next point
+bool Animation::evaluate(Channel &channel, glm::vec4 *values)
+{
+	if (channel.key_count == 0)
+	{
+		return false;
+	}
 
-					// This equation is taken from the GLTF 2.0 specification Appendix C (https://github.com/KhronosGroup/glTF/tree/main/specification/2.0#appendix-c-spline-interpolation)
-					glm::vec4 result = (2.0f * glm::pow(time, 3.0f) - 3.0f * glm::pow(time, 2.0f) + 1.0f) * p0 + (glm::pow(time, 3.0f) - 2.0f * glm::pow(time, 2.0f) + time) * m0 + (-2.0f * glm::pow(time, 3.0f) + 3.0f * glm::pow(time, 2.0f)) * p1 + (glm::pow(time, 3.0f) - glm::pow(time, 2.0f)) * m1;
+	const float *times = key_times.data() + channel.first_key;
+	uint32_t     last  = channel.key_count - 1;
 
-					auto &transform = channel.node.get_transform();
+	// A single keyframe, and the keyframes at both ends outside of their range, hold their value
+	if (channel.key_count == 1 || current_time <= times[0] || times[last] <= current_time)
+	{
+		uint32_t key = (channel.key_count == 1 || current_time <= times[0]) ? 0 : last;
+		for (uint32_t j = 0; j < channel.value_count; ++j)
+		{
+			values[j] = get_key_value(channel, key, j);
+		}
+		return true;
+	}
 
-					switch (channel.target)
-					{
-						case Translation:
-						{
-							transform.set_translation(glm::vec3(result));
-							break;
-						}
-						case Rotation:
-						{
-							glm::quat q1;
-							q1.x = result.x;
-							q1.y = result.y;
-							q1.z = result.z;
-							q1.w = result.w;
-
-							transform.set_rotation(glm::normalize(q1));
-							break;
-						}
+	channel.cursor = find_interval(channel);
 
-						case Scale:
-						{
-							transform.set_scale(glm::vec3(result));
-						}
-					}
-				}
-			}
+	uint32_t i     = channel.cursor;
+	float    delta = times[i + 1] - times[i];
+	float    time  = 0.0f < delta ? (current_time - times[i]) / delta : 0.0f;
+
+	for (uint32_t j = 0; j < channel.value_count; ++j)
+	{
+		values[j] = interpolate(channel, i, time, delta, j);
+	}
+
+	return true;
+}
+
+glm::vec4 Animation::interpolate(const Channel &channel, uint32_t interval, float time, float delta, uint32_t element) const
+{
+	uint32_t i     = interval;
+	uint32_t count = channel.value_count;
+	uint32_t first = channel.first_value + element;
+
+	switch (channel.type)
+	{
+		case AnimationType::Step:
+		{
+			return get_value(first + i * count);
+		}
+		case AnimationType::CubicSpline:
+		{
+			glm::vec4 p0 = get_value(first + (i * 3 + 1) * count);                // Starting point
+			glm::vec4 p1 = get_value(first + ((i + 1) * 3 + 1) * count);          // Ending point
+			glm::vec4 m0 = delta * get_value(first + (i * 3 + 2) * count);        // Delta time * out tangent
+			glm::vec4 m1 = delta * get_value(first + (i + 1) * 3 * count);        // Delta time * in tangent of next point
+
+			// This equation is taken from the GLTF 2.0 specification Appendix C (https://github.com/KhronosGroup/glTF/tree/main/specification/2.0#appendix-c-spline-interpolation)
+			float time2 = time * time;
+			float time3 = time2 * time;
+			return (2.0f * time3 - 3.0f * time2 + 1.0f) * p0 + (time3 - 2.0f * time2 + time) * m0 + (-2.0f * time3 + 3.0f * time2) * p1 + (time3 - time2) * m1;
+		}
+		default:
+		{
+			glm::vec4 v0 = get_value(first + i * count);
+			glm::vec4 v1 = get_value(first + (i + 1) * count);
+
+			return channel.target == Rotation ? to_vec4(glm::slerp(to_quat(v0), to_quat(v1), time)) : glm::mix(v0, v1, time);
+		}
+	}
+}
+
+uint32_t Animation::find_interval(const Channel &channel) const
+{
+	const float *times = key_times.data() + channel.first_key;
+	uint32_t     last  = channel.key_count - 2;
+	uint32_t     i     = std::min(channel.cursor, last);
+
+	// While playing forward the time is usually still in the same interval, or a few intervals further
+	if (times[i] <= current_time)
+	{
+		for (uint32_t step = 0; step < CURSOR_MAX_STEPS && i < last && times[i + 1] <= current_time; ++step)
+		{
+			++i;
+		}
+
+		if (i == last || current_time < times[i + 1])
+		{
+			return i;
 		}
 	}
+
+	// The time jumped, either looping back or skipping ahead, the first keyframe is known to be before it
+	auto next = std::upper_bound(times, times + channel.key_count, current_time);
+	return std::min(static_cast<uint32_t>(next - times) - 1, last);
+}
+
+glm::vec4 Animation::get_key_value(const Channel &channel, uint32_t key, uint32_t element) const
+{
+	// The values of a cubic spline keyframe come after its in tangents
+	uint32_t index = channel.type == AnimationType::CubicSpline ? key * 3 + 1 : key;
+	return get_value(channel.first_value + index * channel.value_count + element);
+}
+
+glm::vec4 Animation::get_value(size_t index) const
+{
+	return glm::vec4(values_x[index], values_y[index], values_z[index], values_w[index]);
 }
 
 void Animation::update_times(float new_start_time, float new_end_time)
@@ -1,4 +1,4 @@
-/* Copyright (c) 2020-2025, Arm Limited and Contributors
+/* Copyright (c) 2020-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <functional>
+#include <limits>
 #include <memory>
 #include <string>
 #include <typeinfo>
@@ -41,7 +42,8 @@ enum AnimationTarget
 {
 	Translation,
 	Rotation,
-	Scale
+	Scale,
+	Weights
 };
 
 struct AnimationSampler
@@ -53,15 +55,14 @@ struct AnimationSampler
 	std::vector<glm::vec4> outputs{};
 };
 
-struct AnimationChannel
-{
-	vkb::scene_graph::NodeC &node;
-
-	AnimationTarget target;
-
-	AnimationSampler sampler;
-};
-
+/**
+ * @brief Plays the channels of an animation on the transforms of their target nodes.
+ *
+ * The keyframes of all the channels are stored in shared arrays, one per component, and every channel keeps a
+ * cursor to the keyframe interval it sampled last. As time moves forward the cursor only ever advances by a few
+ * keyframes, so the lookup is amortized O(1), while a jump is resolved with a binary search. Channels are evaluated
+ * in batches across the job system, then written to their nodes with a single update per node.
+ */
 class Animation : public Script
 {
   public:
@@ -76,7 +77,63 @@ class Animation : public Script
 	void add_channel(vkb::scene_graph::NodeC &node, const AnimationTarget &target, const AnimationSampler &sampler);
 
   private:
-	std::vector<AnimationChannel> channels;
+	struct Channel
+	{
+		vkb::scene_graph::NodeC *node;
+		AnimationTarget          target;
+		AnimationType            type;
+		uint32_t                 first_key;          // Index of the first keyframe in key_times
+		uint32_t                 key_count;
+		uint32_t                 first_value;         // Index of the first value in the value arrays, three per keyframe for cubic splines
+		uint32_t                 value_count;         // Number of values per keyframe, one except for the morph target weights
+		uint32_t                 first_sample;        // Index of the first sampled value in sampled_values
+		uint32_t                 cursor;              // Keyframe interval sampled last
+	};
+
+	static constexpr size_t PARALLEL_GRAIN_SIZE = 1024;
+
+	/**
+	 * @brief Samples a channel at the current time, holding the first or last keyframe outside of their range
+	 * @param[out] values The sampled values, value_count of them
+	 * @return False if the channel has no keyframes
+	 */
+	bool evaluate(Channel &channel, glm::vec4 *values);
+
+	/**
+	 * @brief Finds the keyframe interval of a channel containing the current time, starting from its cursor
+	 */
+	uint32_t find_interval(const Channel &channel) const;
+
+	/**
+	 * @brief Returns one of the values of a channel at a keyframe, skipping the tangents of cubic splines
+	 */
+	glm::vec4 get_key_value(const Channel &channel, uint32_t key, uint32_t element) const;
+
+	glm::vec4 get_value(size_t index) const;
+
+	/**
+	 * @brief Interpolates one of the values of a channel within a keyframe interval
+	 */
+	glm::vec4 interpolate(const Channel &channel, uint32_t interval, float time, float delta, uint32_t element) const;
+
+  private:
+	std::vector<Channel> channels;
+
+	// Channels sorted by node, so that all the channels of a node are written at once
+	std::vector<uint32_t> channel_order;
+
+	std::vector<float> key_times;
+
+	std::vector<float> values_x;
+	std::vector<float> values_y;
+	std::vector<float> values_z;
+	std::vector<float> values_w;
+
+	// Sampled values of the channels, valid_values tells whether the channel was sampled at all
+	std::vector<glm::vec4> sampled_values;
+	std::vector<uint8_t>   valid_values;
+
+	std::vector<float> morph_weights;
 
 	float current_time{0.0f};
 
@@ -0,0 +1,240 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "transform_hierarchy.h"
+
+#include <algorithm>
+
+#include "common/helpers.h"
+#include "common/job_system.h"
+#include "core/util/profiling.hpp"
+
+namespace vkb
+{
+namespace scene_graph
+{
+TransformHierarchy::TransformHierarchy(vkb::scene_graph::NodeCpp &root)
+{
+	// Depth-first pre-order, with the children pushed in reverse to keep their order
+	std::vector<std::pair<vkb::scene_graph::NodeCpp *, uint32_t>> traverse_nodes{{&root, NO_PARENT}};
+	while (!traverse_nodes.empty())
+	{
+		auto [node, parent] = traverse_nodes.back();
+		traverse_nodes.pop_back();
+
+		uint32_t index = to_u32(transforms.size());
+		parents.push_back(parent);
+		transforms.push_back(&node->get_transform());
+
+		// A node listed under another parent than its own (e.g. a light following the camera) keeps its lazy world matrix
+		auto const &children = node->get_children();
+		for (auto child = children.rbegin(); child != children.rend(); ++child)
+		{
+			if ((*child)->get_parent() == node)
+			{
+				traverse_nodes.emplace_back(*child, index);
+			}
+		}
+	}
+
+	// Children come after their parent, so walking backwards finalizes a subtree before it is merged into its parent
+	subtree_ends.resize(transforms.size());
+	for (uint32_t index = to_u32(transforms.size()); 0 < index--;)
+	{
+		subtree_ends[index] = std::max(subtree_ends[index], index + 1);
+		if (parents[index] != NO_PARENT)
+		{
+			subtree_ends[parents[index]] = std::max(subtree_ends[parents[index]], subtree_ends[index]);
+		}
+	}
+
+	local_dirty.assign(transforms.size(), 1);
+	local_matrices.resize(transforms.size());
+	world_matrices.resize(transforms.size());
+
+	for (uint32_t index = 0; index < transforms.size(); ++index)
+	{
+		transforms[index]->set_hierarchy(this, index);
+	}
+
+	update_range(0, to_u32(transforms.size()));
+}
+
+TransformHierarchy::~TransformHierarchy()
+{
+	invalidate();
+}
+
+glm::mat4 const &TransformHierarchy::get_world_matrix(uint32_t index)
+{
+	update();
+
+	return world_matrices[index];
+}
+
+void TransformHierarchy::invalidate()
+{
+	if (!valid)
+	{
+		return;
+	}
+	valid = false;
+
+	for (auto transform : transforms)
+	{
+		transform->set_hierarchy(nullptr, 0);
+	}
+}
+
+bool TransformHierarchy::is_valid() const
+{
+	return valid;
+}
+
+void TransformHierarchy::mark_dirty(uint32_t index)
+{
+	if (!local_dirty[index])
+	{
+		local_dirty[index] = 1;
+		dirty_roots.push_back(index);
+	}
+
+	pending_update.store(true, std::memory_order_release);
+}
+
+size_t TransformHierarchy::size() const
+{
+	return transforms.size();
+}
+
+void TransformHierarchy::update()
+{
+	if (!pending_update.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	PROFILE_SCOPE("Update World Transforms");
+
+	std::lock_guard<std::mutex> guard{update_mutex};
+
+	if (!pending_update.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	// A subtree is a contiguous range, so dirty nodes within an earlier dirty subtree are covered by its range
+	std::sort(dirty_roots.begin(), dirty_roots.end());
+
+	std::vector<Range> ranges;
+	uint32_t           dirty_count = 0;
+	for (auto root : dirty_roots)
+	{
+		if (!ranges.empty() && root <= ranges.back().last)
+		{
+			dirty_count -= ranges.back().last - ranges.back().first;
+			ranges.back().last = std::max(ranges.back().last, subtree_ends[root]);
+		}
+		else
+		{
+			ranges.push_back({root, subtree_ends[root]});
+		}
+		dirty_count += ranges.back().last - ranges.back().first;
+	}
+
+	auto &job_system = vkb::JobSystem::get();
+	if (dirty_count < 2 * PARALLEL_GRAIN_SIZE || job_system.get_thread_count() < 2)
+	{
+		for (auto &range : ranges)
+		{
+			update_range(range.first, range.last);
+		}
+	}
+	else
+	{
+		std::vector<Range> subranges;
+		for (auto &range : ranges)
+		{
+			split_range(range.first, range.last, subranges);
+		}
+
+		// A few chunks per thread balance the load, as the subranges vary a lot in size
+		size_t grain_size = subranges.size() / (4 * job_system.get_thread_count());
+		job_system.parallel_for(subranges.size(), grain_size, [this, &subranges](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i)
+			{
+				update_range(subranges[i].first, subranges[i].last);
+			}
+		});
+	}
+
+	dirty_roots.clear();
+	pending_update.store(false, std::memory_order_release);
+}
+
+void TransformHierarchy::split_range(uint32_t first, uint32_t last, std::vector<Range> &ranges)
+{
+	// Iterative, as a long chain of nodes would otherwise recurse once per node
+	std::vector<Range> split_ranges{{first, last}};
+	while (!split_ranges.empty())
+	{
+		Range range = split_ranges.back();
+		split_ranges.pop_back();
+
+		for (uint32_t root = range.first; root < range.last; root = subtree_ends[root])
+		{
+			if (subtree_ends[root] - root <= PARALLEL_GRAIN_SIZE)
+			{
+				ranges.push_back({root, subtree_ends[root]});
+			}
+			else
+			{
+				// The subtrees of the children are independent once the world matrix of their parent is up to date
+				update_node(root);
+				split_ranges.push_back({root + 1, subtree_ends[root]});
+			}
+		}
+	}
+}
+
+void TransformHierarchy::update_node(uint32_t index)
+{
+	if (local_dirty[index])
+	{
+		local_matrices[index] = transforms[index]->get_matrix();
+		local_dirty[index]    = 0;
+	}
+
+	if (parents[index] == NO_PARENT)
+	{
+		world_matrices[index] = local_matrices[index];
+	}
+	else
+	{
+		world_matrices[index] = world_matrices[parents[index]] * local_matrices[index];
+	}
+}
+
+void TransformHierarchy::update_range(uint32_t first, uint32_t last)
+{
+	for (uint32_t index = first; index < last; ++index)
+	{
+		update_node(index);
+	}
+}
+}        // namespace scene_graph
+}        // namespace vkb
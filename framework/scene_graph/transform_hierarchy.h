@@ -0,0 +1,119 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "common/glm_common.h"
+#include "scene_graph/node.h"
+
+namespace vkb
+{
+namespace scene_graph
+{
+/**
+ * @brief Flattened store of the local and world matrices of a node tree.
+ *
+ * The nodes are sorted in depth-first pre-order, so every parent comes before its children and every subtree is a
+ * contiguous range of indices. World matrices are then updated in a single linear pass over the dirty ranges only,
+ * and independent subtrees of large ranges are updated in parallel.
+ *
+ * Once built, the transforms of the nodes forward their invalidations to the hierarchy, and read their world matrix
+ * from it. Reparenting a node invalidates the hierarchy, which has to be rebuilt.
+ */
+class TransformHierarchy
+{
+  public:
+	static constexpr uint32_t NO_PARENT = ~0U;
+
+	/**
+	 * @brief Flattens the tree below the given root, and attaches the transforms of its nodes
+	 */
+	explicit TransformHierarchy(vkb::scene_graph::NodeCpp &root);
+
+	~TransformHierarchy();
+
+	TransformHierarchy(const TransformHierarchy &)            = delete;
+	TransformHierarchy(TransformHierarchy &&)                 = delete;
+	TransformHierarchy &operator=(const TransformHierarchy &) = delete;
+	TransformHierarchy &operator=(TransformHierarchy &&)      = delete;
+
+	/**
+	 * @brief Gets the world matrix of a node, updating the dirty ranges first if needed
+	 */
+	glm::mat4 const &get_world_matrix(uint32_t index);
+
+	/**
+	 * @brief Detaches the transforms after the structure of the tree changed, they then compute their world matrix from
+	 *        their parent nodes until the hierarchy is rebuilt
+	 */
+	void invalidate();
+
+	/**
+	 * @return Whether the hierarchy still matches the structure of the tree
+	 */
+	bool is_valid() const;
+
+	/**
+	 * @brief Marks the local matrix of a node as changed, which invalidates the world matrices of its whole subtree
+	 *        Must not be called while an update is running
+	 */
+	void mark_dirty(uint32_t index);
+
+	size_t size() const;
+
+	/**
+	 * @brief Recomputes the world matrices of all the dirty subtrees
+	 */
+	void update();
+
+  private:
+	struct Range
+	{
+		uint32_t first;
+		uint32_t last;
+	};
+
+	/**
+	 * @brief Splits a range of whole subtrees into independent subranges of at most PARALLEL_GRAIN_SIZE nodes,
+	 *        updating the roots that are split off on the way
+	 */
+	void split_range(uint32_t first, uint32_t last, std::vector<Range> &ranges);
+
+	void update_node(uint32_t index);
+
+	void update_range(uint32_t first, uint32_t last);
+
+  private:
+	static constexpr uint32_t PARALLEL_GRAIN_SIZE = 4096;
+
+	std::vector<uint32_t>             dirty_roots;         // Nodes marked dirty since the last update
+	std::vector<uint8_t>              local_dirty;
+	std::vector<glm::mat4>            local_matrices;
+	std::vector<uint32_t>             parents;
+	std::atomic<bool>                 pending_update{false};
+	std::vector<uint32_t>             subtree_ends;        // One past the last node of the subtree of each node
+	std::vector<vkb::sg::Transform *> transforms;
+	std::mutex                        update_mutex;
+	bool                              valid = true;
+	std::vector<glm::mat4>            world_matrices;
+};
+}        // namespace scene_graph
+}        // namespace vkb
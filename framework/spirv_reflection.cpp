@@ -1,4 +1,4 @@
-/* Copyright (c) 2019-2020, Arm Limited and Contributors
+/* Copyright (c) 2019-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -17,6 +17,17 @@
 
 #include "spirv_reflection.h"
 
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+#include "core/util/hash.hpp"
+#include "core/util/logging.hpp"
+#include "core/util/profiling.hpp"
+#include "filesystem/filesystem.hpp"
+
+#define SPIRV_REFLECTION_CACHE_DIRECTORY "cache/spirv_reflection"
+
 namespace vkb
 {
 namespace
@@ -374,6 +385,8 @@ inline void read_shader_resource<ShaderResourceType::BufferStorage>(const spirv_
 
 bool SPIRVReflection::reflect_shader_resources(VkShaderStageFlagBits stage, const std::vector<uint32_t> &spirv, std::vector<ShaderResource> &resources, const ShaderVariant &variant)
 {
+	PROFILE_SCOPE("Reflect Shader Resources");
+
 	spirv_cross::CompilerGLSL compiler{spirv};
 
 	auto opts                     = compiler.get_common_options();
@@ -452,4 +465,237 @@ void SPIRVReflection::parse_specialization_constants(const spirv_cross::Compiler
 		resources.push_back(shader_resource);
 	}
 }
+
+namespace
+{
+constexpr uint32_t reflection_cache_file_magic{0x46524B56};        // "VKRF"
+
+// Increment whenever the layout of the file or the output of SPIRVReflection changes
+constexpr uint32_t reflection_cache_file_version{1};
+
+/**
+ * @brief Header of a reflection cache file, followed by one ReflectionCacheRecord and the name of each resource
+ */
+struct ReflectionCacheFileHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t key;
+	uint32_t resource_count;
+	uint32_t payload_size;
+	uint64_t payload_hash;
+};
+
+struct ReflectionCacheRecord
+{
+	uint32_t stages;
+	uint32_t type;
+	uint32_t mode;
+	uint32_t set;
+	uint32_t binding;
+	uint32_t location;
+	uint32_t input_attachment_index;
+	uint32_t vec_size;
+	uint32_t columns;
+	uint32_t array_size;
+	uint32_t offset;
+	uint32_t size;
+	uint32_t constant_id;
+	uint32_t qualifiers;
+	uint32_t name_size;
+};
+
+vkb::filesystem::Path get_reflection_cache_path(uint64_t key)
+{
+	return fmt::format("{}/{:016x}.bin", SPIRV_REFLECTION_CACHE_DIRECTORY, key);
+}
+
+std::vector<uint8_t> serialize_resources(uint64_t key, const std::vector<ShaderResource> &resources)
+{
+	std::vector<uint8_t> payload;
+	for (auto &resource : resources)
+	{
+		ReflectionCacheRecord record{resource.stages,
+		                             static_cast<uint32_t>(resource.type),
+		                             static_cast<uint32_t>(resource.mode),
+		                             resource.set,
+		                             resource.binding,
+		                             resource.location,
+		                             resource.input_attachment_index,
+		                             resource.vec_size,
+		                             resource.columns,
+		                             resource.array_size,
+		                             resource.offset,
+		                             resource.size,
+		                             resource.constant_id,
+		                             resource.qualifiers,
+		                             to_u32(resource.name.size())};
+
+		auto *record_bytes = reinterpret_cast<const uint8_t *>(&record);
+		payload.insert(payload.end(), record_bytes, record_bytes + sizeof(record));
+		payload.insert(payload.end(), resource.name.begin(), resource.name.end());
+	}
+
+	ReflectionCacheFileHeader header{};
+	header.magic          = reflection_cache_file_magic;
+	header.version        = reflection_cache_file_version;
+	header.key            = key;
+	header.resource_count = to_u32(resources.size());
+	header.payload_size   = to_u32(payload.size());
+	header.payload_hash   = hash_bytes(payload.data(), payload.size());
+
+	std::vector<uint8_t> data(sizeof(header) + payload.size());
+	std::memcpy(data.data(), &header, sizeof(header));
+	std::ranges::copy(payload, data.begin() + sizeof(header));
+
+	return data;
+}
+
+bool deserialize_resources(uint64_t key, const std::vector<uint8_t> &data, std::vector<ShaderResource> &resources)
+{
+	ReflectionCacheFileHeader header{};
+	if (data.size() < sizeof(header))
+	{
+		return false;
+	}
+	std::memcpy(&header, data.data(), sizeof(header));
+
+	const uint8_t *payload      = data.data() + sizeof(header);
+	size_t         payload_size = data.size() - sizeof(header);
+	if (header.magic != reflection_cache_file_magic || header.version != reflection_cache_file_version || header.key != key ||
+	    header.payload_size != payload_size || header.payload_hash != hash_bytes(payload, payload_size))
+	{
+		return false;
+	}
+
+	std::vector<ShaderResource> cached_resources(header.resource_count);
+
+	size_t offset = 0;
+	for (auto &resource : cached_resources)
+	{
+		ReflectionCacheRecord record{};
+		if (payload_size - offset < sizeof(record))
+		{
+			return false;
+		}
+		std::memcpy(&record, payload + offset, sizeof(record));
+		offset += sizeof(record);
+
+		if (payload_size - offset < record.name_size)
+		{
+			return false;
+		}
+
+		resource.stages                 = record.stages;
+		resource.type                   = static_cast<ShaderResourceType>(record.type);
+		resource.mode                   = static_cast<ShaderResourceMode>(record.mode);
+		resource.set                    = record.set;
+		resource.binding                = record.binding;
+		resource.location               = record.location;
+		resource.input_attachment_index = record.input_attachment_index;
+		resource.vec_size               = record.vec_size;
+		resource.columns                = record.columns;
+		resource.array_size             = record.array_size;
+		resource.offset                 = record.offset;
+		resource.size                   = record.size;
+		resource.constant_id            = record.constant_id;
+		resource.qualifiers             = record.qualifiers;
+		resource.name.assign(reinterpret_cast<const char *>(payload + offset), record.name_size);
+		offset += record.name_size;
+	}
+
+	if (offset != payload_size)
+	{
+		return false;
+	}
+
+	resources = std::move(cached_resources);
+	return true;
+}
+}        // namespace
+
+SPIRVReflectionCache &SPIRVReflectionCache::get()
+{
+	static SPIRVReflectionCache cache;
+	return cache;
+}
+
+uint64_t SPIRVReflectionCache::get_key(VkShaderStageFlagBits stage, const std::vector<uint32_t> &spirv, const ShaderVariant &variant)
+{
+	// Runtime array sizes are hashed in a stable order so that identical variants produce identical keys
+	std::vector<std::pair<std::string, size_t>> runtime_array_sizes{variant.get_runtime_array_sizes().begin(),
+	                                                                variant.get_runtime_array_sizes().end()};
+	std::ranges::sort(runtime_array_sizes);
+
+	Hasher hasher;
+	hasher.add(stage);
+	hasher.add_bytes(spirv.data(), spirv.size() * sizeof(uint32_t));
+	for (auto &[name, size] : runtime_array_sizes)
+	{
+		hasher.add_bytes(name.data(), name.size());
+		hasher.add(size);
+	}
+
+	return hasher.get();
+}
+
+bool SPIRVReflectionCache::find(uint64_t key, std::vector<ShaderResource> &resources)
+{
+	{
+		std::shared_lock<std::shared_mutex> lock{mutex};
+
+		auto it = entries.find(key);
+		if (it != entries.end())
+		{
+			resources = it->second;
+			return true;
+		}
+	}
+
+	PROFILE_SCOPE("Load Shader Reflection");
+
+	auto fs   = vkb::filesystem::get();
+	auto path = get_reflection_cache_path(key);
+
+	std::vector<ShaderResource> cached_resources;
+	try
+	{
+		if (!fs->is_file(path) || !deserialize_resources(key, fs->read_file_binary(path), cached_resources))
+		{
+			return false;
+		}
+	}
+	catch (const std::runtime_error &e)
+	{
+		LOGW("Failed to read shader reflection cache file {}: {}", path.string(), e.what());
+		return false;
+	}
+
+	std::unique_lock<std::shared_mutex> lock{mutex};
+
+	resources = entries.try_emplace(key, std::move(cached_resources)).first->second;
+	return true;
+}
+
+void SPIRVReflectionCache::insert(uint64_t key, const std::vector<ShaderResource> &resources)
+{
+	{
+		std::unique_lock<std::shared_mutex> lock{mutex};
+
+		if (!entries.try_emplace(key, resources).second)
+		{
+			return;
+		}
+	}
+
+	auto path = get_reflection_cache_path(key);
+	try
+	{
+		vkb::filesystem::get()->write_file(path, serialize_resources(key, resources));
+	}
+	catch (const std::runtime_error &e)
+	{
+		LOGW("Failed to write shader reflection cache file {}: {}", path.string(), e.what());
+	}
+}
 }        // namespace vkb
@@ -1,4 +1,4 @@
-/* Copyright (c) 2019-2025, Arm Limited and Contributors
+/* Copyright (c) 2019-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -63,4 +64,36 @@ class SPIRVReflection
 	                                    std::vector<ShaderResource> &resources,
 	                                    const ShaderVariant         &variant);
 };
+
+/**
+ * @brief Process-wide cache of reflected shader resources, backed by one file per shader variant on disk
+ *
+ * Entries are keyed by a hash of the SPIR-V code, the shader stage and the runtime array sizes of the variant,
+ * so a shader that changes gets a new key and its stale file is never read again. Resources found in the cache
+ * are returned exactly as SPIRVReflection produced them, so spirv-cross is only run once per variant.
+ */
+class SPIRVReflectionCache
+{
+  public:
+	static SPIRVReflectionCache &get();
+
+	/// @brief Computes the cache key of a shader variant
+	static uint64_t get_key(VkShaderStageFlagBits stage, const std::vector<uint32_t> &spirv, const ShaderVariant &variant);
+
+	/// @brief Looks up reflected resources in memory first, then on disk
+	/// @param key The key returned by get_key
+	/// @param[out] resources The cached shader resources, left untouched if not found
+	/// @return True if the resources were found
+	bool find(uint64_t key, std::vector<ShaderResource> &resources);
+
+	/// @brief Stores reflected resources in memory and writes them to disk
+	void insert(uint64_t key, const std::vector<ShaderResource> &resources);
+
+  private:
+	SPIRVReflectionCache() = default;
+
+	std::shared_mutex mutex;
+
+	std::unordered_map<uint64_t, std::vector<ShaderResource>> entries;
+};
 }        // namespace vkb
@@ -0,0 +1,46 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "culling_stats_provider.h"
+
+#include "geometry/frustum_culler.h"
+
+namespace vkb
+{
+CullingStatsProvider::CullingStatsProvider(std::set<StatIndex> &requested_stats)
+{
+	// The cullers count the boxes they test, so these are always supported
+	requested_stats.erase(StatIndex::visible_objects);
+	requested_stats.erase(StatIndex::culled_objects);
+}
+
+bool CullingStatsProvider::is_available(StatIndex index) const
+{
+	return index == StatIndex::visible_objects ||
+	       index == StatIndex::culled_objects;
+}
+
+StatsProvider::Counters CullingStatsProvider::sample(float delta_time)
+{
+	auto culling_counters = FrustumCuller::reset_counters();
+
+	Counters res;
+	res[StatIndex::visible_objects].result = culling_counters.visible;
+	res[StatIndex::culled_objects].result  = culling_counters.culled;
+	return res;
+}
+}        // namespace vkb
@@ -0,0 +1,51 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "descriptor_set_cache_stats_provider.h"
+
+#include "rendering/descriptor_set_cache.h"
+
+namespace vkb
+{
+DescriptorSetCacheStatsProvider::DescriptorSetCacheStatsProvider(std::set<StatIndex>                &requested_stats,
+                                                                 vkb::rendering::DescriptorSetCache &descriptor_set_cache) :
+    descriptor_set_cache{descriptor_set_cache}
+{
+	// The cache counts its own hits, misses and evictions, so these are always supported
+	requested_stats.erase(StatIndex::descriptor_set_cache_hits);
+	requested_stats.erase(StatIndex::descriptor_set_cache_misses);
+	requested_stats.erase(StatIndex::descriptor_set_cache_evictions);
+}
+
+bool DescriptorSetCacheStatsProvider::is_available(StatIndex index) const
+{
+	return index == StatIndex::descriptor_set_cache_hits ||
+	       index == StatIndex::descriptor_set_cache_misses ||
+	       index == StatIndex::descriptor_set_cache_evictions;
+}
+
+StatsProvider::Counters DescriptorSetCacheStatsProvider::sample(float delta_time)
+{
+	auto cache_counters = descriptor_set_cache.reset_counters();
+
+	Counters res;
+	res[StatIndex::descriptor_set_cache_hits].result      = cache_counters.hits;
+	res[StatIndex::descriptor_set_cache_misses].result    = cache_counters.misses;
+	res[StatIndex::descriptor_set_cache_evictions].result = cache_counters.evictions;
+	return res;
+}
+}        // namespace vkb
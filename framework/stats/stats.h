@@ -22,6 +22,8 @@
 #include <future>
 
 #include "core/util/profiling.hpp"
+#include "stats/culling_stats_provider.h"
+#include "stats/descriptor_set_cache_stats_provider.h"
 #include "stats/frame_time_stats_provider.h"
 #include "stats/stats_common.h"
 #include "stats/stats_provider.h"
@@ -243,6 +245,16 @@ static inline char const *to_string(StatIndex index)
 			return "External Read Bytes (MiB/s)";
 		case StatIndex::gpu_ext_write_bytes:
 			return "External Write Bytes (MiB/s)";
+		case StatIndex::descriptor_set_cache_hits:
+			return "Descriptor Set Cache Hits";
+		case StatIndex::descriptor_set_cache_misses:
+			return "Descriptor Set Cache Misses";
+		case StatIndex::descriptor_set_cache_evictions:
+			return "Descriptor Set Cache Evictions";
+		case StatIndex::visible_objects:
+			return "Visible Objects";
+		case StatIndex::culled_objects:
+			return "Culled Objects";
 		default:
 			return nullptr;
 	}
@@ -499,6 +511,8 @@ inline void Stats<bindingType>::request_stats(const std::set<StatIndex> &wanted_
 	// All supported stats will be removed from the given 'stats' set by the provider's constructor
 	// so subsequent providers only see requests for stats that aren't already supported.
 	providers.emplace_back(std::make_unique<vkb::FrameTimeStatsProvider>(stats));
+	providers.emplace_back(std::make_unique<vkb::DescriptorSetCacheStatsProvider>(stats, render_context.get_descriptor_set_cache()));
+	providers.emplace_back(std::make_unique<vkb::CullingStatsProvider>(stats));
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
 	providers.emplace_back(std::make_unique<HWCPipeStatsProvider>(stats));
 #endif
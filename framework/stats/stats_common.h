@@ -63,6 +63,13 @@ enum class StatIndex
 	gpu_ext_read_bytes,
 	gpu_ext_write_bytes,
 	gpu_tex_cycles,
+
+	descriptor_set_cache_hits,
+	descriptor_set_cache_misses,
+	descriptor_set_cache_evictions,
+
+	visible_objects,
+	culled_objects,
 };
 
 struct StatIndexHash
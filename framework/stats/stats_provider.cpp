@@ -1,4 +1,4 @@
-/* Copyright (c) 2020-2023, Broadcom Inc. and Contributors
+/* Copyright (c) 2020-2026, Broadcom Inc. and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -54,6 +54,13 @@ std::map<StatIndex, StatGraphData> StatsProvider::default_graph_map{
     {StatIndex::gpu_ext_write_stalls,  {"External Write Stalls",                       "{:4.1f} M/s",   static_cast<float>(1e-6)}},
     {StatIndex::gpu_ext_read_bytes,    {"External Read Bytes",                         "{:4.1f} MiB/s", 1.0f / (1024.0f * 1024.0f)}},
     {StatIndex::gpu_ext_write_bytes,   {"External Write Bytes",                        "{:4.1f} MiB/s", 1.0f / (1024.0f * 1024.0f)}},
+
+    {StatIndex::descriptor_set_cache_hits,      {"Descriptor Set Cache Hits",      "{:4.0f}"}},
+    {StatIndex::descriptor_set_cache_misses,    {"Descriptor Set Cache Misses",    "{:4.0f}"}},
+    {StatIndex::descriptor_set_cache_evictions, {"Descriptor Set Cache Evictions", "{:4.0f}"}},
+
+    {StatIndex::visible_objects, {"Visible Objects", "{:4.0f}"}},
+    {StatIndex::culled_objects,  {"Culled Objects",  "{:4.0f}"}},
     // clang-format on
 };
 
@@ -26,6 +26,7 @@
 #include "platform/application.h"
 #include "platform/window.h"
 #include "rendering/render_pipeline.h"
+#include "rendering/skinning_pass.h"
 #include "scene_graph/components/camera.h"
 #include "scene_graph/script.h"
 #include "scene_graph/scripts/animation.h"
@@ -208,6 +209,12 @@ class VulkanSample : public vkb::Application
 	 */
 	virtual void prepare_render_context();
 
+	/**
+	 * @brief Override this to return false in samples that index their per-frame resources by the acquired swapchain image,
+	 * and so need one frame per swapchain image. The frames in flight setting is then ignored.
+	 */
+	virtual bool supports_frames_in_flight() const;
+
 	/**
 	 * @brief Triggers the render pipeline, it can be overridden by samples to specialize their rendering logic
 	 * @param command_buffer The command buffer to record the commands to
@@ -299,6 +306,31 @@ class VulkanSample : public vkb::Application
 
 	void set_render_pipeline(std::unique_ptr<vkb::rendering::RenderPipeline<bindingType>> &&render_pipeline);
 
+	/**
+	 * @brief Sets whether the skinned and morphed meshes of the scene are deformed by a compute pass before drawing.
+	 * Needs to be called before load_scene(), and requires the compiled skinning/skinning.comp shader.
+	 * Default state is false, where such meshes are drawn in their bind pose.
+	 * @param enable If true, a SkinningPass is created for scenes with skins or morph targets.
+	 */
+	void set_skinning_enable(bool enable);
+
+	/**
+	 * @brief Sets whether the world matrices of the scene are kept in a flattened TransformHierarchy, updated in a linear
+	 * pass over the changed subtrees, instead of being resolved through the parent nodes.
+	 * Default state is false. The hierarchy is built on the first scene update, and rebuilt after a node is reparented.
+	 * @param enable If true, the scene's transform hierarchy is built before updating the scene.
+	 */
+	void set_transform_hierarchy_enable(bool enable);
+
+	/**
+	 * @brief Sets the number of frames the render context records ahead of the GPU, independently of the number of
+	 * swapchain images. Needs to be called before prepare(), and is overridden by the --frames-in-flight option.
+	 * Ignored if supports_frames_in_flight() returns false.
+	 * Default state is 0, where there is one frame per swapchain image.
+	 * @param count The number of frames in flight, or 0 for one frame per swapchain image
+	 */
+	void set_frames_in_flight(uint32_t count);
+
 	/**
 	 * @brief Main loop sample events
 	 */
@@ -384,6 +416,11 @@ class VulkanSample : public vkb::Application
 	 */
 	std::unique_ptr<vkb::scene_graph::SceneCpp> scene;
 
+	/**
+	 * @brief Deforms the skinned and morphed meshes of the scene before it is drawn, only created if enabled and the scene has any
+	 */
+	std::unique_ptr<vkb::rendering::SkinningPass> skinning_pass;
+
 	std::unique_ptr<vkb::GuiCpp> gui;
 
 	std::unique_ptr<vkb::stats::StatsCpp> stats;
@@ -413,6 +450,15 @@ class VulkanSample : public vkb::Application
 	/** @brief Whether or not we want a high priority graphics queue. */
 	bool high_priority_graphics_queue{false};
 
+	/** @brief Whether or not the skinned and morphed meshes of the scene are deformed before drawing. */
+	bool skinning_enabled{false};
+
+	/** @brief Whether or not the world matrices of the scene are kept in a flattened transform hierarchy. */
+	bool transform_hierarchy_enabled{false};
+
+	/** @brief The number of frames in flight of the render context, 0 for one per swapchain image. */
+	uint32_t frames_in_flight{0};
+
 	std::unique_ptr<vkb::core::HPPDebugUtils> debug_utils;
 
   public:
@@ -420,6 +466,11 @@ class VulkanSample : public vkb::Application
 	 * @brief Can be set from the GPU selection plugin to explicitly select a GPU instead
 	 */
 	inline static uint32_t selected_gpu_index = ~0;
+
+	/**
+	 * @brief Can be set from the window options plugin to override the number of frames in flight of the sample
+	 */
+	inline static uint32_t selected_frames_in_flight = 0;
 };
 
 using VulkanSampleC   = VulkanSample<vkb::BindingType::C>;
@@ -435,6 +486,7 @@ inline VulkanSample<bindingType>::~VulkanSample()
 		device->get_handle().waitIdle();
 	}
 
+	skinning_pass.reset();
 	scene.reset();
 	stats.reset();
 	gui.reset();
@@ -1190,6 +1242,8 @@ inline void VulkanSample<bindingType>::load_scene(const std::string &path)
 {
 	vkb::HPPGLTFLoader loader(*device);
 
+	skinning_pass.reset();
+
 	scene = loader.read_scene_from_file(path);
 
 	if (!scene)
@@ -1197,6 +1251,11 @@ inline void VulkanSample<bindingType>::load_scene(const std::string &path)
 		LOGE("Cannot load scene: {}", path.c_str());
 		throw std::runtime_error("Cannot load scene: " + path);
 	}
+
+	if (skinning_enabled && render_context && vkb::rendering::SkinningPass::is_needed(*scene))
+	{
+		skinning_pass = std::make_unique<vkb::rendering::SkinningPass>(*render_context, *scene);
+	}
 }
 
 template <vkb::BindingType bindingType>
@@ -1364,6 +1423,19 @@ inline bool VulkanSample<bindingType>::prepare(const ApplicationOptions &options
 	VULKAN_HPP_DEFAULT_DISPATCHER.init(device->get_handle());
 
 	create_render_context();
+
+	uint32_t frame_count = selected_frames_in_flight != 0 ? selected_frames_in_flight : frames_in_flight;
+	if (frame_count != 0)
+	{
+		if (supports_frames_in_flight())
+		{
+			render_context->set_frames_in_flight(frame_count);
+		}
+		else
+		{
+			LOGW("Ignoring the {} frames in flight requested, this sample needs one frame per swapchain image", frame_count);
+		}
+	}
 	prepare_render_context();
 
 	stats = std::make_unique<vkb::stats::StatsCpp>(*render_context);
@@ -1397,6 +1469,12 @@ inline void VulkanSample<bindingType>::prepare_render_context()
 	render_context->prepare();
 }
 
+template <vkb::BindingType bindingType>
+inline bool VulkanSample<bindingType>::supports_frames_in_flight() const
+{
+	return true;
+}
+
 template <vkb::BindingType bindingType>
 inline void VulkanSample<bindingType>::render(vkb::core::CommandBuffer<bindingType> &command_buffer)
 {
@@ -1630,6 +1708,24 @@ inline void VulkanSample<bindingType>::set_render_pipeline(std::unique_ptr<vkb::
 	}
 }
 
+template <vkb::BindingType bindingType>
+inline void VulkanSample<bindingType>::set_skinning_enable(bool enable)
+{
+	skinning_enabled = enable;
+}
+
+template <vkb::BindingType bindingType>
+inline void VulkanSample<bindingType>::set_transform_hierarchy_enable(bool enable)
+{
+	transform_hierarchy_enabled = enable;
+}
+
+template <vkb::BindingType bindingType>
+inline void VulkanSample<bindingType>::set_frames_in_flight(uint32_t count)
+{
+	frames_in_flight = count;
+}
+
 template <vkb::BindingType bindingType>
 inline void VulkanSample<bindingType>::set_viewport_and_scissor(vkb::core::CommandBuffer<bindingType> const &command_buffer, Extent2DType const &extent)
 {
@@ -1669,6 +1765,12 @@ inline void VulkanSample<bindingType>::update(float delta_time)
 	command_buffer->begin(vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
 	stats->begin_sampling(*command_buffer);
 
+	// The deformed vertices must be ready before any render pass draws them
+	if (skinning_pass)
+	{
+		skinning_pass->record(*command_buffer);
+	}
+
 	if constexpr (bindingType == BindingType::Cpp)
 	{
 		draw(*command_buffer, render_context->get_active_frame().get_render_target());
@@ -1741,6 +1843,12 @@ inline void VulkanSample<bindingType>::update_scene(float delta_time)
 {
 	if (scene)
 	{
+		// Flattened once the sample is done setting up the scene, nodes added later keep their lazy world matrix
+		if (transform_hierarchy_enabled && (!scene->get_transform_hierarchy() || !scene->get_transform_hierarchy()->is_valid()))
+		{
+			scene->build_transform_hierarchy();
+		}
+
 		// Update scripts
 		if (scene->has_component<sg::Script>())
 		{
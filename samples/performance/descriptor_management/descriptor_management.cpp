@@ -58,7 +58,7 @@ bool DescriptorManagement::prepare(const vkb::ApplicationOptions &options)
 	set_render_pipeline(std::move(render_pipeline));
 
 	// Add a GUI with the stats you want to monitor
-	get_stats().request_stats({vkb::StatIndex::frame_times});
+	get_stats().request_stats({vkb::StatIndex::frame_times, vkb::StatIndex::descriptor_set_cache_hits, vkb::StatIndex::descriptor_set_cache_misses});
 	create_gui(*window, &get_stats());
 
 	return true;
@@ -86,9 +86,15 @@ void DescriptorManagement::update(float delta_time)
 
 	render_context.get_active_frame().set_buffer_allocation_strategy(buffer_alloc_strategy);
 
-	auto descriptor_management_strategy = (descriptor_caching.value == 0) ?
-	                                          vkb::rendering::DescriptorManagementStrategy::CreateDirectly :
-	                                          vkb::rendering::DescriptorManagementStrategy::StoreInCache;
+	auto descriptor_management_strategy = vkb::rendering::DescriptorManagementStrategy::CreateDirectly;
+	if (descriptor_caching.value == 1)
+	{
+		descriptor_management_strategy = vkb::rendering::DescriptorManagementStrategy::StoreInCache;
+	}
+	else if (descriptor_caching.value == 2)
+	{
+		descriptor_management_strategy = vkb::rendering::DescriptorManagementStrategy::ShareAcrossFrames;
+	}
 
 	render_context.get_active_frame().set_descriptor_management_strategy(descriptor_management_strategy);
 
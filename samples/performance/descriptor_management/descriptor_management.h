@@ -1,4 +1,4 @@
-/* Copyright (c) 2019-2024, Arm Limited and Contributors
+/* Copyright (c) 2019-2026, Arm Limited and Contributors
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -46,7 +46,7 @@ class DescriptorManagement : public vkb::VulkanSampleC
 
 	RadioButtonGroup descriptor_caching{
 	    "Descriptor set caching",
-	    {"Disabled", "Enabled"},
+	    {"Disabled", "Enabled", "Shared"},
 	    0};
 
 	RadioButtonGroup buffer_allocation{
@@ -43,7 +43,7 @@ HPPPipelineCache::~HPPPipelineCache()
 
 	if (has_device())
 	{
-		vkb::fs::write_temp(get_device().get_resource_cache().serialize(), "hpp_cache.data");
+		get_device().get_resource_cache().save(vkb::filesystem::get()->temp_directory() / "hpp_cache.data");
 	}
 }
 
@@ -77,18 +77,8 @@ bool HPPPipelineCache::prepare(const vkb::ApplicationOptions &options)
 	/* Use pipeline cache to store pipelines */
 	resource_cache.set_pipeline_cache(pipeline_cache);
 
-	std::vector<uint8_t> data_cache;
-	try
-	{
-		data_cache = vkb::fs::read_temp("hpp_cache.data");
-	}
-	catch (std::runtime_error &ex)
-	{
-		LOGW("No data cache found. {}", ex.what());
-	}
-
-	/* Build all pipelines from a previous run */
-	resource_cache.warmup(data_cache);
+	/* Build all pipelines from a previous run, unless they were recorded on another device or driver */
+	resource_cache.load(vkb::filesystem::get()->temp_directory() / "hpp_cache.data");
 
 	get_stats().request_stats({vkb::StatIndex::frame_times});
 
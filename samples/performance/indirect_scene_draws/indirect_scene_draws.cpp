@@ -0,0 +1,226 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "indirect_scene_draws.h"
+
+#include "gltf_loader.h"
+#include "gui.h"
+#include "rendering/subpasses/forward_subpass.h"
+#include "scene_graph/components/light.h"
+#include "scene_graph/components/sub_mesh.h"
+#include "stats/stats.h"
+
+IndirectSceneDraws::IndirectSceneDraws()
+{
+	// The indirect subpass reads the world matrix of every draw each frame
+	set_transform_hierarchy_enable(true);
+
+	auto &config = get_configuration();
+
+	config.insert<vkb::IntSetting>(0, indirect_enabled, 0);
+	config.insert<vkb::IntSetting>(1, indirect_enabled, 1);
+}
+
+void IndirectSceneDraws::request_gpu_features(vkb::core::PhysicalDeviceC &gpu)
+{
+	// Without multiDrawIndirect the subpass records an indirect draw per sub mesh, which still moves the culling to the GPU
+	if (gpu.get_features().multiDrawIndirect)
+	{
+		gpu.get_mutable_requested_features().multiDrawIndirect = VK_TRUE;
+	}
+
+	if (gpu.get_features().drawIndirectFirstInstance)
+	{
+		gpu.get_mutable_requested_features().drawIndirectFirstInstance = VK_TRUE;
+		indirect_supported                                             = true;
+	}
+}
+
+bool IndirectSceneDraws::prepare(const vkb::ApplicationOptions &options)
+{
+	if (!VulkanSample::prepare(options))
+	{
+		return false;
+	}
+
+	load_scene("scenes/sponza/Sponza01.gltf");
+
+	auto &camera_node = vkb::add_free_camera(get_scene(), "main_camera", get_render_context().get_surface_extent());
+	camera            = dynamic_cast<vkb::sg::PerspectiveCamera *>(&camera_node.get_component<vkb::sg::Camera>());
+
+	// The clustered lighting shaders are framework shaders, built with VKB_BUILD_SHADERS when their binaries are missing
+	try
+	{
+		forward_pipeline = create_forward_pipeline();
+	}
+	catch (const std::exception &e)
+	{
+		LOGE("Cannot prepare the clustered lighting, the scene is drawn with its own lights: {}", e.what());
+		clustered_lighting = false;
+		forward_pipeline   = create_forward_pipeline();
+	}
+
+	if (clustered_lighting)
+	{
+		add_point_lights();
+	}
+
+	if (!indirect_supported)
+	{
+		LOGW("drawIndirectFirstInstance is not supported, the scene is only drawn with a draw per sub mesh");
+	}
+	else
+	{
+		// The indirect shaders are framework shaders, built with VKB_BUILD_SHADERS when their binaries are missing
+		try
+		{
+			indirect_pipeline = create_indirect_pipeline();
+		}
+		catch (const std::exception &e)
+		{
+			LOGE("Cannot prepare the indirect draws, the scene is only drawn with a draw per sub mesh: {}", e.what());
+			indirect_subpass = nullptr;
+		}
+	}
+
+	get_stats().request_stats({vkb::StatIndex::frame_times, vkb::StatIndex::cpu_cycles});
+
+	create_gui(*window, &get_stats());
+
+	return true;
+}
+
+void IndirectSceneDraws::add_point_lights()
+{
+	// Magic numbers used to offset lights in the Sponza scene
+	auto light_pos = glm::vec3(0.0f, 8.0f, -225.0f);
+
+	vkb::sg::LightProperties props;
+	props.intensity = 0.2f;
+	props.range     = 300.0f;
+
+	for (int i = -8; i < 8; ++i)
+	{
+		for (int j = 0; j < 2; ++j)
+		{
+			for (int k = 0; k < 4; ++k)
+			{
+				glm::vec3 pos = light_pos + glm::vec3(i * 200, k * 100, j * (225 + 140));
+
+				props.color.x = static_cast<float>(rand()) / (RAND_MAX);
+				props.color.y = static_cast<float>(rand()) / (RAND_MAX);
+				props.color.z = static_cast<float>(rand()) / (RAND_MAX);
+
+				vkb::add_point_light(get_scene(), pos, props);
+				++point_light_count;
+			}
+		}
+	}
+}
+
+std::unique_ptr<vkb::rendering::RenderPipelineC> IndirectSceneDraws::create_forward_pipeline()
+{
+	vkb::ShaderSource vert_shader{"base.vert.spv"};
+	vkb::ShaderSource frag_shader{clustered_lighting ? "clustered_lighting/forward.frag.spv" : "base.frag.spv"};
+	auto              scene_subpass =
+	    std::make_unique<vkb::rendering::subpasses::ForwardSubpassC>(get_render_context(), std::move(vert_shader), std::move(frag_shader), get_scene(), *camera);
+	if (clustered_lighting)
+	{
+		scene_subpass->enable_clustered_lighting();
+	}
+
+	std::vector<std::unique_ptr<vkb::rendering::SubpassC>> scene_subpasses{};
+	scene_subpasses.push_back(std::move(scene_subpass));
+
+	return std::make_unique<vkb::rendering::RenderPipelineC>(std::move(scene_subpasses));
+}
+
+std::unique_ptr<vkb::rendering::RenderPipelineC> IndirectSceneDraws::create_indirect_pipeline()
+{
+	vkb::ShaderSource vert_shader{"indirect_geometry/indirect_geometry.vert.spv"};
+	vkb::ShaderSource frag_shader{clustered_lighting ? "clustered_lighting/indirect_geometry.frag.spv" : "indirect_geometry/indirect_geometry.frag.spv"};
+	auto              scene_subpass =
+	    std::make_unique<vkb::rendering::subpasses::IndirectGeometrySubpassC>(get_render_context(), std::move(vert_shader), std::move(frag_shader), get_scene(), *camera);
+	if (clustered_lighting)
+	{
+		scene_subpass->enable_clustered_lighting();
+	}
+	indirect_subpass = scene_subpass.get();
+
+	std::vector<std::unique_ptr<vkb::rendering::SubpassC>> scene_subpasses{};
+	scene_subpasses.push_back(std::move(scene_subpass));
+
+	return std::make_unique<vkb::rendering::RenderPipelineC>(std::move(scene_subpasses));
+}
+
+void IndirectSceneDraws::render(vkb::core::CommandBufferC &command_buffer)
+{
+	// POI
+	//
+	// The forward pipeline records a draw for each visible sub mesh, culled and sorted on the CPU every frame.
+	// The indirect pipeline records a compute pass culling all the sub meshes, and then a single indirect draw for each
+	// pipeline state, so its CPU cost does not depend on the number of objects in the scene
+
+	auto &render_target = get_render_context().get_active_frame().get_render_target();
+
+	if (indirect_enabled && indirect_pipeline)
+	{
+		indirect_pipeline->draw(command_buffer, render_target);
+	}
+	else
+	{
+		forward_pipeline->draw(command_buffer, render_target);
+	}
+}
+
+void IndirectSceneDraws::draw_gui()
+{
+	bool     landscape = camera->get_aspect_ratio() > 1.0f;
+	uint32_t lines     = landscape ? 3 : 4;
+
+	get_gui().show_options_window(
+	    /* body = */ [this, landscape]() {
+		    ImGui::RadioButton("Draw per sub mesh", &indirect_enabled, 0);
+		    if (landscape)
+		    {
+			    ImGui::SameLine();
+		    }
+		    if (indirect_pipeline)
+		    {
+			    ImGui::RadioButton("Indirect draws", &indirect_enabled, 1);
+			    ImGui::Text("%u sub mesh instances drawn with %u indirect draw calls", indirect_subpass->get_draw_count(), indirect_subpass->get_draw_call_count());
+		    }
+		    else
+		    {
+			    ImGui::Text("Indirect draws are not available");
+		    }
+		    if (clustered_lighting)
+		    {
+			    ImGui::Text("%u point lights assigned to a cluster grid", point_light_count);
+		    }
+		    else
+		    {
+			    ImGui::Text("Clustered lighting is not available");
+		    }
+	    },
+	    /* lines = */ lines);
+}
+
+std::unique_ptr<vkb::VulkanSampleC> create_indirect_scene_draws()
+{
+	return std::make_unique<IndirectSceneDraws>();
+}
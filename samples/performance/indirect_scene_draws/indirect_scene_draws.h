@@ -0,0 +1,73 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "rendering/render_pipeline.h"
+#include "rendering/subpasses/indirect_geometry_subpass.h"
+#include "scene_graph/components/perspective_camera.h"
+#include "vulkan_sample.h"
+
+/**
+ * @brief Drawing a scene with one indirect draw per pipeline state, culled on the GPU, compared with a draw per sub mesh
+ */
+class IndirectSceneDraws : public vkb::VulkanSampleC
+{
+  public:
+	IndirectSceneDraws();
+
+	virtual ~IndirectSceneDraws() = default;
+
+	virtual bool prepare(const vkb::ApplicationOptions &options) override;
+
+	virtual void request_gpu_features(vkb::core::PhysicalDeviceC &gpu) override;
+
+  private:
+	vkb::sg::PerspectiveCamera *camera{nullptr};
+
+	virtual void draw_gui() override;
+
+	virtual void render(vkb::core::CommandBufferC &command_buffer) override;
+
+	/**
+	 * @brief Adds point lights along the colonnades of Sponza, each lighting a few clusters only
+	 */
+	void add_point_lights();
+
+	std::unique_ptr<vkb::rendering::RenderPipelineC> create_forward_pipeline();
+
+	std::unique_ptr<vkb::rendering::RenderPipelineC> create_indirect_pipeline();
+
+	std::unique_ptr<vkb::rendering::RenderPipelineC> forward_pipeline{};
+
+	std::unique_ptr<vkb::rendering::RenderPipelineC> indirect_pipeline{};
+
+	/// The subpass of the indirect pipeline, which reports its draw calls
+	vkb::rendering::subpasses::IndirectGeometrySubpassC *indirect_subpass{nullptr};
+
+	/// Whether the device can read the draw index as the first instance of an indirect draw
+	bool indirect_supported{false};
+
+	/// Whether the scene subpasses read the point and spot lights from a cluster grid
+	bool clustered_lighting{true};
+
+	uint32_t point_light_count{0};
+
+	int indirect_enabled{0};
+};
+
+std::unique_ptr<vkb::VulkanSampleC> create_indirect_scene_draws();
@@ -0,0 +1,82 @@
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The point and spot lights assigned to a cluster grid by vkb::rendering::LightClusters. Requires lighting.h, and
+// the bindings follow the binding of the light buffer, as bound by CommandBuffer::bind_lighting
+
+#ifndef CLUSTERED_LIGHTING_BINDING
+#	define CLUSTERED_LIGHTING_BINDING 5
+#endif
+
+layout(set = 0, binding = CLUSTERED_LIGHTING_BINDING) uniform LightClusterInfo
+{
+	mat4  view;
+	uvec4 grid_size;         // w is the number of clustered lights
+	vec4  tile_scale;        // xy map a fragment coordinate to a tile, z and w map the log of a view depth to a slice
+}
+cluster_info;
+
+layout(std430, set = 0, binding = CLUSTERED_LIGHTING_BINDING + 1) readonly buffer ClusteredLights
+{
+	Light clustered_lights[];
+};
+
+layout(std430, set = 0, binding = CLUSTERED_LIGHTING_BINDING + 2) readonly buffer ClusterRanges
+{
+	uvec2 cluster_ranges[];        // Offset in the light indices and number of lights of each cluster
+};
+
+layout(std430, set = 0, binding = CLUSTERED_LIGHTING_BINDING + 3) readonly buffer ClusterLightIndices
+{
+	uint cluster_light_indices[];
+};
+
+uint get_cluster_index(vec3 pos, vec2 frag_coord)
+{
+	float view_depth = max(-(cluster_info.view * vec4(pos, 1.0)).z, 1e-4);
+
+	uvec3 cluster;
+	cluster.xy = min(uvec2(frag_coord * cluster_info.tile_scale.xy), cluster_info.grid_size.xy - 1U);
+	cluster.z  = uint(clamp(floor(log(view_depth) * cluster_info.tile_scale.z + cluster_info.tile_scale.w), 0.0, float(cluster_info.grid_size.z - 1U)));
+
+	return cluster.x + cluster_info.grid_size.x * (cluster.y + cluster_info.grid_size.y * cluster.z);
+}
+
+vec3 apply_clustered_lights(vec3 pos, vec3 normal, vec2 frag_coord)
+{
+	uvec2 range = cluster_ranges[get_cluster_index(pos, frag_coord)];
+
+	vec3 light_contribution = vec3(0.0);
+	for (uint i = 0U; i < range.y; ++i)
+	{
+		Light light = clustered_lights[cluster_light_indices[range.x + i]];
+
+		// The lights are only assigned to the clusters within their range, so they fade out smoothly before it
+		float window = 1.0;
+		if (0.0 < light.direction.w)
+		{
+			float ratio = distance(light.position.xyz, pos) / light.direction.w;
+			window      = clamp(1.0 - ratio * ratio * ratio * ratio, 0.0, 1.0);
+			window *= window;
+		}
+
+		// position.w is the type of the light, 1 for point lights and 2 for spot lights
+		light_contribution += window * (light.position.w < 1.5 ? apply_point_light(light, pos, normal) : apply_spot_light(light, pos, normal));
+	}
+
+	return light_contribution;
+}
@@ -0,0 +1,98 @@
+#version 450
+/* Copyright (c) 2026, Arm Limited and Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 the "License";
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+precision highp float;
+
+struct MaterialData
+{
+	vec4  base_color_factor;
+	float metallic_factor;
+	float roughness_factor;
+	float alpha_cutoff;
+	uint  alpha_mask;
+};
+
+layout(location = 0) in vec4 in_pos;
+layout(location = 1) in vec2 in_uv;
+layout(location = 2) in vec3 in_normal;
+layout(location = 3) flat in uint in_material_index;
+
+layout(location = 0) out vec4 o_color;
+
+layout(set = 0, binding = 1) uniform GlobalUniform
+{
+	mat4 model;
+	mat4 view_proj;
+	vec3 camera_position;
+}
+global_uniform;
+
+#include "lighting.h"
+
+layout(set = 0, binding = 4) uniform LightsInfo
+{
+	Light directional_lights[8];
+	Light point_lights[8];
+	Light spot_lights[8];
+}
+lights_info;
+
+// No texture is sampled, so the materials take the binding of the base color texture, clear of the clustered lighting ones
+layout(std430, set = 0, binding = 0) readonly buffer Materials
+{
+	MaterialData materials[];
+};
+
+layout(constant_id = 0) const uint DIRECTIONAL_LIGHT_COUNT = 0U;
+layout(constant_id = 1) const uint POINT_LIGHT_COUNT       = 0U;
+layout(constant_id = 2) const uint SPOT_LIGHT_COUNT        = 0U;
+
+void main(void)
+{
+	MaterialData material = materials[in_material_index];
+
+	vec4 base_color = material.base_color_factor;
+
+	if (material.alpha_mask != 0U && base_color.a < material.alpha_cutoff)
+	{
+		discard;
+	}
+
+	vec3 normal = normalize(in_normal);
+
+	vec3 light_contribution = vec3(0.0);
+
+	for (uint i = 0U; i < DIRECTIONAL_LIGHT_COUNT; ++i)
+	{
+		light_contribution += apply_directional_light(lights_info.directional_lights[i], normal);
+	}
+
+	for (uint i = 0U; i < POINT_LIGHT_COUNT; ++i)
+	{
+		light_contribution += apply_point_light(lights_info.point_lights[i], in_pos.xyz, normal);
+	}
+
+	for (uint i = 0U; i < SPOT_LIGHT_COUNT; ++i)
+	{
+		light_contribution += apply_spot_light(lights_info.spot_lights[i], in_pos.xyz, normal);
+	}
+
+	vec3 ambient_color = vec3(0.2) * base_color.xyz;
+
+	o_color = vec4(ambient_color + light_contribution * base_color.xyz, base_color.w);
+}